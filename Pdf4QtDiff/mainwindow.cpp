@@ -34,6 +34,7 @@
 #include <QDesktopServices>
 #include <QMessageBox>
 #include <QInputDialog>
+#include <QFile>
 #include <QFileDialog>
 #include <QVBoxLayout>
 #include <QActionGroup>
@@ -181,6 +182,8 @@ MainWindow::MainWindow(QWidget* parent) :
 
     m_diff.setLeftDocument(&m_leftDocument);
     m_diff.setRightDocument(&m_rightDocument);
+    m_diff.setLeftFingerprintStore(&m_leftFingerprintStore);
+    m_diff.setRightFingerprintStore(&m_rightFingerprintStore);
 
     m_diffNavigator.setResult(&m_filteredDiffResult);
     connect(&m_diffNavigator, &pdf::PDFDiffResultNavigator::selectionChanged, this, &MainWindow::onSelectionChanged);
@@ -454,10 +457,12 @@ void MainWindow::performOperation(Operation operation)
             pdf::PDFTemporaryValueChange guard(&m_dontDisplayErrorMessage, true);
             m_diff.stop();
 
-            std::optional<pdf::PDFDocument> document = openDocument();
+            pdf::PDFDiffFingerprintStore fingerprintStore;
+            std::optional<pdf::PDFDocument> document = openDocument(&fingerprintStore);
             if (document)
             {
                 clear(true, false);
+                m_leftFingerprintStore = std::move(fingerprintStore);
                 m_leftDocument = std::move(*document);
 
                 const size_t pageCount = m_leftDocument.getCatalog()->getPageCount();
@@ -485,10 +490,12 @@ void MainWindow::performOperation(Operation operation)
             pdf::PDFTemporaryValueChange guard(&m_dontDisplayErrorMessage, true);
             m_diff.stop();
 
-            std::optional<pdf::PDFDocument> document = openDocument();
+            pdf::PDFDiffFingerprintStore fingerprintStore;
+            std::optional<pdf::PDFDocument> document = openDocument(&fingerprintStore);
             if (document)
             {
                 clear(false, true);
+                m_rightFingerprintStore = std::move(fingerprintStore);
                 m_rightDocument = std::move(*document);
 
                 const size_t pageCount = m_rightDocument.getCatalog()->getPageCount();
@@ -827,7 +834,7 @@ void MainWindow::updateOverlayTransparency()
     m_pdfWidget->update();
 }
 
-std::optional<pdf::PDFDocument> MainWindow::openDocument()
+std::optional<pdf::PDFDocument> MainWindow::openDocument(pdf::PDFDiffFingerprintStore* fingerprintStore)
 {
     QString fileName = QFileDialog::getOpenFileName(this, tr("Select PDF document"), m_settings.directory, tr("PDF document (*.pdf)"));
     if (fileName.isEmpty())
@@ -853,6 +860,14 @@ std::optional<pdf::PDFDocument> MainWindow::openDocument()
     pdf::PDFDocumentReader::Result result = reader.getReadingResult();
     if (result == pdf::PDFDocumentReader::Result::OK)
     {
+        // Page fingerprints can be saved next to the document (for example, by PdfTool),
+        // so we do not have to compile and hash pages of the document again.
+        const QString fingerprintStoreFileName = pdf::PDFDiffFingerprintStore::getDefaultFileName(fileName);
+        if (QFile::exists(fingerprintStoreFileName))
+        {
+            fingerprintStore->loadFromFile(fingerprintStoreFileName);
+        }
+
         return document;
     }
     else if (result == pdf::PDFDocumentReader::Result::Failed)
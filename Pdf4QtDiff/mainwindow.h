@@ -119,7 +119,10 @@ private:
     void updateCustomPageLayout();
     void updateOverlayTransparency();
 
-    std::optional<pdf::PDFDocument> openDocument();
+    /// Opens document selected by the user. Fingerprint store of the document
+    /// is loaded from the file next to the document, if it exists.
+    /// \param fingerprintStore Fingerprint store of the document
+    std::optional<pdf::PDFDocument> openDocument(pdf::PDFDiffFingerprintStore* fingerprintStore);
 
     Ui::MainWindow* ui;
 
@@ -142,6 +145,8 @@ private:
 
     pdf::PDFDocument m_leftDocument;
     pdf::PDFDocument m_rightDocument;
+    pdf::PDFDiffFingerprintStore m_leftFingerprintStore;
+    pdf::PDFDiffFingerprintStore m_rightFingerprintStore;
     pdf::PDFDocument m_combinedDocument;
 
     pdf::PDFDiffResult m_diffResult;
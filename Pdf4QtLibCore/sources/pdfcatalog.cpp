@@ -21,6 +21,14 @@
 #include "pdfnumbertreeloader.h"
 #include "pdfnametreeloader.h"
 #include "pdfencoding.h"
+
+#include <QMutex>
+
+#include <set>
+#include <deque>
+#include <atomic>
+#include <optional>
+
 #include "pdfdbgheap.h"
 
 namespace pdf
@@ -59,109 +67,763 @@ static constexpr const char* PDF_VIEWER_PREFERENCES_PICK_TRAY_BY_PDF_SIZE = "Pic
 static constexpr const char* PDF_VIEWER_PREFERENCES_NUMBER_OF_COPIES = "NumCopies";
 static constexpr const char* PDF_VIEWER_PREFERENCES_PRINT_PAGE_RANGE = "PrintPageRange";
 
-size_t PDFCatalog::getPageIndexFromPageReference(PDFObjectReference reference) const
+/// Page tree, from which pages are resolved on demand. Page is found by descending
+/// the page tree using /Count entries of the page tree nodes, so only nodes on the path
+/// from the root to the page are read. Resolved pages are never released (pointers
+/// to them must remain valid), page tree nodes (including inherited attributes) are cached.
+/// Lazy page tree can be used only for page trees, which are consistent (see \p isPageTreeValid),
+/// so each page index below page count can be found. Pages itself are not checked, so parsing
+/// of the page can fail - such page is then reported as nonexisting (nullptr is returned).
+class PDFLazyPageTree
 {
-    auto it = std::find_if(m_pages.cbegin(), m_pages.cend(), [reference](const PDFPage& page) { return page.getPageReference() == reference; });
-    if (it != m_pages.cend())
+public:
+    explicit PDFLazyPageTree(PDFObjectStorage storage, PDFObject root, size_t pageCount);
+
+    /// Returns page count stored in the root of the page tree. If page tree
+    /// doesn't have valid page count, then zero is returned.
+    /// \param storage Storage
+    /// \param root Root of the page tree
+    static size_t getPageTreeCount(const PDFObjectStorage* storage, const PDFObject& root);
+
+    /// Checks the structure of the page tree, i.e. that kids of each page tree
+    /// node are valid pages or page tree nodes, that /Count entries of the nodes
+    /// are sum of page counts of their kids and that the tree doesn't contain cycles.
+    /// Pages itself are not parsed, so this is much faster than parsing of the whole
+    /// page tree. If the check passes, each page can be resolved lazily.
+    /// \param storage Storage
+    /// \param root Root of the page tree
+    /// \param pageCount Page count of the root
+    static bool isPageTreeValid(const PDFObjectStorage* storage, const PDFObject& root, size_t pageCount);
+
+    /// Returns page count
+    size_t getPageCount();
+
+    /// Returns page with given index. If page doesn't exist, or it
+    /// can't be parsed, then nullptr is returned. Already resolved
+    /// pages are returned without locking the mutex.
+    /// \param index Page index
+    const PDFPage* getPage(size_t index);
+
+    /// Returns index of the page. Page is found by walking up
+    /// the page tree using /Parent entries.
+    /// \param reference Page reference
+    size_t getPageIndexFromPageReference(PDFObjectReference reference);
+
+private:
+    static constexpr size_t NODE_CACHE_LIMIT = 1024;
+    static constexpr size_t MAX_TREE_DEPTH = 256;
+
+    struct Kid
     {
-        return std::distance(m_pages.cbegin(), it);
+        PDFObject object;
+        size_t firstPageIndex = 0;
+        size_t pageCount = 0;
+        bool isPage = false;
+    };
+
+    struct Node
+    {
+        PDFPageInheritableAttributes attributes;
+        std::vector<Kid> kids;
+    };
+
+    using NodePointer = std::shared_ptr<const Node>;
+
+    /// Returns page tree node from the cache, or reads it. If node is invalid,
+    /// then exception is thrown.
+    /// \param object Page tree node
+    /// \param parentAttributes Inheritable attributes of the parent node
+    /// \param pageCount Expected page count of the node
+    NodePointer getNode(const PDFObject& object, const PDFPageInheritableAttributes& parentAttributes, size_t pageCount);
+
+    /// Returns page count of the page tree node kid, or throws exception,
+    /// if kid is not valid page tree node or page.
+    /// \param storage Storage
+    /// \param kid Kid object
+    /// \param isPage Is kid a page?
+    static size_t getKidPageCount(const PDFObjectStorage* storage, const PDFObject& kid, bool& isPage);
+
+    /// Checks page tree node and its descendants, throws exception, if node is not valid.
+    /// \param storage Storage
+    /// \param object Page tree node
+    /// \param pageCount Expected page count of the node
+    /// \param visitedReferences Visited page tree nodes (to detect cycles)
+    /// \param depth Depth of the node
+    static void checkNode(const PDFObjectStorage* storage,
+                          const PDFObject& object,
+                          size_t pageCount,
+                          std::set<PDFObjectReference>& visitedReferences,
+                          size_t depth);
+
+    /// Resolves page with given index. Mutex must be locked. If page tree
+    /// node can't be read, then exception is thrown.
+    const PDFPage* resolvePage(size_t index);
+
+    /// Returns page with given index, or nullptr, if page doesn't exist
+    /// or it can't be resolved. Mutex must be locked.
+    const PDFPage* getPageImpl(size_t index);
+
+    /// Parses page and stores it. If page is invalid, then it is
+    /// marked as invalid and nullptr is returned. Mutex must be locked.
+    const PDFPage* parsePage(size_t index, const PDFPageInheritableAttributes& attributes, const PDFObject& object);
+
+    QMutex m_mutex;
+    PDFObjectStorage m_storage;
+    PDFObject m_root;
+    size_t m_pageCount;
+
+    /// Resolved pages (nullptr, if page was not yet resolved). Pointers
+    /// are written only under the mutex, but can be read without it.
+    std::vector<std::atomic<const PDFPage*>> m_pages;
+
+    /// Pages, which failed to resolve (they are not resolved again)
+    std::vector<bool> m_invalidPages;
+
+    /// Storage of resolved pages
+    std::deque<PDFPage> m_resolvedPages;
+
+    /// Cache of page tree nodes
+    std::map<PDFObjectReference, NodePointer> m_nodeCache;
+};
+
+PDFLazyPageTree::PDFLazyPageTree(PDFObjectStorage storage, PDFObject root, size_t pageCount) :
+    m_storage(qMove(storage)),
+    m_root(qMove(root)),
+    m_pageCount(pageCount),
+    m_pages(pageCount),
+    m_invalidPages(pageCount, false)
+{
+
+}
+
+size_t PDFLazyPageTree::getPageTreeCount(const PDFObjectStorage* storage, const PDFObject& root)
+{
+    if (const PDFDictionary* dictionary = storage->getDictionaryFromObject(root))
+    {
+        // Each page is an indirect object, so page count can't be greater
+        // than object count (otherwise /Count entry is damaged).
+        const PDFObject& countObject = storage->getObject(dictionary->get("Count"));
+        if (countObject.isInt() && countObject.getInteger() > 0 && static_cast<size_t>(countObject.getInteger()) <= storage->getObjects().size())
+        {
+            return static_cast<size_t>(countObject.getInteger());
+        }
     }
 
-    return INVALID_PAGE_INDEX;
+    return 0;
 }
 
-const PDFDestination* PDFCatalog::getNamedDestination(const QByteArray& key) const
+bool PDFLazyPageTree::isPageTreeValid(const PDFObjectStorage* storage, const PDFObject& root, size_t pageCount)
 {
-    auto it = m_namedDestinations.find(key);
-    if (it != m_namedDestinations.cend())
+    try
     {
-        return &it->second;
+        bool isPage = false;
+        if (getKidPageCount(storage, root, isPage) != pageCount || isPage)
+        {
+            return false;
+        }
+
+        std::set<PDFObjectReference> visitedReferences = { root.getReference() };
+        checkNode(storage, root, pageCount, visitedReferences, 0);
+        return true;
+    }
+    catch (const PDFException&)
+    {
+        return false;
     }
+}
 
-    return nullptr;
+void PDFLazyPageTree::checkNode(const PDFObjectStorage* storage,
+                                const PDFObject& object,
+                                size_t pageCount,
+                                std::set<PDFObjectReference>& visitedReferences,
+                                size_t depth)
+{
+    if (depth >= MAX_TREE_DEPTH)
+    {
+        throw PDFException(PDFTranslationContext::tr("Detected cycles in page tree."));
+    }
+
+    const PDFDictionary* dictionary = storage->getDictionaryFromObject(object);
+    const PDFObject& kids = dictionary ? storage->getObject(dictionary->get("Kids")) : PDFObject();
+    if (!kids.isArray())
+    {
+        throw PDFException(PDFTranslationContext::tr("Expected valid kids in page tree."));
+    }
+
+    size_t kidsPageCount = 0;
+    const PDFArray* kidsArray = kids.getArray();
+    for (size_t i = 0, count = kidsArray->getCount(); i < count; ++i)
+    {
+        const PDFObject& kid = kidsArray->getItem(i);
+
+        bool isPage = false;
+        const size_t kidPageCount = getKidPageCount(storage, kid, isPage);
+
+        if (!visitedReferences.insert(kid.getReference()).second)
+        {
+            throw PDFException(PDFTranslationContext::tr("Detected cycles in page tree."));
+        }
+
+        if (!isPage)
+        {
+            checkNode(storage, kid, kidPageCount, visitedReferences, depth + 1);
+        }
+
+        kidsPageCount += kidPageCount;
+    }
+
+    if (kidsPageCount != pageCount)
+    {
+        throw PDFException(PDFTranslationContext::tr("Invalid page count in page tree."));
+    }
 }
 
-PDFActionPtr PDFCatalog::getNamedJavaScriptAction(const QByteArray& key) const
+size_t PDFLazyPageTree::getPageCount()
 {
-    auto it = m_namedJavaScriptActions.find(key);
-    if (it != m_namedJavaScriptActions.cend())
+    return m_pageCount;
+}
+
+const PDFPage* PDFLazyPageTree::getPage(size_t index)
+{
+    if (index >= m_pageCount)
     {
-        return it->second;
+        return nullptr;
     }
 
-    return nullptr;
+    // Resolved page never changes, so we can return it without locking
+    if (const PDFPage* page = m_pages[index].load(std::memory_order_acquire))
+    {
+        return page;
+    }
+
+    QMutexLocker lock(&m_mutex);
+    return getPageImpl(index);
 }
 
-PDFObject PDFCatalog::getNamedAppearanceStream(const QByteArray& key) const
+const PDFPage* PDFLazyPageTree::getPageImpl(size_t index)
 {
-    auto it = m_namedAppearanceStreams.find(key);
-    if (it != m_namedAppearanceStreams.cend())
+    if (index >= m_pageCount)
     {
-        return it->second;
+        return nullptr;
     }
 
-    return PDFObject();
+    if (const PDFPage* page = m_pages[index].load(std::memory_order_relaxed))
+    {
+        return page;
+    }
+
+    if (m_invalidPages[index])
+    {
+        return nullptr;
+    }
+
+    // Structure of the page tree was checked before the lazy page tree was created,
+    // but page tree nodes and pages itself can still be invalid (for example, they
+    // can have invalid inheritable attributes).
+    try
+    {
+        return resolvePage(index);
+    }
+    catch (const PDFException&)
+    {
+        m_invalidPages[index] = true;
+        return nullptr;
+    }
 }
 
-PDFObject PDFCatalog::getNamedPage(const QByteArray& key) const
+const PDFPage* PDFLazyPageTree::parsePage(size_t index, const PDFPageInheritableAttributes& attributes, const PDFObject& object)
 {
-    auto it = m_namedPages.find(key);
-    if (it != m_namedPages.cend())
+    try
     {
-        return it->second;
+        m_resolvedPages.emplace_back(PDFPage::parsePage(&m_storage, attributes, object));
+    }
+    catch (const PDFException&)
+    {
+        m_invalidPages[index] = true;
+        return nullptr;
     }
 
-    return PDFObject();
+    const PDFPage* page = &m_resolvedPages.back();
+    m_pages[index].store(page, std::memory_order_release);
+    return page;
 }
 
-PDFObject PDFCatalog::getNamedTemplate(const QByteArray& key) const
+size_t PDFLazyPageTree::getKidPageCount(const PDFObjectStorage* storage, const PDFObject& kid, bool& isPage)
 {
-    auto it = m_namedTemplates.find(key);
-    if (it != m_namedTemplates.cend())
+    if (!kid.isReference())
     {
-        return it->second;
+        throw PDFException(PDFTranslationContext::tr("Expected valid kids in page tree."));
     }
 
-    return PDFObject();
+    const PDFDictionary* dictionary = storage->getDictionaryFromObject(kid);
+    if (!dictionary)
+    {
+        throw PDFException(PDFTranslationContext::tr("Expected dictionary in page tree."));
+    }
+
+    const PDFObject& typeObject = storage->getObject(dictionary->get("Type"));
+    if (typeObject.isName())
+    {
+        QByteArray typeString = typeObject.getString();
+        if (typeString == "Page")
+        {
+            isPage = true;
+            return 1;
+        }
+        else if (typeString == "Pages")
+        {
+            const PDFObject& countObject = storage->getObject(dictionary->get("Count"));
+            if (countObject.isInt() && countObject.getInteger() >= 0)
+            {
+                isPage = false;
+                return static_cast<size_t>(countObject.getInteger());
+            }
+
+            throw PDFException(PDFTranslationContext::tr("Invalid page count in page tree."));
+        }
+    }
+
+    throw PDFException(PDFTranslationContext::tr("Expected valid type item in page tree."));
 }
 
-PDFObject PDFCatalog::getNamedDigitalIdentifier(const QByteArray& key) const
+PDFLazyPageTree::NodePointer PDFLazyPageTree::getNode(const PDFObject& object, const PDFPageInheritableAttributes& parentAttributes, size_t pageCount)
 {
-    auto it = m_namedDigitalIdentifiers.find(key);
-    if (it != m_namedDigitalIdentifiers.cend())
+    const PDFObjectReference reference = object.isReference() ? object.getReference() : PDFObjectReference();
+
+    auto it = m_nodeCache.find(reference);
+    if (it != m_nodeCache.cend())
     {
         return it->second;
     }
 
-    return PDFObject();
+    const PDFDictionary* dictionary = m_storage.getDictionaryFromObject(object);
+    if (!dictionary)
+    {
+        throw PDFException(PDFTranslationContext::tr("Expected dictionary in page tree."));
+    }
+
+    const PDFObject& kids = m_storage.getObject(dictionary->get("Kids"));
+    if (!kids.isArray())
+    {
+        throw PDFException(PDFTranslationContext::tr("Expected valid kids in page tree."));
+    }
+
+    std::shared_ptr<Node> node = std::make_shared<Node>();
+    node->attributes = PDFPageInheritableAttributes::parse(parentAttributes, object, &m_storage);
+
+    const PDFArray* kidsArray = kids.getArray();
+    const size_t count = kidsArray->getCount();
+    node->kids.reserve(count);
+
+    size_t firstPageIndex = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Kid kid;
+        kid.object = kidsArray->getItem(i);
+        kid.firstPageIndex = firstPageIndex;
+        kid.pageCount = getKidPageCount(&m_storage, kid.object, kid.isPage);
+        firstPageIndex += kid.pageCount;
+        node->kids.emplace_back(qMove(kid));
+    }
+
+    if (firstPageIndex != pageCount)
+    {
+        throw PDFException(PDFTranslationContext::tr("Invalid page count in page tree."));
+    }
+
+    if (m_nodeCache.size() >= NODE_CACHE_LIMIT)
+    {
+        m_nodeCache.clear();
+    }
+
+    m_nodeCache[reference] = node;
+    return node;
 }
 
-PDFObject PDFCatalog::getNamedUrl(const QByteArray& key) const
+const PDFPage* PDFLazyPageTree::resolvePage(size_t index)
 {
-    auto it = m_namedUniformResourceLocators.find(key);
-    if (it != m_namedUniformResourceLocators.cend())
+    NodePointer node = getNode(m_root, PDFPageInheritableAttributes(), m_pageCount);
+
+    // Index of the first page of the current node
+    size_t nodeFirstPageIndex = 0;
+
+    for (size_t depth = 0; depth < MAX_TREE_DEPTH; ++depth)
     {
-        return it->second;
+        const size_t localIndex = index - nodeFirstPageIndex;
+        auto it = std::upper_bound(node->kids.cbegin(), node->kids.cend(), localIndex, [](size_t value, const Kid& kid) { return value < kid.firstPageIndex; });
+        if (it == node->kids.cbegin())
+        {
+            throw PDFException(PDFTranslationContext::tr("Invalid page count in page tree."));
+        }
+
+        const Kid& kid = *std::prev(it);
+        if (localIndex >= kid.firstPageIndex + kid.pageCount)
+        {
+            throw PDFException(PDFTranslationContext::tr("Invalid page count in page tree."));
+        }
+
+        if (kid.isPage)
+        {
+            // Resolve all pages of this node at once, because it is very
+            // probable, that neighbouring pages will be accessed too.
+            for (const Kid& pageKid : node->kids)
+            {
+                const size_t pageIndex = nodeFirstPageIndex + pageKid.firstPageIndex;
+                if (pageKid.isPage && !m_pages[pageIndex].load(std::memory_order_relaxed) && !m_invalidPages[pageIndex])
+                {
+                    parsePage(pageIndex, node->attributes, pageKid.object);
+                }
+            }
+
+            return m_pages[index].load(std::memory_order_relaxed);
+        }
+
+        nodeFirstPageIndex += kid.firstPageIndex;
+        node = getNode(kid.object, node->attributes, kid.pageCount);
     }
 
-    return PDFObject();
+    throw PDFException(PDFTranslationContext::tr("Detected cycles in page tree."));
 }
 
-PDFObject PDFCatalog::getNamedAlternateRepresentation(const QByteArray& key) const
+size_t PDFLazyPageTree::getPageIndexFromPageReference(PDFObjectReference reference)
+{
+    QMutexLocker lock(&m_mutex);
+
+    try
+    {
+        // Walk up the page tree and sum page counts of the preceding kids
+        size_t index = 0;
+        PDFObjectReference current = reference;
+        for (size_t depth = 0; depth < MAX_TREE_DEPTH; ++depth)
+        {
+            const PDFDictionary* dictionary = m_storage.getDictionaryFromObject(m_storage.getObjectByReference(current));
+            if (!dictionary)
+            {
+                return PDFCatalog::INVALID_PAGE_INDEX;
+            }
+
+            const PDFObject& parent = dictionary->get("Parent");
+            if (!parent.isReference())
+            {
+                break;
+            }
+
+            const PDFDictionary* parentDictionary = m_storage.getDictionaryFromObject(parent);
+            const PDFObject& kids = parentDictionary ? m_storage.getObject(parentDictionary->get("Kids")) : PDFObject();
+            if (!kids.isArray())
+            {
+                return PDFCatalog::INVALID_PAGE_INDEX;
+            }
+
+            bool found = false;
+            const PDFArray* kidsArray = kids.getArray();
+            for (size_t i = 0, count = kidsArray->getCount(); i < count; ++i)
+            {
+                const PDFObject& kid = kidsArray->getItem(i);
+                if (kid.isReference() && kid.getReference() == current)
+                {
+                    found = true;
+                    break;
+                }
+
+                bool isPage = false;
+                index += getKidPageCount(&m_storage, kid, isPage);
+            }
+
+            if (!found)
+            {
+                return PDFCatalog::INVALID_PAGE_INDEX;
+            }
+
+            current = parent.getReference();
+        }
+
+        // Verify, that we have found the right page
+        const PDFPage* page = getPageImpl(index);
+        if (page && page->getPageReference() == reference)
+        {
+            return index;
+        }
+
+        return PDFCatalog::INVALID_PAGE_INDEX;
+    }
+    catch (const PDFException&)
+    {
+        // /Parent entries are inconsistent with the page tree, fall back to search in all pages
+    }
+
+    for (size_t i = 0; i < m_pageCount; ++i)
+    {
+        const PDFPage* page = getPageImpl(i);
+        if (page && page->getPageReference() == reference)
+        {
+            return i;
+        }
+    }
+
+    return PDFCatalog::INVALID_PAGE_INDEX;
+}
+
+/// Parts of the catalog, which are loaded on demand, when they are queried
+/// for the first time (outline, page labels and name trees). If some part can't
+/// be loaded, it is treated as empty.
+class PDFCatalogLazyData
+{
+public:
+    explicit PDFCatalogLazyData() = default;
+    explicit PDFCatalogLazyData(PDFObjectStorage storage, PDFObject outlines, PDFObject pageLabels, PDFObject names, PDFObject dests) :
+        m_storage(qMove(storage)),
+        m_outlines(qMove(outlines)),
+        m_pageLabels(qMove(pageLabels)),
+        m_names(qMove(names)),
+        m_dests(qMove(dests))
+    {
+
+    }
+
+    QSharedPointer<PDFOutlineItem> getOutlineRoot();
+    const std::vector<PDFPageLabel>& getPageLabels();
+    const std::map<QByteArray, PDFDestination>& getNamedDestinations();
+    const std::map<QByteArray, PDFObject>& getNamedAppearanceStreams() { return loadObjectNameTree(m_namedAppearanceStreams, "AP"); }
+    const std::map<QByteArray, PDFActionPtr>& getNamedJavaScriptActions();
+    const std::map<QByteArray, PDFObject>& getNamedPages() { return loadObjectNameTree(m_namedPages, "Pages"); }
+    const std::map<QByteArray, PDFObject>& getNamedTemplates() { return loadObjectNameTree(m_namedTemplates, "Templates"); }
+    const std::map<QByteArray, PDFObject>& getNamedDigitalIdentifiers() { return loadObjectNameTree(m_namedDigitalIdentifiers, "IDS"); }
+    const std::map<QByteArray, PDFObject>& getNamedUniformResourceLocators() { return loadObjectNameTree(m_namedUniformResourceLocators, "URLS"); }
+    const std::map<QByteArray, PDFFileSpecification>& getNamedEmbeddedFiles();
+    const std::map<QByteArray, PDFObject>& getNamedAlternateRepresentations() { return loadObjectNameTree(m_namedAlternateRepresentations, "AlternatePresentations"); }
+    const std::map<QByteArray, PDFObject>& getNamedRenditions() { return loadObjectNameTree(m_namedRenditions, "Renditions"); }
+
+private:
+    /// Loads value using the function, if it is not already loaded
+    template<typename T, typename Function>
+    const T& load(std::optional<T>& value, Function function)
+    {
+        QMutexLocker lock(&m_mutex);
+        if (!value)
+        {
+            try
+            {
+                value = function();
+            }
+            catch (const PDFException&)
+            {
+                value = T();
+            }
+        }
+
+        return *value;
+    }
+
+    /// Loads name tree from Names dictionary
+    template<typename T>
+    const std::map<QByteArray, T>& loadNameTree(std::optional<std::map<QByteArray, T>>& value,
+                                                const char* key,
+                                                const typename PDFNameTreeLoader<T>::LoadMethod& loadMethod)
+    {
+        return load(value, [this, key, &loadMethod]()
+        {
+            std::map<QByteArray, T> result;
+            if (const PDFDictionary* namesDictionary = m_storage.getDictionaryFromObject(m_names))
+            {
+                result = PDFNameTreeLoader<T>::parse(&m_storage, namesDictionary->get(key), loadMethod);
+            }
+            return result;
+        });
+    }
+
+    /// Loads name tree of objects from Names dictionary
+    const std::map<QByteArray, PDFObject>& loadObjectNameTree(std::optional<std::map<QByteArray, PDFObject>>& value, const char* key)
+    {
+        return loadNameTree<PDFObject>(value, key, [](const PDFObjectStorage*, PDFObject object) { return object; });
+    }
+
+    QMutex m_mutex;
+    PDFObjectStorage m_storage;
+    PDFObject m_outlines;
+    PDFObject m_pageLabels;
+    PDFObject m_names;
+    PDFObject m_dests;
+
+    std::optional<QSharedPointer<PDFOutlineItem>> m_outlineRoot;
+    std::optional<std::vector<PDFPageLabel>> m_pageLabelsList;
+    std::optional<std::map<QByteArray, PDFDestination>> m_namedDestinations;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedAppearanceStreams;
+    std::optional<std::map<QByteArray, PDFActionPtr>> m_namedJavaScriptActions;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedPages;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedTemplates;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedDigitalIdentifiers;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedUniformResourceLocators;
+    std::optional<std::map<QByteArray, PDFFileSpecification>> m_namedEmbeddedFiles;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedAlternateRepresentations;
+    std::optional<std::map<QByteArray, PDFObject>> m_namedRenditions;
+};
+
+QSharedPointer<PDFOutlineItem> PDFCatalogLazyData::getOutlineRoot()
+{
+    return load(m_outlineRoot, [this]()
+    {
+        QSharedPointer<PDFOutlineItem> outlineRoot;
+        if (!m_outlines.isNull())
+        {
+            outlineRoot = PDFOutlineItem::parse(&m_storage, m_outlines);
+        }
+        return outlineRoot;
+    });
+}
+
+const std::vector<PDFPageLabel>& PDFCatalogLazyData::getPageLabels()
 {
-    auto it = m_namedAlternateRepresentations.find(key);
-    if (it != m_namedAlternateRepresentations.cend())
+    return load(m_pageLabelsList, [this]() { return PDFNumberTreeLoader<PDFPageLabel>::parse(&m_storage, m_pageLabels); });
+}
+
+const std::map<QByteArray, PDFDestination>& PDFCatalogLazyData::getNamedDestinations()
+{
+    return load(m_namedDestinations, [this]()
+    {
+        std::map<QByteArray, PDFDestination> result;
+
+        if (const PDFDictionary* namesDictionary = m_storage.getDictionaryFromObject(m_names))
+        {
+            auto parseDestination = [](const PDFObjectStorage* storage, PDFObject object)
+            {
+                object = storage->getObject(object);
+                if (object.isDictionary())
+                {
+                    object = object.getDictionary()->get("D");
+                }
+
+                return PDFDestination::parse(storage, qMove(object));
+            };
+
+            result = PDFNameTreeLoader<PDFDestination>::parse(&m_storage, namesDictionary->get("Dests"), parseDestination);
+        }
+
+        // Examine "Dests" dictionary
+        if (const PDFDictionary* destsDictionary = m_storage.getDictionaryFromObject(m_dests))
+        {
+            const size_t count = destsDictionary->getCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[destsDictionary->getKey(i).getString()] = PDFDestination::parse(&m_storage, destsDictionary->getValue(i));
+            }
+        }
+
+        return result;
+    });
+}
+
+const std::map<QByteArray, PDFActionPtr>& PDFCatalogLazyData::getNamedJavaScriptActions()
+{
+    return loadNameTree<PDFActionPtr>(m_namedJavaScriptActions, "JavaScript", &PDFAction::parse);
+}
+
+const std::map<QByteArray, PDFFileSpecification>& PDFCatalogLazyData::getNamedEmbeddedFiles()
+{
+    return loadNameTree<PDFFileSpecification>(m_namedEmbeddedFiles, "EmbeddedFiles", &PDFFileSpecification::parse);
+}
+
+PDFCatalogLazyData* PDFCatalog::getLazyData() const
+{
+    if (m_lazyData)
+    {
+        return m_lazyData.data();
+    }
+
+    static PDFCatalogLazyData dummy;
+    return &dummy;
+}
+
+size_t PDFCatalog::getPageCount() const
+{
+    if (m_lazyPageTree)
+    {
+        return m_lazyPageTree->getPageCount();
+    }
+
+    return m_pages.size();
+}
+
+const PDFPage* PDFCatalog::getPage(size_t index) const
+{
+    if (m_lazyPageTree)
+    {
+        return m_lazyPageTree->getPage(index);
+    }
+
+    return index < m_pages.size() ? &m_pages[index] : nullptr;
+}
+
+size_t PDFCatalog::getPageIndexFromPageReference(PDFObjectReference reference) const
+{
+    if (m_lazyPageTree)
+    {
+        return m_lazyPageTree->getPageIndexFromPageReference(reference);
+    }
+
+    auto it = std::find_if(m_pages.cbegin(), m_pages.cend(), [reference](const PDFPage& page) { return page.getPageReference() == reference; });
+    if (it != m_pages.cend())
+    {
+        return std::distance(m_pages.cbegin(), it);
+    }
+
+    return INVALID_PAGE_INDEX;
+}
+
+QSharedPointer<PDFOutlineItem> PDFCatalog::getOutlineRootPtr() const
+{
+    return getLazyData()->getOutlineRoot();
+}
+
+const std::vector<PDFPageLabel>& PDFCatalog::getPageLabels() const
+{
+    return getLazyData()->getPageLabels();
+}
+
+const std::map<QByteArray, PDFFileSpecification>& PDFCatalog::getEmbeddedFiles() const
+{
+    return getLazyData()->getNamedEmbeddedFiles();
+}
+
+const std::map<QByteArray, PDFDestination>& PDFCatalog::getNamedDestinations() const
+{
+    return getLazyData()->getNamedDestinations();
+}
+
+const std::map<QByteArray, PDFActionPtr>& PDFCatalog::getNamedJavaScriptActions() const
+{
+    return getLazyData()->getNamedJavaScriptActions();
+}
+
+const PDFDestination* PDFCatalog::getNamedDestination(const QByteArray& key) const
+{
+    const std::map<QByteArray, PDFDestination>& namedDestinations = getNamedDestinations();
+    auto it = namedDestinations.find(key);
+    if (it != namedDestinations.cend())
+    {
+        return &it->second;
+    }
+
+    return nullptr;
+}
+
+PDFActionPtr PDFCatalog::getNamedJavaScriptAction(const QByteArray& key) const
+{
+    const std::map<QByteArray, PDFActionPtr>& namedJavaScriptActions = getNamedJavaScriptActions();
+    auto it = namedJavaScriptActions.find(key);
+    if (it != namedJavaScriptActions.cend())
     {
         return it->second;
     }
 
-    return PDFObject();
+    return nullptr;
 }
 
-PDFObject PDFCatalog::getNamedRendition(const QByteArray& key) const
+/// Finds object in the map, if it is not found, then null object is returned
+static PDFObject getNamedObject(const std::map<QByteArray, PDFObject>& map, const QByteArray& key)
 {
-    auto it = m_namedRenditions.find(key);
-    if (it != m_namedRenditions.cend())
+    auto it = map.find(key);
+    if (it != map.cend())
     {
         return it->second;
     }
@@ -169,6 +831,41 @@ PDFObject PDFCatalog::getNamedRendition(const QByteArray& key) const
     return PDFObject();
 }
 
+PDFObject PDFCatalog::getNamedAppearanceStream(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedAppearanceStreams(), key);
+}
+
+PDFObject PDFCatalog::getNamedPage(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedPages(), key);
+}
+
+PDFObject PDFCatalog::getNamedTemplate(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedTemplates(), key);
+}
+
+PDFObject PDFCatalog::getNamedDigitalIdentifier(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedDigitalIdentifiers(), key);
+}
+
+PDFObject PDFCatalog::getNamedUrl(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedUniformResourceLocators(), key);
+}
+
+PDFObject PDFCatalog::getNamedAlternateRepresentation(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedAlternateRepresentations(), key);
+}
+
+PDFObject PDFCatalog::getNamedRendition(const QByteArray& key) const
+{
+    return getNamedObject(getLazyData()->getNamedRenditions(), key);
+}
+
 PDFCatalog PDFCatalog::parse(const PDFObject& catalog, const PDFDocument* document)
 {
     if (!catalog.isDictionary())
@@ -181,17 +878,27 @@ PDFCatalog PDFCatalog::parse(const PDFObject& catalog, const PDFDocument* docume
 
     PDFCatalog catalogObject;
     catalogObject.m_viewerPreferences = PDFViewerPreferences::parse(catalog, document);
-    catalogObject.m_pages = PDFPage::parse(&document->getStorage(), catalogDictionary->get("Pages"));
-    catalogObject.m_pageLabels = PDFNumberTreeLoader<PDFPageLabel>::parse(&document->getStorage(), catalogDictionary->get("PageLabels"));
 
-    if (catalogDictionary->hasKey("OCProperties"))
+    const PDFObject& pagesRoot = catalogDictionary->get("Pages");
+    const size_t pageTreeCount = PDFLazyPageTree::getPageTreeCount(&document->getStorage(), pagesRoot);
+    if (pageTreeCount >= LAZY_PAGE_TREE_THRESHOLD && PDFLazyPageTree::isPageTreeValid(&document->getStorage(), pagesRoot, pageTreeCount))
     {
-        catalogObject.m_optionalContentProperties = PDFOptionalContentProperties::create(document, catalogDictionary->get("OCProperties"));
+        catalogObject.m_lazyPageTree.reset(new PDFLazyPageTree(document->getStorage(), pagesRoot, pageTreeCount));
     }
+    else
+    {
+        catalogObject.m_pages = PDFPage::parse(&document->getStorage(), pagesRoot);
+    }
+
+    catalogObject.m_lazyData.reset(new PDFCatalogLazyData(document->getStorage(),
+                                                          catalogDictionary->get("Outlines"),
+                                                          catalogDictionary->get("PageLabels"),
+                                                          catalogDictionary->get("Names"),
+                                                          catalogDictionary->get("Dests")));
 
-    if (catalogDictionary->hasKey("Outlines"))
+    if (catalogDictionary->hasKey("OCProperties"))
     {
-        catalogObject.m_outlineRoot = PDFOutlineItem::parse(&document->getStorage(), catalogDictionary->get("Outlines"));
+        catalogObject.m_optionalContentProperties = PDFOptionalContentProperties::create(document, catalogDictionary->get("OCProperties"));
     }
 
     if (catalogDictionary->hasKey("OpenAction"))
@@ -247,46 +954,6 @@ PDFCatalog PDFCatalog::parse(const PDFObject& catalog, const PDFDocument* docume
 
     catalogObject.m_version = loader.readNameFromDictionary(catalogDictionary, "Version");
 
-    if (const PDFDictionary* namesDictionary = document->getDictionaryFromObject(catalogDictionary->get("Names")))
-    {
-        auto parseDestination = [](const PDFObjectStorage* storage, PDFObject object)
-        {
-            object = storage->getObject(object);
-            if (object.isDictionary())
-            {
-                object = object.getDictionary()->get("D");
-            }
-
-            return PDFDestination::parse(storage, qMove(object));
-        };
-
-        auto getObject = [](const PDFObjectStorage*, PDFObject object)
-        {
-            return object;
-        };
-
-        catalogObject.m_namedDestinations = PDFNameTreeLoader<PDFDestination>::parse(&document->getStorage(), namesDictionary->get("Dests"), parseDestination);
-        catalogObject.m_namedAppearanceStreams = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("AP"), getObject);
-        catalogObject.m_namedJavaScriptActions = PDFNameTreeLoader<PDFActionPtr>::parse(&document->getStorage(), namesDictionary->get("JavaScript"), &PDFAction::parse);
-        catalogObject.m_namedPages = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("Pages"), getObject);
-        catalogObject.m_namedTemplates = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("Templates"), getObject);
-        catalogObject.m_namedDigitalIdentifiers = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("IDS"), getObject);
-        catalogObject.m_namedUniformResourceLocators = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("URLS"), getObject);
-        catalogObject.m_namedEmbeddedFiles = PDFNameTreeLoader<PDFFileSpecification>::parse(&document->getStorage(), namesDictionary->get("EmbeddedFiles"), &PDFFileSpecification::parse);
-        catalogObject.m_namedAlternateRepresentations = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("AlternatePresentations"), getObject);
-        catalogObject.m_namedRenditions = PDFNameTreeLoader<PDFObject>::parse(&document->getStorage(), namesDictionary->get("Renditions"), getObject);
-    }
-
-    // Examine "Dests" dictionary
-    if (const PDFDictionary* destsDictionary = document->getDictionaryFromObject(catalogDictionary->get("Dests")))
-    {
-        const size_t count = destsDictionary->getCount();
-        for (size_t i = 0; i < count; ++i)
-        {
-            catalogObject.m_namedDestinations[destsDictionary->getKey(i).getString()] = PDFDestination::parse(&document->getStorage(), destsDictionary->getValue(i));
-        }
-    }
-
     // Examine "URI" dictionary
     if (const PDFDictionary* URIDictionary = document->getDictionaryFromObject(catalogDictionary->get("URI")))
     {
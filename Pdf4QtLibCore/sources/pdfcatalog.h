@@ -32,6 +32,8 @@ namespace pdf
 {
 
 class PDFDocument;
+class PDFLazyPageTree;
+class PDFCatalogLazyData;
 
 /// Defines page layout. Default value is SinglePage. This enum specifies the page layout
 /// to be used in viewer application.
@@ -575,6 +577,10 @@ public:
 
     static constexpr const size_t INVALID_PAGE_INDEX = std::numeric_limits<size_t>::max();
 
+    /// If document has at least this count of pages (and its page tree is consistent),
+    /// then page tree is not parsed when catalog is parsed, but pages are resolved on demand.
+    static constexpr const size_t LAZY_PAGE_TREE_THRESHOLD = 5000;
+
     enum DocumentAction
     {
         WillClose,
@@ -589,10 +595,16 @@ public:
     const PDFViewerPreferences* getViewerPreferences() const { return &m_viewerPreferences; }
 
     /// Returns the page count
-    size_t getPageCount() const { return m_pages.size(); }
+    size_t getPageCount() const;
+
+    /// Returns the page. If page tree is loaded lazily, then page is resolved
+    /// when it is accessed for the first time. Returned pointer remains valid
+    /// for the lifetime of the catalog. If index is out of range,
+    /// then nullptr is returned.
+    const PDFPage* getPage(size_t index) const;
 
-    /// Returns the page
-    const PDFPage* getPage(size_t index) const { return &m_pages.at(index); }
+    /// Returns true, if pages are resolved on demand
+    bool isPageTreeLazy() const { return !m_lazyPageTree.isNull(); }
 
     /// Returns page index. If page is not found, then INVALID_PAGE_INDEX is returned.
     size_t getPageIndexFromPageReference(PDFObjectReference reference) const;
@@ -600,8 +612,13 @@ public:
     /// Returns optional content properties
     const PDFOptionalContentProperties* getOptionalContentProperties() const { return &m_optionalContentProperties; }
 
-    /// Returns root pointer for outline items
-    QSharedPointer<PDFOutlineItem> getOutlineRootPtr() const { return m_outlineRoot; }
+    /// Returns root pointer for outline items. Outline is loaded,
+    /// when it is queried for the first time.
+    QSharedPointer<PDFOutlineItem> getOutlineRootPtr() const;
+
+    /// Returns page labels. Page labels are loaded, when
+    /// they are queried for the first time.
+    const std::vector<PDFPageLabel>& getPageLabels() const;
 
     /// Returns action, which should be performed
     const PDFAction* getOpenAction() const { return m_openAction.data(); }
@@ -612,7 +629,7 @@ public:
     PageLayout getPageLayout() const { return m_pageLayout; }
     PageMode getPageMode() const { return m_pageMode; }
     const QByteArray& getBaseURI() const { return m_baseURI; }
-    const std::map<QByteArray, PDFFileSpecification>& getEmbeddedFiles() const { return m_namedEmbeddedFiles; }
+    const std::map<QByteArray, PDFFileSpecification>& getEmbeddedFiles() const;
     const PDFObject& getFormObject() const { return m_formObject; }
     const PDFDeveloperExtensions& getExtensions() const { return m_extensions; }
     const PDFDocumentSecurityStore& getDocumentSecurityStore() const { return m_documentSecurityStore; }
@@ -632,7 +649,7 @@ public:
     bool isXFANeedsRendering() const { return m_xfaNeedsRendering; }
     const PDFObject& getAssociatedFiles() const { return m_associatedFiles; }
     const PDFObject& getDocumentPartRoot() const { return m_documentPartRoot; }
-    const std::map<QByteArray, PDFDestination>& getNamedDestinations() const { return m_namedDestinations; }
+    const std::map<QByteArray, PDFDestination>& getNamedDestinations() const;
 
     /// Is document marked to have structure tree conforming to tagged document convention?
     bool isLogicalStructureMarked() const { return m_markInfoFlags.testFlag(MarkInfo_Marked); }
@@ -700,7 +717,7 @@ public:
     PDFObject getNamedRendition(const QByteArray& key) const;
 
     /// Returns all named JavaScript actions
-    const std::map<QByteArray, PDFActionPtr>& getNamedJavaScriptActions() const { return m_namedJavaScriptActions; }
+    const std::map<QByteArray, PDFActionPtr>& getNamedJavaScriptActions() const;
 
     /// Parses catalog from catalog dictionary. If object cannot be parsed, or error occurs,
     /// then exception is thrown.
@@ -717,12 +734,15 @@ private:
     };
     Q_DECLARE_FLAGS(MarkInfoFlags, MarkInfoFlag)
 
+    /// Returns lazily loaded data (if catalog was not parsed,
+    /// then empty data are returned)
+    PDFCatalogLazyData* getLazyData() const;
+
     QByteArray m_version;
     PDFViewerPreferences m_viewerPreferences;
     std::vector<PDFPage> m_pages;
-    std::vector<PDFPageLabel> m_pageLabels;
+    QSharedPointer<PDFLazyPageTree> m_lazyPageTree;
     PDFOptionalContentProperties m_optionalContentProperties;
-    QSharedPointer<PDFOutlineItem> m_outlineRoot;
     PDFActionPtr m_openAction;
     std::array<PDFActionPtr, LastDocumentAction> m_documentActions;
     PageLayout m_pageLayout = PageLayout::SinglePage;
@@ -747,17 +767,9 @@ private:
     PDFObject m_associatedFiles;
     PDFObject m_documentPartRoot;
 
-    // Maps from Names dictionary
-    std::map<QByteArray, PDFDestination> m_namedDestinations;
-    std::map<QByteArray, PDFObject> m_namedAppearanceStreams;
-    std::map<QByteArray, PDFActionPtr> m_namedJavaScriptActions;
-    std::map<QByteArray, PDFObject> m_namedPages;
-    std::map<QByteArray, PDFObject> m_namedTemplates;
-    std::map<QByteArray, PDFObject> m_namedDigitalIdentifiers;
-    std::map<QByteArray, PDFObject> m_namedUniformResourceLocators;
-    std::map<QByteArray, PDFFileSpecification> m_namedEmbeddedFiles;
-    std::map<QByteArray, PDFObject> m_namedAlternateRepresentations;
-    std::map<QByteArray, PDFObject> m_namedRenditions;
+    /// Outline, page labels and maps from Names dictionary,
+    /// which are loaded on demand.
+    QSharedPointer<PDFCatalogLazyData> m_lazyData;
 };
 
 }   // namespace pdf
@@ -2248,6 +2248,18 @@ std::vector<PDFColorComponent> PDFSeparationColorSpace::transformColorsToBaseCol
     const std::size_t colorComponentCount = m_alternateColorSpace->getColorComponentCount();
     std::vector<PDFColorComponent> result(buffer.size() * colorComponentCount, 0.0f);
 
+    if (!m_isAll &&
+        m_tintTransform->getInputVariableCount() == 1 &&
+        m_tintTransform->getOutputVariableCount() == colorComponentCount)
+    {
+        // Transform all colors at once, function can evaluate them faster
+        std::vector<double> tints(buffer.cbegin(), buffer.cend());
+        std::vector<double> outputColors(tints.size() * colorComponentCount, 0.0);
+        m_tintTransform->applyBatch(tints.data(), outputColors.data(), tints.size());
+        std::copy(outputColors.cbegin(), outputColors.cend(), result.begin());
+        return result;
+    }
+
     std::vector<double> outputColor;
     outputColor.resize(colorComponentCount, 0.0);
 
@@ -2489,6 +2501,17 @@ std::vector<PDFColorComponent> PDFDeviceNColorSpace::transformColorsToBaseColorS
         const std::size_t alternateColorSpaceComponentCount = m_alternateColorSpace->getColorComponentCount();
         result.resize(inputColorCount * alternateColorSpaceComponentCount, 0.0f);
 
+        if (m_tintTransform->getInputVariableCount() == colorantCount &&
+            m_tintTransform->getOutputVariableCount() == alternateColorSpaceComponentCount)
+        {
+            // Transform all colors at once, function can evaluate them faster
+            std::vector<double> inputColors(buffer.cbegin(), std::next(buffer.cbegin(), inputColorCount * colorantCount));
+            std::vector<double> outputColors(result.size(), 0.0);
+            m_tintTransform->applyBatch(inputColors.data(), outputColors.data(), inputColorCount);
+            std::copy(outputColors.cbegin(), outputColors.cend(), result.begin());
+            return result;
+        }
+
         std::vector<double> inputColor(colorantCount, 0.0);
         std::vector<double> outputColor(alternateColorSpaceComponentCount, 0.0);
 
@@ -25,6 +25,8 @@
 #include "pdfalgorithmlcs.h"
 #include "pdfpainter.h"
 
+#include <QFile>
+#include <QDataStream>
 #include <QtConcurrent/QtConcurrent>
 
 #include "pdfdbgheap.h"
@@ -74,6 +76,169 @@ public:
     static void refineTextRectangles(PDFDiffResult::RectInfos& items);
 };
 
+PDFDiffFingerprintStore::PDFDiffFingerprintStore(QByteArray documentHash, HashAlgorithm hashAlgorithm, PDFReal epsilon) :
+    m_documentHash(std::move(documentHash)),
+    m_hashAlgorithm(hashAlgorithm),
+    m_epsilon(epsilon)
+{
+
+}
+
+bool PDFDiffFingerprintStore::isCompatible(const PDFDocument* document, HashAlgorithm hashAlgorithm, PDFReal epsilon) const
+{
+    // Empty document hash means, that we do not know, from which data
+    // the document was created, so we can't tell, if store belongs to it.
+    return document &&
+           !m_documentHash.isEmpty() &&
+           document->getIdentity().isValid() &&
+           m_documentHash == document->getIdentity().getHash() &&
+           m_hashAlgorithm == hashAlgorithm &&
+           qAbs(m_epsilon - epsilon) <= EPSILON_TOLERANCE;
+}
+
+const PDFDiffFingerprintStore::GraphicPieceInfos* PDFDiffFingerprintStore::getGraphicPieces(PDFInteger pageIndex) const
+{
+    auto it = m_pages.find(pageIndex);
+    if (it != m_pages.cend())
+    {
+        return &it->second;
+    }
+
+    return nullptr;
+}
+
+void PDFDiffFingerprintStore::setGraphicPieces(PDFInteger pageIndex, GraphicPieceInfos graphicPieces)
+{
+    m_pages[pageIndex] = std::move(graphicPieces);
+}
+
+bool PDFDiffFingerprintStore::save(QIODevice* device) const
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    stream.writeRawData(FILE_MAGIC, int(qstrlen(FILE_MAGIC)));
+    stream << FILE_VERSION;
+    stream << m_documentHash;
+    stream << qint32(m_hashAlgorithm);
+    stream << m_epsilon;
+    stream << quint64(m_pages.size());
+
+    for (const auto& page : m_pages)
+    {
+        stream << qint64(page.first);
+        stream << quint64(page.second.size());
+
+        for (const PDFPrecompiledPage::GraphicPieceInfo& info : page.second)
+        {
+            stream << qint32(info.type);
+            stream << info.boundingRect;
+            stream.writeRawData(reinterpret_cast<const char*>(info.hash.data()), int(info.hash.size()));
+            stream.writeRawData(reinterpret_cast<const char*>(info.imageHash.data()), int(info.imageHash.size()));
+            stream << info.pagePath;
+        }
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
+bool PDFDiffFingerprintStore::load(QIODevice* device)
+{
+    *this = PDFDiffFingerprintStore();
+
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    QByteArray magic(int(qstrlen(FILE_MAGIC)), Qt::Uninitialized);
+    qint32 version = 0;
+    if (stream.readRawData(magic.data(), magic.size()) != magic.size() || magic != FILE_MAGIC)
+    {
+        return false;
+    }
+
+    stream >> version;
+    if (version != FILE_VERSION)
+    {
+        return false;
+    }
+
+    PDFDiffFingerprintStore store;
+    qint32 hashAlgorithm = 0;
+    quint64 pageCount = 0;
+
+    stream >> store.m_documentHash;
+    stream >> hashAlgorithm;
+    stream >> store.m_epsilon;
+    stream >> pageCount;
+    store.m_hashAlgorithm = static_cast<HashAlgorithm>(hashAlgorithm);
+
+    for (quint64 i = 0; i < pageCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        qint64 pageIndex = 0;
+        quint64 pieceCount = 0;
+        stream >> pageIndex;
+        stream >> pieceCount;
+
+        GraphicPieceInfos infos;
+        for (quint64 j = 0; j < pieceCount && stream.status() == QDataStream::Ok; ++j)
+        {
+            PDFPrecompiledPage::GraphicPieceInfo info;
+            qint32 type = 0;
+
+            stream >> type;
+            stream >> info.boundingRect;
+            stream.readRawData(reinterpret_cast<char*>(info.hash.data()), int(info.hash.size()));
+            stream.readRawData(reinterpret_cast<char*>(info.imageHash.data()), int(info.imageHash.size()));
+            stream >> info.pagePath;
+
+            info.type = static_cast<PDFPrecompiledPage::GraphicPieceInfo::Type>(type);
+            infos.emplace_back(std::move(info));
+        }
+
+        store.m_pages[pageIndex] = std::move(infos);
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        return false;
+    }
+
+    *this = std::move(store);
+    return true;
+}
+
+bool PDFDiffFingerprintStore::saveToFile(const QString& fileName) const
+{
+    QFile file(fileName);
+    if (file.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        const bool result = save(&file);
+        file.close();
+        return result;
+    }
+
+    return false;
+}
+
+bool PDFDiffFingerprintStore::loadFromFile(const QString& fileName)
+{
+    QFile file(fileName);
+    if (file.open(QFile::ReadOnly))
+    {
+        const bool result = load(&file);
+        file.close();
+        return result;
+    }
+
+    *this = PDFDiffFingerprintStore();
+    return false;
+}
+
+QString PDFDiffFingerprintStore::getDefaultFileName(const QString& documentFileName)
+{
+    return documentFileName + QLatin1String(".fingerprints");
+}
+
 PDFDiff::PDFDiff(QObject* parent) :
     BaseClass(parent),
     m_progress(nullptr),
@@ -82,7 +247,11 @@ PDFDiff::PDFDiff(QObject* parent) :
     m_options(Asynchronous | PC_Text | PC_VectorGraphics | PC_Images | CompareWords),
     m_epsilon(0.001),
     m_cancelled(false),
-    m_textAnalysisAlgorithm(PDFDocumentTextFlowFactory::Algorithm::Layout)
+    m_textAnalysisAlgorithm(PDFDocumentTextFlowFactory::Algorithm::Layout),
+    m_hashAlgorithm(PDFPrecompiledPage::HashAlgorithm::Sha512),
+    m_leftFingerprintStore(nullptr),
+    m_rightFingerprintStore(nullptr),
+    m_preparedLeftFingerprintStore(nullptr)
 {
 
 }
@@ -351,57 +520,14 @@ void PDFDiff::performSteps(const std::vector<PDFInteger>& leftPages,
     // StepExtractContentLeftDocument
     if (!m_cancelled)
     {
-        PDFFontCache fontCache(DEFAULT_FONT_CACHE_LIMIT, DEFAULT_REALIZED_FONT_CACHE_LIMIT);
-        PDFOptionalContentActivity optionalContentActivity(m_leftDocument, pdf::OCUsage::View, nullptr);
-        fontCache.setDocument(pdf::PDFModifiedDocument(const_cast<pdf::PDFDocument*>(m_leftDocument), &optionalContentActivity));
-
-        PDFCMSManager cmsManager(nullptr);
-        cmsManager.setDocument(m_leftDocument);
-        PDFCMSPointer cms = cmsManager.getCurrentCMS();
-
-        auto fillPageContext = [&, this](PDFDiffPageContext& context)
-        {
-            PDFPrecompiledPage compiledPage;
-            constexpr PDFRenderer::Features features = PDFRenderer::IgnoreOptionalContent;
-            PDFRenderer renderer(m_leftDocument, &fontCache, cms.data(), &optionalContentActivity, features, pdf::PDFMeshQualitySettings());
-            renderer.compile(&compiledPage, context.pageIndex);
-
-            auto page = m_leftDocument->getCatalog()->getPage(context.pageIndex);
-            PDFReal epsilon = calculateEpsilonForPage(page);
-            context.graphicPieces = compiledPage.calculateGraphicPieceInfos(page->getMediaBox(), epsilon);
-
-            finalizeGraphicsPieces(context);
-        };
-        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, leftPreparedPages.begin(), leftPreparedPages.end(), fillPageContext);
+        prepareGraphicsPieces(m_leftDocument, m_leftFingerprintStore, m_preparedLeftFingerprintStore, leftPreparedPages);
         stepProgress();
     }
 
     // StepExtractContentRightDocument
     if (!m_cancelled)
     {
-        PDFFontCache fontCache(DEFAULT_FONT_CACHE_LIMIT, DEFAULT_REALIZED_FONT_CACHE_LIMIT);
-        PDFOptionalContentActivity optionalContentActivity(m_rightDocument, pdf::OCUsage::View, nullptr);
-        fontCache.setDocument(pdf::PDFModifiedDocument(const_cast<pdf::PDFDocument*>(m_rightDocument), &optionalContentActivity));
-
-        PDFCMSManager cmsManager(nullptr);
-        cmsManager.setDocument(m_rightDocument);
-        PDFCMSPointer cms = cmsManager.getCurrentCMS();
-
-        auto fillPageContext = [&, this](PDFDiffPageContext& context)
-        {
-            PDFPrecompiledPage compiledPage;
-            constexpr PDFRenderer::Features features = PDFRenderer::IgnoreOptionalContent;
-            PDFRenderer renderer(m_rightDocument, &fontCache, cms.data(), &optionalContentActivity, features, pdf::PDFMeshQualitySettings());
-            renderer.compile(&compiledPage, context.pageIndex);
-
-            const PDFPage* page = m_rightDocument->getCatalog()->getPage(context.pageIndex);
-            PDFReal epsilon = calculateEpsilonForPage(page);
-            context.graphicPieces = compiledPage.calculateGraphicPieceInfos(page->getMediaBox(), epsilon);
-
-            finalizeGraphicsPieces(context);
-        };
-
-        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, rightPreparedPages.begin(), rightPreparedPages.end(), fillPageContext);
+        prepareGraphicsPieces(m_rightDocument, m_rightFingerprintStore, nullptr, rightPreparedPages);
         stepProgress();
     }
 
@@ -857,13 +983,13 @@ void PDFDiff::performCompare(const std::vector<PDFDiffPageContext>& leftPrepared
     result.finalize();
 }
 
-void PDFDiff::finalizeGraphicsPieces(PDFDiffPageContext& context)
+void PDFDiff::finalizeGraphicsPieces(PDFDiffPageContext& context) const
 {
     std::sort(context.graphicPieces.begin(), context.graphicPieces.end());
 
     // Compute page hash using active settings
-    QCryptographicHash hasher(QCryptographicHash::Sha512);
-    hasher.reset();
+    QByteArray pageData;
+    pageData.reserve(int(context.graphicPieces.size() * sizeof(PDFPrecompiledPage::GraphicPieceInfo::hash)));
 
     for (const PDFPrecompiledPage::GraphicPieceInfo& info : context.graphicPieces)
     {
@@ -884,15 +1010,187 @@ void PDFDiff::finalizeGraphicsPieces(PDFDiffPageContext& context)
             continue;
         }
 
-        QByteArrayView view(reinterpret_cast<const char*>(info.hash.data()), info.hash.size());
-        hasher.addData(view);
+        pageData.append(reinterpret_cast<const char*>(info.hash.data()), info.hash.size());
     }
 
-    QByteArray hash = hasher.result();
-    Q_ASSERT(QCryptographicHash::hashLength(QCryptographicHash::Sha512) == 64);
+    PDFPrecompiledPage::calculateHash(pageData, m_hashAlgorithm, context.pageHash);
+}
+
+void PDFDiff::prepareGraphicsPieces(const PDFDocument* document,
+                                    PDFDiffFingerprintStore* store,
+                                    const PDFDiffFingerprintStore* preparedStore,
+                                    std::vector<PDFDiffPageContext>& preparedPages) const
+{
+    if (preparedStore)
+    {
+        // Prepared store is only read, it can be shared between threads
+        store = nullptr;
+    }
+    else if (store)
+    {
+        if (!store->isCompatible(document, m_hashAlgorithm, m_epsilon))
+        {
+            *store = PDFDiffFingerprintStore(document->getIdentity().getHash(), m_hashAlgorithm, m_epsilon);
+        }
+        preparedStore = store;
+    }
+
+    // Take fingerprints from the store, if we have them,
+    // and compile only pages, which are not present in the store.
+    std::vector<PDFDiffPageContext*> pagesToCompile;
+    for (PDFDiffPageContext& context : preparedPages)
+    {
+        const PDFPrecompiledPage::GraphicPieceInfos* graphicPieces = preparedStore ? preparedStore->getGraphicPieces(context.pageIndex) : nullptr;
+        if (graphicPieces)
+        {
+            context.graphicPieces = *graphicPieces;
+            finalizeGraphicsPieces(context);
+        }
+        else
+        {
+            pagesToCompile.push_back(&context);
+        }
+    }
+
+    if (pagesToCompile.empty())
+    {
+        return;
+    }
+
+    PDFFontCache fontCache(DEFAULT_FONT_CACHE_LIMIT, DEFAULT_REALIZED_FONT_CACHE_LIMIT);
+    PDFOptionalContentActivity optionalContentActivity(document, pdf::OCUsage::View, nullptr);
+    fontCache.setDocument(pdf::PDFModifiedDocument(const_cast<pdf::PDFDocument*>(document), &optionalContentActivity));
+
+    PDFCMSManager cmsManager(nullptr);
+    cmsManager.setDocument(document);
+    PDFCMSPointer cms = cmsManager.getCurrentCMS();
+
+    auto fillPageContext = [&, this](PDFDiffPageContext* context)
+    {
+        PDFPrecompiledPage compiledPage;
+        constexpr PDFRenderer::Features features = PDFRenderer::IgnoreOptionalContent;
+        PDFRenderer renderer(document, &fontCache, cms.data(), &optionalContentActivity, features, pdf::PDFMeshQualitySettings());
+        renderer.compile(&compiledPage, context->pageIndex);
+
+        const PDFPage* page = document->getCatalog()->getPage(context->pageIndex);
+        PDFReal epsilon = calculateEpsilonForPage(page);
+        context->graphicPieces = compiledPage.calculateGraphicPieceInfos(page->getMediaBox(), epsilon, m_hashAlgorithm);
+
+        finalizeGraphicsPieces(*context);
+    };
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, pagesToCompile.begin(), pagesToCompile.end(), fillPageContext);
+
+    if (store)
+    {
+        for (const PDFDiffPageContext* context : pagesToCompile)
+        {
+            store->setGraphicPieces(context->pageIndex, context->graphicPieces);
+        }
+    }
+}
+
+PDFDiffFingerprintStore PDFDiff::createFingerprintStore(const PDFDocument* document, const std::vector<PDFInteger>& pages) const
+{
+    PDFDiffFingerprintStore store(document->getIdentity().getHash(), m_hashAlgorithm, m_epsilon);
+
+    std::vector<PDFDiffPageContext> preparedPages;
+    preparedPages.reserve(pages.size());
+    for (PDFInteger pageIndex : pages)
+    {
+        PDFDiffPageContext context;
+        context.pageIndex = pageIndex;
+        preparedPages.emplace_back(std::move(context));
+    }
+
+    prepareGraphicsPieces(document, &store, nullptr, preparedPages);
+    return store;
+}
 
-    size_t size = qMin<size_t>(hash.length(), context.pageHash.size());
-    std::copy(hash.data(), hash.data() + size, context.pageHash.data());
+std::vector<PDFDiffResult> PDFDiff::compareMany(const std::vector<const PDFDocument*>& documents)
+{
+    stop();
+
+    std::vector<PDFDiffResult> results(documents.size());
+
+    if (!m_leftDocument || m_pagesForLeftDocument.isEmpty())
+    {
+        for (PDFDiffResult& result : results)
+        {
+            result.setResult(tr("No document to be compared."));
+        }
+        return results;
+    }
+
+    std::vector<PDFInteger> leftPages = m_pagesForLeftDocument.unfold();
+    const PDFInteger leftDocumentPageCount = m_leftDocument->getCatalog()->getPageCount();
+    if (leftPages.front() < 0 || leftPages.back() >= leftDocumentPageCount)
+    {
+        for (PDFDiffResult& result : results)
+        {
+            result.setResult(tr("Invalid page range."));
+        }
+        return results;
+    }
+
+    // Prepare baseline only once. After that, the store contains all compared
+    // pages, and it is only read (and shared) by comparators of the documents.
+    PDFDiffFingerprintStore localStore;
+    PDFDiffFingerprintStore* leftStore = m_leftFingerprintStore ? m_leftFingerprintStore : &localStore;
+
+    std::vector<PDFDiffPageContext> preparedPages;
+    preparedPages.reserve(leftPages.size());
+    for (PDFInteger pageIndex : leftPages)
+    {
+        PDFDiffPageContext context;
+        context.pageIndex = pageIndex;
+        preparedPages.emplace_back(std::move(context));
+    }
+    prepareGraphicsPieces(m_leftDocument, leftStore, nullptr, preparedPages);
+    preparedPages.clear();
+
+    auto compareDocument = [this, leftStore](const PDFDocument* document)
+    {
+        PDFDiffResult result;
+
+        if (!document || document->getCatalog()->getPageCount() == 0)
+        {
+            result.setResult(tr("No page to be compared."));
+            return result;
+        }
+
+        PDFClosedIntervalSet rightPages;
+        rightPages.addInterval(0, document->getCatalog()->getPageCount() - 1);
+
+        PDFDiff diff(nullptr);
+        diff.m_options = m_options;
+        diff.m_epsilon = m_epsilon;
+        diff.m_textAnalysisAlgorithm = m_textAnalysisAlgorithm;
+        diff.m_hashAlgorithm = m_hashAlgorithm;
+        diff.setOption(Asynchronous, false);
+        diff.setLeftDocument(m_leftDocument);
+        diff.setRightDocument(document);
+        diff.setPagesForLeftDocument(m_pagesForLeftDocument);
+        diff.setPagesForRightDocument(std::move(rightPages));
+        diff.m_preparedLeftFingerprintStore = leftStore;
+        diff.start();
+        return diff.getResult();
+    };
+
+    // We use QtConcurrent thread pool for documents, because pages
+    // of each document are processed in the execution policy thread pool.
+    std::vector<QFuture<PDFDiffResult>> futures;
+    futures.reserve(documents.size());
+    for (const PDFDocument* document : documents)
+    {
+        futures.emplace_back(QtConcurrent::run(compareDocument, document));
+    }
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        results[i] = futures[i].result();
+    }
+
+    return results;
 }
 
 void PDFDiff::onComparationPerformed()
@@ -925,6 +1223,24 @@ void PDFDiff::setTextAnalysisAlgorithm(PDFDocumentTextFlowFactory::Algorithm tex
     m_textAnalysisAlgorithm = textAnalysisAlgorithm;
 }
 
+void PDFDiff::setHashAlgorithm(PDFPrecompiledPage::HashAlgorithm hashAlgorithm)
+{
+    stop();
+    m_hashAlgorithm = hashAlgorithm;
+}
+
+void PDFDiff::setLeftFingerprintStore(PDFDiffFingerprintStore* store)
+{
+    stop();
+    m_leftFingerprintStore = store;
+}
+
+void PDFDiff::setRightFingerprintStore(PDFDiffFingerprintStore* store)
+{
+    stop();
+    m_rightFingerprintStore = store;
+}
+
 PDFDiffResult::PDFDiffResult() :
     m_result(true)
 {
@@ -23,6 +23,7 @@
 #include "pdfutils.h"
 #include "pdfalgorithmlcs.h"
 #include "pdfdocumenttextflow.h"
+#include "pdfpainter.h"
 
 #include <QObject>
 #include <QFuture>
@@ -282,6 +283,73 @@ private:
     size_t m_currentIndex;
 };
 
+/// Persistent store of page fingerprints of a document. Page fingerprint
+/// consists of graphic pieces of the page (together with their hashes).
+/// Store can be saved next to the document and reused in subsequent
+/// comparations, so pages of the document are not compiled and hashed again.
+class PDF4QTLIBCORESHARED_EXPORT PDFDiffFingerprintStore
+{
+public:
+    using HashAlgorithm = PDFPrecompiledPage::HashAlgorithm;
+    using GraphicPieceInfos = PDFPrecompiledPage::GraphicPieceInfos;
+
+    /// Tolerance, under which epsilons of the store and
+    /// of the comparation are considered as equal
+    static constexpr PDFReal EPSILON_TOLERANCE = 1e-9;
+
+    explicit PDFDiffFingerprintStore() = default;
+    explicit PDFDiffFingerprintStore(QByteArray documentHash, HashAlgorithm hashAlgorithm, PDFReal epsilon);
+
+    bool isEmpty() const { return m_pages.empty(); }
+    size_t getPageCount() const { return m_pages.size(); }
+
+    const QByteArray& getDocumentHash() const { return m_documentHash; }
+    HashAlgorithm getHashAlgorithm() const { return m_hashAlgorithm; }
+    PDFReal getEpsilon() const { return m_epsilon; }
+
+    /// Returns true, if store was created for given document
+    /// with given settings, so fingerprints can be used.
+    /// \param document Document
+    /// \param hashAlgorithm Hash algorithm
+    /// \param epsilon Relative comparation epsilon
+    bool isCompatible(const PDFDocument* document, HashAlgorithm hashAlgorithm, PDFReal epsilon) const;
+
+    /// Returns graphic pieces of the page, or nullptr,
+    /// if page is not present in the store.
+    /// \param pageIndex Page index
+    const GraphicPieceInfos* getGraphicPieces(PDFInteger pageIndex) const;
+
+    /// Sets graphic pieces of the page (graphic pieces must be sorted)
+    /// \param pageIndex Page index
+    /// \param graphicPieces Graphic pieces
+    void setGraphicPieces(PDFInteger pageIndex, GraphicPieceInfos graphicPieces);
+
+    /// Saves the store to the device
+    /// \param device Device
+    bool save(QIODevice* device) const;
+
+    /// Loads the store from the device. If loading fails,
+    /// store is cleared and false is returned.
+    /// \param device Device
+    bool load(QIODevice* device);
+
+    bool saveToFile(const QString& fileName) const;
+    bool loadFromFile(const QString& fileName);
+
+    /// Returns file name of the store, which is saved next to the document
+    /// \param documentFileName File name of the document
+    static QString getDefaultFileName(const QString& documentFileName);
+
+private:
+    static constexpr const char* FILE_MAGIC = "PDF4QTFP";
+    static constexpr qint32 FILE_VERSION = 1;
+
+    QByteArray m_documentHash;
+    HashAlgorithm m_hashAlgorithm = HashAlgorithm::Sha512;
+    PDFReal m_epsilon = 0.0;
+    std::map<PDFInteger, GraphicPieceInfos> m_pages;
+};
+
 /// Diff engine for comparing two pdf documents.
 class PDF4QTLIBCORESHARED_EXPORT PDFDiff : public QObject
 {
@@ -348,6 +416,37 @@ public:
     PDFDocumentTextFlowFactory::Algorithm getTextAnalysisAlgorithm() const;
     void setTextAnalysisAlgorithm(PDFDocumentTextFlowFactory::Algorithm textAnalysisAlgorithm);
 
+    PDFPrecompiledPage::HashAlgorithm getHashAlgorithm() const { return m_hashAlgorithm; }
+    void setHashAlgorithm(PDFPrecompiledPage::HashAlgorithm hashAlgorithm);
+
+    /// Sets fingerprint store of the left document. Fingerprints of pages present
+    /// in the store are not calculated again, newly calculated fingerprints are
+    /// added to the store. If store doesn't match the document or settings,
+    /// it is reset. Store must exist until comparation is finished.
+    /// \param store Fingerprint store (can be nullptr)
+    void setLeftFingerprintStore(PDFDiffFingerprintStore* store);
+
+    /// Sets fingerprint store of the right document.
+    /// \sa setLeftFingerprintStore
+    /// \param store Fingerprint store (can be nullptr)
+    void setRightFingerprintStore(PDFDiffFingerprintStore* store);
+
+    /// Calculates fingerprints of given pages of the document
+    /// using current settings. Pages are processed in parallel.
+    /// \param document Document
+    /// \param pages Page indices
+    PDFDiffFingerprintStore createFingerprintStore(const PDFDocument* document, const std::vector<PDFInteger>& pages) const;
+
+    /// Compares left document (baseline) with several documents. Baseline
+    /// is prepared only once (its fingerprints are taken from the left
+    /// fingerprint store, or calculated once), then documents are compared
+    /// with the baseline in parallel. Selected pages of the left document
+    /// are compared with all pages of each document. This function is always
+    /// blocking, asynchronous option is ignored. Right fingerprint store is
+    /// not used, because each compared document is different.
+    /// \param documents Documents to be compared with the baseline
+    std::vector<PDFDiffResult> compareMany(const std::vector<const PDFDocument*>& documents);
+
 signals:
     void comparationFinished();
 
@@ -378,7 +477,11 @@ private:
                         PDFAlgorithmLongestCommonSubsequenceBase::Sequence& pageSequence,
                         const std::map<size_t, size_t>& pageMatches,
                         PDFDiffResult& result);
-    void finalizeGraphicsPieces(PDFDiffPageContext& context);
+    void finalizeGraphicsPieces(PDFDiffPageContext& context) const;
+    void prepareGraphicsPieces(const PDFDocument* document,
+                               PDFDiffFingerprintStore* store,
+                               const PDFDiffFingerprintStore* preparedStore,
+                               std::vector<PDFDiffPageContext>& preparedPages) const;
 
     void onComparationPerformed();
 
@@ -398,6 +501,14 @@ private:
     std::atomic_bool m_cancelled;
     PDFDiffResult m_result;
     PDFDocumentTextFlowFactory::Algorithm m_textAnalysisAlgorithm;
+    PDFPrecompiledPage::HashAlgorithm m_hashAlgorithm;
+    PDFDiffFingerprintStore* m_leftFingerprintStore;
+    PDFDiffFingerprintStore* m_rightFingerprintStore;
+
+    /// Fingerprints of the left document prepared for this document and settings
+    /// (used by one-to-many comparation). Store is only read, so it can be shared
+    /// between several comparators running in parallel.
+    const PDFDiffFingerprintStore* m_preparedLeftFingerprintStore;
 
     QFuture<PDFDiffResult> m_future;
     std::optional<QFutureWatcher<PDFDiffResult>> m_futureWatcher;
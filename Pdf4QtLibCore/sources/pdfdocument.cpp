@@ -33,6 +33,11 @@ QByteArray PDFObjectStorage::getDecodedStream(const PDFStream* stream) const
     return PDFStreamFilterStorage::getDecodedStream(stream, std::bind(QOverload<const PDFObject&>::of(&PDFObjectStorage::getObject), this, std::placeholders::_1), getSecurityHandler());
 }
 
+PDFStreamFilterDecoderPointer PDFObjectStorage::createStreamDecoder(const PDFStream* stream) const
+{
+    return PDFStreamFilterStorage::createDecoder(stream, std::bind(QOverload<const PDFObject&>::of(&PDFObjectStorage::getObject), this, std::placeholders::_1), getSecurityHandler());
+}
+
 PDFDocument::~PDFDocument()
 {
 
@@ -69,6 +74,11 @@ QByteArray PDFDocument::getDecodedStream(const PDFStream* stream) const
     return m_pdfObjectStorage.getDecodedStream(stream);
 }
 
+PDFStreamFilterDecoderPointer PDFDocument::createStreamDecoder(const PDFStream* stream) const
+{
+    return m_pdfObjectStorage.createStreamDecoder(stream);
+}
+
 const PDFDictionary* PDFDocument::getTrailerDictionary() const
 {
     const PDFObject& trailerDictionary = m_pdfObjectStorage.getTrailerDictionary();
@@ -156,6 +166,22 @@ void PDFObjectStorage::setObject(PDFObjectReference reference, PDFObject object)
     m_objects[reference.objectNumber] = Entry(reference.generation, qMove(object));
 }
 
+std::vector<PDFObjectReference> PDFObjectStorage::getChangedReferences(const PDFObjectStorage& other) const
+{
+    std::vector<PDFObjectReference> references;
+
+    std::vector<size_t> indices = m_objects.getDifferentIndices(other.m_objects);
+    references.reserve(indices.size());
+
+    for (size_t index : indices)
+    {
+        const PDFInteger generation = index < m_objects.size() ? m_objects[index].generation : other.m_objects[index].generation;
+        references.emplace_back(PDFInteger(index), generation);
+    }
+
+    return references;
+}
+
 void PDFObjectStorage::updateTrailerDictionary(PDFObject trailerDictionary)
 {
     m_trailerDictionary = PDFObjectManipulator::merge(m_trailerDictionary, trailerDictionary, PDFObjectManipulator::RemoveNullObjects);
@@ -19,9 +19,12 @@
 #define PDFDOCUMENT_H
 
 #include "pdfglobal.h"
+#include "pdfutils.h"
 #include "pdfobject.h"
 #include "pdfcatalog.h"
 #include "pdfsecurityhandler.h"
+#include "pdfdocumentidentity.h"
+#include "pdfstreamfilters.h"
 
 #include <QColor>
 #include <QTransform>
@@ -36,6 +39,8 @@ class PDFDocumentBuilder;
 
 /// Storage for objects. This class is not thread safe for writing (calling non-const functions). Caller must ensure
 /// locking, if this object is used from multiple threads. Calling const functions should be thread safe.
+/// Objects are stored in copy-on-write chunks, which are shared between copies of the storage,
+/// so copy of the storage is cheap and modified copy shares unmodified objects with the original.
 class PDF4QTLIBCORESHARED_EXPORT PDFObjectStorage
 {
 public:
@@ -62,7 +67,7 @@ public:
         PDFObject object;
     };
 
-    using PDFObjects = std::vector<Entry>;
+    using PDFObjects = PDFCopyOnWriteVector<Entry>;
 
     explicit PDFObjectStorage(PDFObjects&& objects, PDFObject&& trailerDictionary, PDFSecurityHandlerPointer&& securityHandler) :
         m_objects(std::move(objects)),
@@ -130,10 +135,22 @@ public:
     /// \param stream Stream to be decoded
     QByteArray getDecodedStream(const PDFStream* stream) const;
 
+    /// Creates decoder, which decodes stream data in chunks. Decoder
+    /// must not be used after the document is destroyed.
+    /// \param stream Stream to be decoded
+    PDFStreamFilterDecoderPointer createStreamDecoder(const PDFStream* stream) const;
+
     /// Set trailer dictionary
     /// \param object Object defining trailer dictionary
     void setTrailerDictionary(const PDFObject& object) { m_trailerDictionary = object; }
 
+    /// Returns references of objects, which are different in this storage
+    /// and in the \p other storage (changed, added or removed objects).
+    /// Objects shared between storages are not compared, so if one storage
+    /// was created by modification of the other, this function is fast.
+    /// \param other Other storage
+    std::vector<PDFObjectReference> getChangedReferences(const PDFObjectStorage& other) const;
+
 private:
     PDFObjects m_objects;
     PDFObject m_trailerDictionary;
@@ -443,6 +460,11 @@ public:
     /// \param stream Stream to be decoded
     QByteArray getDecodedStream(const PDFStream* stream) const;
 
+    /// Creates decoder, which decodes stream data in chunks. Decoder
+    /// must not be used after the document is destroyed.
+    /// \param stream Stream to be decoded
+    PDFStreamFilterDecoderPointer createStreamDecoder(const PDFStream* stream) const;
+
     /// Returns the trailer dictionary
     const PDFDictionary* getTrailerDictionary() const;
 
@@ -453,7 +475,16 @@ public:
 
     explicit PDFDocument(PDFObjectStorage&& storage, PDFVersion version, QByteArray sourceDataHash) :
         m_pdfObjectStorage(std::move(storage)),
-        m_sourceDataHash(std::move(sourceDataHash))
+        m_identity(PDFDocumentIdentity::createFromHash(std::move(sourceDataHash)))
+    {
+        init();
+
+        m_info.version = version;
+    }
+
+    explicit PDFDocument(PDFObjectStorage&& storage, PDFVersion version, PDFDocumentIdentity identity) :
+        m_pdfObjectStorage(std::move(storage)),
+        m_identity(std::move(identity))
     {
         init();
 
@@ -468,7 +499,11 @@ public:
      *
      * @return Hash value of the source data.
      */
-    const QByteArray& getSourceDataHash() const { return m_sourceDataHash; }
+    const QByteArray& getSourceDataHash() const { return m_identity.getHash(); }
+
+    /// Returns identity of the source data, from which the document was read.
+    /// It can be used as a key for caches shared between documents.
+    const PDFDocumentIdentity& getIdentity() const { return m_identity; }
 
 private:
     friend class PDFDocumentReader;
@@ -493,9 +528,9 @@ private:
     /// Catalog object
     PDFCatalog m_catalog;
 
-    /// Hash of the source byte array's data,
+    /// Identity (hash) of the source byte array's data,
     /// from which the document was created.
-    QByteArray m_sourceDataHash;
+    PDFDocumentIdentity m_identity;
 };
 
 using PDFDocumentPointer = QSharedPointer<PDFDocument>;
@@ -572,6 +607,21 @@ public:
     bool hasFlag(ModificationFlag flag) const { return m_flags.testFlag(flag); }
     bool hasPreserveView() const { return m_flags.testFlag(PreserveView); }
 
+    /// Returns references of objects changed by the modification. References
+    /// are computed on the first call, because comparison of the documents
+    /// can be expensive (if documents do not share objects). If references
+    /// can't be determined, empty vector is returned.
+    const std::vector<PDFObjectReference>& getChangedReferences() const;
+
+    /// Returns true, if references of changed objects can be determined,
+    /// i.e. document before the modification is known and document isn't reset.
+    bool hasChangedReferences() const { return m_document && m_oldDocument && !hasReset(); }
+
+    /// Sets document before the modification. References of changed
+    /// objects are then computed on demand.
+    /// \param oldDocument Document before the modification
+    void setOldDocument(PDFDocumentPointer oldDocument);
+
     operator PDFDocument*() const { return m_document; }
     operator PDFDocumentPointer() const { return m_documentPointer; }
 
@@ -580,6 +630,8 @@ private:
     PDFDocument* m_document = nullptr;
     PDFOptionalContentActivity* m_optionalContentActivity = nullptr;
     ModificationFlags m_flags = Reset;
+    PDFDocumentPointer m_oldDocument;
+    mutable std::optional<std::vector<PDFObjectReference>> m_changedReferences;
 };
 
 // Implementation
@@ -640,6 +692,29 @@ const PDFObject& PDFObjectStorage::getObjectByReference(PDFObjectReference refer
     return getObject(reference);
 }
 
+inline
+void PDFModifiedDocument::setOldDocument(PDFDocumentPointer oldDocument)
+{
+    m_oldDocument = qMove(oldDocument);
+    m_changedReferences = std::nullopt;
+}
+
+inline
+const std::vector<PDFObjectReference>& PDFModifiedDocument::getChangedReferences() const
+{
+    if (!m_changedReferences)
+    {
+        m_changedReferences.emplace();
+
+        if (hasChangedReferences())
+        {
+            *m_changedReferences = m_document->getStorage().getChangedReferences(m_oldDocument->getStorage());
+        }
+    }
+
+    return *m_changedReferences;
+}
+
 }   // namespace pdf
 
 #endif // PDFDOCUMENT_H
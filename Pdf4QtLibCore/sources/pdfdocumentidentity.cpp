@@ -0,0 +1,162 @@
+//    Copyright (C) 2024 Jakub Melka
+//
+//    This file is part of PDF4QT.
+//
+//    PDF4QT is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU Lesser General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    with the written consent of the copyright owner, any later version.
+//
+//    PDF4QT is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//    You should have received a copy of the GNU Lesser General Public License
+//    along with PDF4QT.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "pdfdocumentidentity.h"
+#include "pdfexecutionpolicy.h"
+
+#include <QtEndian>
+#include <QCryptographicHash>
+#include <QtConcurrent/QtConcurrent>
+
+#include "pdfdbgheap.h"
+
+namespace pdf
+{
+
+class PDFDocumentIdentity::PDFDocumentIdentityData
+{
+public:
+    explicit PDFDocumentIdentityData() = default;
+
+    /// Computation of the hash (hash is valid, when it is finished)
+    QFuture<void> future;
+
+    QByteArray hash;
+    QByteArray fastIdentity;
+    qsizetype sourceDataSize = 0;
+};
+
+PDFDocumentIdentity PDFDocumentIdentity::create(QByteArray sourceData, QByteArray documentId)
+{
+    PDFDocumentIdentity identity;
+    identity.m_data.reset(new PDFDocumentIdentityData());
+    identity.m_data->sourceDataSize = sourceData.size();
+
+    if (!documentId.isEmpty())
+    {
+        QByteArray fastIdentity(sizeof(quint64), 0);
+        qToLittleEndian<quint64>(sourceData.size(), fastIdentity.data());
+        fastIdentity.append(documentId);
+        identity.m_data->fastIdentity = qMove(fastIdentity);
+    }
+
+    // Data of the identity are kept alive by the running task
+    QSharedPointer<PDFDocumentIdentityData> data = identity.m_data;
+    data->future = QtConcurrent::run([data, sourceData = qMove(sourceData)]() { data->hash = computeHash(sourceData); });
+
+    return identity;
+}
+
+PDFDocumentIdentity PDFDocumentIdentity::createFromHash(QByteArray hash)
+{
+    PDFDocumentIdentity identity;
+
+    if (!hash.isEmpty())
+    {
+        identity.m_data.reset(new PDFDocumentIdentityData());
+        identity.m_data->hash = qMove(hash);
+    }
+
+    return identity;
+}
+
+QByteArray PDFDocumentIdentity::computeHash(const QByteArray& data)
+{
+    struct Chunk
+    {
+        qsizetype offset = 0;
+        qsizetype size = 0;
+        QByteArray hash;
+    };
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(data.size() / HASH_CHUNK_SIZE + 1);
+    for (qsizetype offset = 0; offset < data.size(); offset += HASH_CHUNK_SIZE)
+    {
+        chunks.push_back(Chunk{ offset, qMin(HASH_CHUNK_SIZE, data.size() - offset), QByteArray() });
+    }
+
+    auto hashChunk = [&data](Chunk& chunk)
+    {
+        chunk.hash = QCryptographicHash::hash(QByteArrayView(data.constData() + chunk.offset, chunk.size), QCryptographicHash::Sha256);
+    };
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Unknown, chunks.begin(), chunks.end(), hashChunk);
+
+    // Root of the tree is hash of the data size and the chunk hashes
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    QByteArray size(sizeof(quint64), 0);
+    qToLittleEndian<quint64>(data.size(), size.data());
+    hash.addData(size);
+
+    for (const Chunk& chunk : chunks)
+    {
+        hash.addData(chunk.hash);
+    }
+
+    return hash.result();
+}
+
+bool PDFDocumentIdentity::isHashReady() const
+{
+    return m_data && (m_data->future.isCanceled() || m_data->future.isFinished());
+}
+
+const QByteArray& PDFDocumentIdentity::getHash() const
+{
+    if (!m_data)
+    {
+        static const QByteArray dummy;
+        return dummy;
+    }
+
+    m_data->future.waitForFinished();
+    return m_data->hash;
+}
+
+const QByteArray& PDFDocumentIdentity::getFastIdentity() const
+{
+    if (!m_data)
+    {
+        static const QByteArray dummy;
+        return dummy;
+    }
+
+    return m_data->fastIdentity;
+}
+
+qsizetype PDFDocumentIdentity::getSourceDataSize() const
+{
+    return m_data ? m_data->sourceDataSize : 0;
+}
+
+bool PDFDocumentIdentity::operator==(const PDFDocumentIdentity& other) const
+{
+    if (m_data == other.m_data)
+    {
+        return true;
+    }
+
+    if (!m_data || !other.m_data)
+    {
+        return false;
+    }
+
+    return getHash() == other.getHash();
+}
+
+}   // namespace pdf
@@ -0,0 +1,94 @@
+//    Copyright (C) 2024 Jakub Melka
+//
+//    This file is part of PDF4QT.
+//
+//    PDF4QT is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU Lesser General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    with the written consent of the copyright owner, any later version.
+//
+//    PDF4QT is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//    You should have received a copy of the GNU Lesser General Public License
+//    along with PDF4QT.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PDFDOCUMENTIDENTITY_H
+#define PDFDOCUMENTIDENTITY_H
+
+#include "pdfglobal.h"
+
+#include <QByteArray>
+#include <QSharedPointer>
+
+namespace pdf
+{
+
+/// Identity of the source data, from which the document was read. It can
+/// be used as a key for caches (rendered pages, text layouts, thumbnails,
+/// fingerprints), which can be shared between documents read from the same data.
+/// Hash of the source data is a tree hash - data are divided into chunks, chunks
+/// are hashed in parallel, and then hash of the chunk hashes is computed. Hash is
+/// computed in the background, function \p getHash waits for the result.
+/// Identity is implicitly shared, so it is cheap to copy it.
+class PDF4QTLIBCORESHARED_EXPORT PDFDocumentIdentity
+{
+public:
+    explicit PDFDocumentIdentity() = default;
+
+    /// Size of the chunk of the tree hash
+    static constexpr qsizetype HASH_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    /// Creates identity of the source data. Hash is computed
+    /// in the background.
+    /// \param sourceData Source data of the document
+    /// \param documentId First part of the ID array of the document (can be empty)
+    static PDFDocumentIdentity create(QByteArray sourceData, QByteArray documentId);
+
+    /// Creates identity from already computed hash (or empty
+    /// identity, if hash is empty)
+    /// \param hash Hash of the source data
+    static PDFDocumentIdentity createFromHash(QByteArray hash);
+
+    /// Computes tree hash of the data (in parallel, if data are large,
+    /// but in the calling thread). Returns same value as \p getHash.
+    /// \param data Data
+    static QByteArray computeHash(const QByteArray& data);
+
+    /// Returns true, if identity is valid (i.e. it was created
+    /// from source data or from hash)
+    bool isValid() const { return !m_data.isNull(); }
+
+    /// Returns true, if hash was already computed (so \p getHash
+    /// doesn't block)
+    bool isHashReady() const;
+
+    /// Returns hash of the source data. If hash is not yet computed,
+    /// then function waits until it is computed. For invalid identity,
+    /// empty byte array is returned.
+    const QByteArray& getHash() const;
+
+    /// Returns fast identity of the document, which is available immediately.
+    /// It is created from size of the source data and from the ID array of the
+    /// document. Fast identity is empty, if document doesn't have an ID. Fast identity
+    /// is not unique - two revisions of the document can have the same ID, so it
+    /// should be used only to find candidates, which are then checked using hash.
+    const QByteArray& getFastIdentity() const;
+
+    /// Returns size of the source data
+    qsizetype getSourceDataSize() const;
+
+    bool operator==(const PDFDocumentIdentity& other) const;
+    bool operator!=(const PDFDocumentIdentity& other) const { return !(*this == other); }
+
+private:
+    class PDFDocumentIdentityData;
+
+    QSharedPointer<PDFDocumentIdentityData> m_data;
+};
+
+}   // namespace pdf
+
+#endif // PDFDOCUMENTIDENTITY_H
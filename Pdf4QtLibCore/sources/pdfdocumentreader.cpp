@@ -25,7 +25,6 @@
 #include "pdfexecutionpolicy.h"
 
 #include <QFile>
-#include <QCryptographicHash>
 
 #include "pdfdbgheap.h"
 
@@ -33,10 +32,233 @@
 #include <cctype>
 #include <algorithm>
 #include <execution>
+#include <numeric>
+#include <cstring>
 
 namespace pdf
 {
 
+/// Minimal size of the part of the buffer, which is scanned by one thread,
+/// when damaged document is being recovered
+static constexpr int RECOVERY_SCAN_PART_SIZE = 1024 * 1024;
+
+/// Marker found by the recovery scanner
+struct PDFRecoveryMarker
+{
+    enum class Type : uint8_t
+    {
+        ObjectStart,    ///< Start of the object header "N G obj", offset is start of object number
+        ObjectEnd,      ///< Keyword "endobj", offset is the position after the keyword
+        StreamStart,    ///< Keyword "stream", offset is the position after the keyword
+        StreamEnd       ///< Keyword "endstream", offset is the position after the keyword
+    };
+
+    Type type = Type::ObjectStart;
+    int offset = 0;
+};
+
+/// Scans part of the buffer for the object and stream markers. Marker belongs
+/// to the part, if its last character lies in the part (so marker can start
+/// in the previous part). Characters 'j' (obj, endobj) and 'm' (stream, endstream)
+/// are searched using memchr, which is vectorized in the standard library.
+/// \param buffer Buffer
+/// \param begin Start of the part
+/// \param end End of the part
+static std::vector<PDFRecoveryMarker> scanRecoveryMarkers(const QByteArray& buffer, int begin, int end)
+{
+    std::vector<PDFRecoveryMarker> markers;
+
+    const char* data = buffer.constData();
+    const int size = buffer.size();
+
+    auto matches = [data](int lastCharacterIndex, const char* keyword, int keywordLength)
+    {
+        const int startIndex = lastCharacterIndex - keywordLength + 1;
+        return startIndex >= 0 && std::memcmp(data + startIndex, keyword, keywordLength) == 0;
+    };
+
+    auto isTerminated = [data, size](int index)
+    {
+        return index >= size || !PDFLexicalAnalyzer::isRegular(data[index]);
+    };
+
+    auto findNext = [data, end](int from, char character)
+    {
+        if (from >= end)
+        {
+            return end;
+        }
+
+        const void* found = std::memchr(data + from, character, end - from);
+        return found ? static_cast<int>(static_cast<const char*>(found) - data) : end;
+    };
+
+    // Tries to read object header "N G obj", which ends with 'j' at given index.
+    // Returns start of the header or -1, if there isn't valid object header.
+    auto findObjectHeaderStart = [data](int index)
+    {
+        index -= 3;
+
+        auto skipWhitespace = [data, &index]()
+        {
+            const int start = index;
+            while (index >= 0 && PDFLexicalAnalyzer::isWhitespace(data[index]))
+            {
+                --index;
+            }
+            return index != start;
+        };
+
+        auto skipDigits = [data, &index]()
+        {
+            const int start = index;
+            while (index >= 0 && data[index] >= '0' && data[index] <= '9')
+            {
+                --index;
+            }
+            return index != start;
+        };
+
+        if (!skipWhitespace() || !skipDigits() || !skipWhitespace() || !skipDigits())
+        {
+            return -1;
+        }
+
+        if (index >= 0 && PDFLexicalAnalyzer::isRegular(data[index]))
+        {
+            return -1;
+        }
+
+        return index + 1;
+    };
+
+    int nextObjectMark = findNext(begin, 'j');
+    int nextStreamMark = findNext(begin, 'm');
+    while (nextObjectMark < end || nextStreamMark < end)
+    {
+        if (nextObjectMark < nextStreamMark)
+        {
+            const int index = nextObjectMark;
+            nextObjectMark = findNext(index + 1, 'j');
+
+            if (!matches(index, "obj", 3) || !isTerminated(index + 1))
+            {
+                continue;
+            }
+
+            if (matches(index, "endobj", 6))
+            {
+                markers.push_back(PDFRecoveryMarker{ PDFRecoveryMarker::Type::ObjectEnd, index + 1 });
+            }
+            else
+            {
+                const int headerStart = findObjectHeaderStart(index);
+                if (headerStart != -1)
+                {
+                    markers.push_back(PDFRecoveryMarker{ PDFRecoveryMarker::Type::ObjectStart, headerStart });
+                }
+            }
+        }
+        else
+        {
+            const int index = nextStreamMark;
+            nextStreamMark = findNext(index + 1, 'm');
+
+            if (!matches(index, "stream", 6))
+            {
+                continue;
+            }
+
+            if (matches(index, "endstream", 9))
+            {
+                if (isTerminated(index + 1))
+                {
+                    markers.push_back(PDFRecoveryMarker{ PDFRecoveryMarker::Type::StreamEnd, index + 1 });
+                }
+            }
+            else if (index + 1 < size && (data[index + 1] == '\r' || data[index + 1] == '\n'))
+            {
+                markers.push_back(PDFRecoveryMarker{ PDFRecoveryMarker::Type::StreamStart, index + 1 });
+            }
+        }
+    }
+
+    return markers;
+}
+
+/// Returns end of the stream (position after the "endstream" keyword) determined
+/// from the direct /Length entry of the stream dictionary. If stream doesn't have
+/// direct /Length, or "endstream" keyword is not found at the expected position,
+/// then -1 is returned.
+/// \param buffer Buffer
+/// \param objectStart Start of the object header "N G obj"
+/// \param streamStart Position after the "stream" keyword
+static int getDirectStreamEnd(const QByteArray& buffer, int objectStart, int streamStart)
+{
+    const int streamKeywordLength = static_cast<int>(std::strlen(PDF_STREAM_START_COMMAND));
+    const int streamEndKeywordLength = static_cast<int>(std::strlen(PDF_STREAM_END_COMMAND));
+    const char* data = buffer.constData();
+    const int size = buffer.size();
+
+    PDFInteger length = -1;
+    try
+    {
+        PDFParsingContext context([](PDFParsingContext*, PDFObjectReference){ return PDFObject(); });
+        PDFParser parser(data + objectStart, data + streamStart - streamKeywordLength, &context, PDFParser::None);
+        parser.getObject();
+        parser.getObject();
+        parser.fetchCommand(PDF_OBJECT_START_MARK);
+        PDFObject dictionaryObject = parser.getObject();
+
+        if (dictionaryObject.isDictionary())
+        {
+            const PDFObject& lengthObject = dictionaryObject.getDictionary()->get("Length");
+            if (lengthObject.isInt())
+            {
+                length = lengthObject.getInteger();
+            }
+        }
+    }
+    catch (const PDFException&)
+    {
+        return -1;
+    }
+
+    if (length < 0)
+    {
+        return -1;
+    }
+
+    // Stream keyword is followed either by CRLF, or by LF
+    int dataStart = streamStart;
+    if (dataStart < size && data[dataStart] == '\r')
+    {
+        ++dataStart;
+    }
+    if (dataStart < size && data[dataStart] == '\n')
+    {
+        ++dataStart;
+    }
+
+    if (length > size - dataStart)
+    {
+        return -1;
+    }
+
+    int dataEnd = dataStart + static_cast<int>(length);
+    while (dataEnd < size && PDFLexicalAnalyzer::isWhitespace(data[dataEnd]))
+    {
+        ++dataEnd;
+    }
+
+    if (dataEnd + streamEndKeywordLength <= size && std::memcmp(data + dataEnd, PDF_STREAM_END_COMMAND, streamEndKeywordLength) == 0)
+    {
+        return dataEnd + streamEndKeywordLength;
+    }
+
+    return -1;
+}
+
 PDFDocumentReader::PDFDocumentReader(PDFProgress* progress, const std::function<QString(bool*)>& getPasswordCallback, bool permissive, bool authorizeOwnerOnly) :
     m_result(Result::OK),
     m_getPasswordCallback(getPasswordCallback),
@@ -330,6 +552,27 @@ PDFDocumentReader::Result PDFDocumentReader::processReferenceTableEntries(PDFXRe
     return m_result;
 }
 
+QByteArray PDFDocumentReader::getDocumentId(const PDFDictionary* trailerDictionary)
+{
+    QByteArray id;
+
+    const PDFObject& idArrayObject = trailerDictionary->get("ID");
+    if (idArrayObject.isArray())
+    {
+        const PDFArray* idArray = idArrayObject.getArray();
+        if (idArray->getCount() > 0)
+        {
+            const PDFObject& idArrayItem = idArray->getItem(0);
+            if (idArrayItem.isString())
+            {
+                id = idArrayItem.getString();
+            }
+        }
+    }
+
+    return id;
+}
+
 PDFDocumentReader::Result PDFDocumentReader::processSecurityHandler(const PDFObject& trailerDictionaryObject,
                                                                     const std::vector<PDFXRefTable::Entry>& occupiedEntries,
                                                                     PDFObjectStorage::PDFObjects& objects)
@@ -350,20 +593,7 @@ PDFDocumentReader::Result PDFDocumentReader::processSecurityHandler(const PDFObj
     }
 
     // Read the document ID
-    QByteArray id;
-    const PDFObject& idArrayObject = trailerDictionary->get("ID");
-    if (idArrayObject.isArray())
-    {
-        const PDFArray* idArray = idArrayObject.getArray();
-        if (idArray->getCount() > 0)
-        {
-            const PDFObject& idArrayItem = idArray->getItem(0);
-            if (idArrayItem.isString())
-            {
-                id = idArrayItem.getString();
-            }
-        }
-    }
+    QByteArray id = getDocumentId(trailerDictionary);
 
     PDFObjectReference encryptObjectReference;
     PDFObject encryptObject = trailerDictionary->get("Encrypt");
@@ -403,6 +633,9 @@ PDFDocumentReader::Result PDFDocumentReader::processSecurityHandler(const PDFObj
     // because it needs object number and generation for generating the decrypt key. So 1) is handled
     // automatically. 2) is handled in the code below. 3) is handled also automatically, because we do not
     // decipher object streams here. 4) must be handled in the security handler.
+    //
+    // Strings are decrypted here, but content of streams is decrypted when stream data
+    // are accessed for the first time, so we do not decrypt all data when document is opened.
     if (m_securityHandler->getMode() != EncryptionMode::None)
     {
         auto decryptEntry = [this, encryptObjectReference, &objects](const PDFXRefTable::Entry& entry)
@@ -415,7 +648,7 @@ PDFDocumentReader::Result PDFDocumentReader::processSecurityHandler(const PDFObj
                 return;
             }
 
-            objects[entry.reference.objectNumber].object = m_securityHandler->decryptObject(objects[entry.reference.objectNumber].object, entry.reference);
+            objects[entry.reference.objectNumber].object = PDFSecurityHandler::decryptObjectLazily(m_securityHandler, objects[entry.reference.objectNumber].object, entry.reference);
         };
 
         progressStart(occupiedEntries.size(), PDFTranslationContext::tr("Decrypting encrypted contents of document..."));
@@ -560,6 +793,19 @@ PDFDocument PDFDocumentReader::readFromBuffer(const QByteArray& buffer)
             throw PDFException(tr("Empty xref table."));
         }
 
+        // Hash of the source data is computed in the background, while objects are being read
+        const PDFObject& trailerDictionaryObject = xrefTable.getTrailerDictionary();
+        const PDFDictionary* trailerDictionary = nullptr;
+        if (trailerDictionaryObject.isDictionary())
+        {
+            trailerDictionary = trailerDictionaryObject.getDictionary();
+        }
+        else if (trailerDictionaryObject.isStream())
+        {
+            trailerDictionary = trailerDictionaryObject.getStream()->getDictionary();
+        }
+        PDFDocumentIdentity identity = PDFDocumentIdentity::create(buffer, trailerDictionary ? getDocumentId(trailerDictionary) : QByteArray());
+
         PDFObjectStorage::PDFObjects objects;
         objects.resize(xrefTable.getSize());
 
@@ -584,7 +830,7 @@ PDFDocument PDFDocumentReader::readFromBuffer(const QByteArray& buffer)
         processObjectStreams(&xrefTable, objects);
 
         PDFObjectStorage storage(std::move(objects), PDFObject(xrefTable.getTrailerDictionary()), qMove(m_securityHandler));
-        return PDFDocument(std::move(storage), m_version, hash(buffer));
+        return PDFDocument(std::move(storage), m_version, qMove(identity));
     }
     catch (const PDFException &parserException)
     {
@@ -603,70 +849,120 @@ PDFDocument PDFDocumentReader::readFromBuffer(const QByteArray& buffer)
 
 QByteArray PDFDocumentReader::hash(const QByteArray& sourceData)
 {
-    return QCryptographicHash::hash(sourceData, QCryptographicHash::Sha256);
+    return PDFDocumentIdentity::computeHash(sourceData);
 }
 
 std::vector<std::pair<int, int>> PDFDocumentReader::findObjectByteOffsets(const QByteArray& buffer) const
 {
-    std::vector<std::pair<int, int>> offsets;
-    int lastOffset = 0;
-    const int shift = static_cast<int>(std::strlen(PDF_OBJECT_END_MARK));
-    while (lastOffset < buffer.size())
+    // Scan the buffer for markers. Buffer is divided into parts,
+    // which are scanned in parallel.
+    const int size = buffer.size();
+    const int partCount = qBound(1, size / RECOVERY_SCAN_PART_SIZE, 8 * PDFExecutionPolicy::getIdealThreadCount(PDFExecutionPolicy::Scope::Unknown));
+
+    std::vector<int> partIndices(partCount, 0);
+    std::iota(partIndices.begin(), partIndices.end(), 0);
+    std::vector<std::vector<PDFRecoveryMarker>> partMarkers(partCount);
+
+    auto scanPart = [&buffer, &partMarkers, size, partCount](int partIndex)
     {
-        int offset = buffer.indexOf(PDF_OBJECT_END_MARK, lastOffset);
+        const int begin = static_cast<int>(qint64(size) * partIndex / partCount);
+        const int end = static_cast<int>(qint64(size) * (partIndex + 1) / partCount);
+        partMarkers[partIndex] = scanRecoveryMarkers(buffer, begin, end);
+    };
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Unknown, partIndices.cbegin(), partIndices.cend(), scanPart);
 
-        // Object end mark was not found
-        if (offset == -1)
-        {
-            break;
-        }
+    std::vector<PDFRecoveryMarker> markers;
+    for (std::vector<PDFRecoveryMarker>& currentPartMarkers : partMarkers)
+    {
+        markers.insert(markers.end(), currentPartMarkers.cbegin(), currentPartMarkers.cend());
+        currentPartMarkers = std::vector<PDFRecoveryMarker>();
+    }
 
-        offset += shift;
+    // For each marker, find index of the next stream end marker
+    const size_t markerCount = markers.size();
+    std::vector<size_t> nextStreamEnd(markerCount + 1, markerCount);
+    for (size_t i = markerCount; i > 0; --i)
+    {
+        nextStreamEnd[i - 1] = (markers[i - 1].type == PDFRecoveryMarker::Type::StreamEnd) ? i - 1 : nextStreamEnd[i];
+    }
 
-        int startOffset = buffer.indexOf(PDF_OBJECT_START_MARK, lastOffset);
-        if (startOffset != -1 && startOffset < offset)
+    // Now, reconstruct object ranges from the markers
+    std::vector<std::pair<int, int>> offsets;
+    int objectStart = -1;
+    for (size_t i = 0; i < markerCount; ++i)
+    {
+        const PDFRecoveryMarker& marker = markers[i];
+        switch (marker.type)
         {
-            --startOffset;
-
-            // Skip whitespace between obj and generation number
-            while (startOffset >= 0 && PDFLexicalAnalyzer::isWhitespace(buffer[startOffset]))
+            case PDFRecoveryMarker::Type::ObjectStart:
             {
-                --startOffset;
-            }
+                // Previous object is not terminated by endobj (file is damaged),
+                // so we assume it ends, where the new object starts.
+                if (objectStart != -1 && objectStart < marker.offset)
+                {
+                    offsets.emplace_back(objectStart, marker.offset);
+                }
 
-            // Skip generation number
-            while (startOffset >= 0 && std::isdigit(buffer[startOffset]))
-            {
-                --startOffset;
+                objectStart = marker.offset;
+                break;
             }
 
-            // Skip whitespace between generation number and object number
-            while (startOffset >= 0 && PDFLexicalAnalyzer::isWhitespace(buffer[startOffset]))
+            case PDFRecoveryMarker::Type::ObjectEnd:
             {
-                --startOffset;
+                if (objectStart != -1)
+                {
+                    offsets.emplace_back(objectStart, marker.offset);
+                    objectStart = -1;
+                }
+                break;
             }
 
-            // Skip object number
-            while (startOffset >= 0 && std::isdigit(buffer[startOffset]))
+            case PDFRecoveryMarker::Type::StreamStart:
             {
-                --startOffset;
+                // Stream data can contain anything (including the markers), so skip
+                // them up to the end of the stream. End of the stream is determined
+                // from the direct /Length entry, if it fails, then next "endstream"
+                // is used. If stream has no end (truncated file), then we process
+                // markers as usual.
+                if (objectStart != -1)
+                {
+                    const int streamEnd = getDirectStreamEnd(buffer, objectStart, marker.offset);
+                    if (streamEnd != -1)
+                    {
+                        while (i + 1 < markerCount && markers[i + 1].offset <= streamEnd)
+                        {
+                            ++i;
+                        }
+                    }
+                    else if (nextStreamEnd[i] < markerCount)
+                    {
+                        i = nextStreamEnd[i];
+                    }
+                }
+                break;
             }
 
-            ++startOffset;
+            case PDFRecoveryMarker::Type::StreamEnd:
+                break;
 
-            if (startOffset < offset)
-            {
-                offsets.emplace_back(startOffset, offset);
-            }
+            default:
+                Q_ASSERT(false);
+                break;
         }
+    }
 
-        lastOffset = offset;
+    // Last object may be truncated
+    if (objectStart != -1 && objectStart < size)
+    {
+        offsets.emplace_back(objectStart, size);
     }
 
     return offsets;
 }
 
-bool PDFDocumentReader::restoreObjects(std::map<PDFObjectReference, PDFObject>& restoredObjects, const std::vector<std::pair<int, int>>& offsets)
+bool PDFDocumentReader::restoreObjects(std::map<PDFObjectReference, PDFObject>& restoredObjects,
+                                       const std::vector<std::pair<int, int>>& offsets,
+                                       std::vector<std::pair<int, int>>* failedOffsets)
 {
     QMutex restoredObjectsMutex;
     std::atomic_bool succesfull = true;
@@ -720,14 +1016,91 @@ bool PDFDocumentReader::restoreObjects(std::map<PDFObjectReference, PDFObject>&
         }
         catch (const PDFException&)
         {
-            // Do nothing
             succesfull = false;
+
+            if (failedOffsets)
+            {
+                QMutexLocker lock(&restoredObjectsMutex);
+                failedOffsets->push_back(offset);
+            }
         }
     };
     PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Unknown, offsets.cbegin(), offsets.cend(), processOffsetEntry);
     return succesfull;
 }
 
+PDFObject PDFDocumentReader::reconstructTrailerDictionary(const PDFObject& trailerDictionaryObject, const std::map<PDFObjectReference, PDFObject>& restoredObjects)
+{
+    Q_ASSERT(trailerDictionaryObject.isDictionary());
+
+    if (trailerDictionaryObject.getDictionary()->hasKey("Root"))
+    {
+        return trailerDictionaryObject;
+    }
+
+    // Trailer dictionary is missing, or it is damaged (for example, file is truncated).
+    // Cross reference streams contain trailer entries, so we try to use them. If
+    // we fail, we try to find the catalog.
+    PDFDictionary trailerDictionary = *trailerDictionaryObject.getDictionary();
+    PDFObjectReference catalogReference;
+
+    for (const auto& restoredObject : restoredObjects)
+    {
+        const PDFObject& object = restoredObject.second;
+        const PDFDictionary* dictionary = nullptr;
+
+        if (object.isStream())
+        {
+            dictionary = object.getStream()->getDictionary();
+        }
+        else if (object.isDictionary())
+        {
+            dictionary = object.getDictionary();
+        }
+
+        if (!dictionary)
+        {
+            continue;
+        }
+
+        const PDFObject& typeObject = dictionary->get("Type");
+        if (!typeObject.isName())
+        {
+            continue;
+        }
+
+        const QByteArray type = typeObject.getString();
+        if (type == "XRef" && object.isStream())
+        {
+            for (const char* key : { "Root", "Info", "ID", "Encrypt" })
+            {
+                const PDFObject& value = dictionary->get(key);
+                if (!value.isNull())
+                {
+                    trailerDictionary.setEntry(PDFInplaceOrMemoryString(key), PDFObject(value));
+                }
+            }
+        }
+        else if (type == "Catalog" && !catalogReference.isValid())
+        {
+            catalogReference = restoredObject.first;
+        }
+    }
+
+    if (!trailerDictionary.hasKey("Root") && catalogReference.isValid())
+    {
+        trailerDictionary.setEntry(PDFInplaceOrMemoryString("Root"), PDFObject::createReference(catalogReference));
+    }
+
+    if (!trailerDictionary.hasKey("Root"))
+    {
+        return trailerDictionaryObject;
+    }
+
+    m_warnings << tr("Trailer dictionary was reconstructed from document objects.");
+    return PDFObject::createDictionary(std::make_shared<PDFDictionary>(qMove(trailerDictionary)));
+}
+
 PDFDocument PDFDocumentReader::readDamagedDocumentFromBuffer(const QByteArray& buffer)
 {
     try
@@ -744,13 +1117,18 @@ PDFDocument PDFDocumentReader::readDamagedDocumentFromBuffer(const QByteArray& b
         }
 
         // Jakub Melka: Try to parse objects - read offsets of objects. We must probably
-        // try second pass, if some streams have referenced objects.
+        // try second pass, if some streams have referenced objects. Only objects,
+        // which failed in the first pass, are parsed again.
         std::vector<std::pair<int, int>> offsets = findObjectByteOffsets(buffer);
-        if (!restoreObjects(restoredObjects, offsets))
+        std::vector<std::pair<int, int>> failedOffsets;
+        if (!restoreObjects(restoredObjects, offsets, &failedOffsets))
         {
-            restoreObjects(restoredObjects, offsets);
+            std::sort(failedOffsets.begin(), failedOffsets.end());
+            restoreObjects(restoredObjects, failedOffsets, nullptr);
         }
 
+        trailerDictionaryObject = reconstructTrailerDictionary(trailerDictionaryObject, restoredObjects);
+
         // We will create security handler.
         PDFObjectStorage::PDFObjects objects;
         std::vector<PDFXRefTable::Entry> occupiedEntries;
@@ -773,8 +1151,9 @@ PDFDocument PDFDocumentReader::readDamagedDocumentFromBuffer(const QByteArray& b
             return PDFDocument();
         }
 
+        PDFDocumentIdentity identity = PDFDocumentIdentity::create(buffer, getDocumentId(trailerDictionaryObject.getDictionary()));
         PDFObjectStorage storage(std::move(objects), PDFObject(trailerDictionaryObject), qMove(m_securityHandler));
-        return PDFDocument(std::move(storage), m_version, QByteArray());
+        return PDFDocument(std::move(storage), m_version, qMove(identity));
     }
     catch (const PDFException &parserException)
     {
@@ -102,6 +102,11 @@ private:
     void checkHeader(const QByteArray& buffer);
     PDFInteger findXrefTableOffset(const QByteArray& buffer);
     Result processReferenceTableEntries(PDFXRefTable* xrefTable, const std::vector<PDFXRefTable::Entry>& occupiedEntries, PDFObjectStorage::PDFObjects& objects);
+
+    /// Returns first part of the document ID (from ID array in the trailer
+    /// dictionary). If document doesn't have an ID, empty array is returned.
+    static QByteArray getDocumentId(const PDFDictionary* trailerDictionary);
+
     Result processSecurityHandler(const PDFObject& trailerDictionaryObject, const std::vector<PDFXRefTable::Entry>& occupiedEntries, PDFObjectStorage::PDFObjects& objects);
     void processObjectStreams(PDFXRefTable* xrefTable, PDFObjectStorage::PDFObjects& objects);
 
@@ -117,7 +122,17 @@ private:
     /// second pass is needed. Returns true, if all object were correctly read.
     /// \param restoredObjects Map of restored objects
     /// \param offsets Offsets, from which are objects being read
-    bool restoreObjects(std::map<PDFObjectReference, PDFObject>& restoredObjects, const std::vector<std::pair<int, int>>& offsets);
+    /// \param failedOffsets Offsets of objects, which were not read (can be nullptr)
+    bool restoreObjects(std::map<PDFObjectReference, PDFObject>& restoredObjects,
+                        const std::vector<std::pair<int, int>>& offsets,
+                        std::vector<std::pair<int, int>>* failedOffsets);
+
+    /// Reconstructs trailer dictionary of damaged document, if it doesn't
+    /// contain reference to the catalog. Entries are taken from cross reference
+    /// streams, or catalog is found between restored objects.
+    /// \param trailerDictionaryObject Trailer dictionary read from the document
+    /// \param restoredObjects Restored objects
+    PDFObject reconstructTrailerDictionary(const PDFObject& trailerDictionaryObject, const std::map<PDFObjectReference, PDFObject>& restoredObjects);
 
     /// Fetch object from reference table
     PDFObject getObjectFromXrefTable(PDFXRefTable* xrefTable, PDFParsingContext* context, PDFObjectReference reference) const;
@@ -157,11 +157,26 @@ void PDFWriteObjectVisitor::visitDictionary(const PDFDictionary* dictionary)
 
 void PDFWriteObjectVisitor::visitStream(const PDFStream* stream)
 {
-    visitDictionary(stream->getDictionary());
+    const QByteArray* content = stream->getContent();
+    const PDFDictionary* dictionary = stream->getDictionary();
+
+    // Length entry can differ from the content size, if stream content
+    // was decrypted lazily (then it is the length of encrypted data).
+    const PDFObject& lengthObject = dictionary->get("Length");
+    if (!lengthObject.isInt() || lengthObject.getInteger() != content->size())
+    {
+        PDFDictionary updatedDictionary = *dictionary;
+        updatedDictionary.setEntry(PDFInplaceOrMemoryString("Length"), PDFObject::createInteger(content->size()));
+        visitDictionary(&updatedDictionary);
+    }
+    else
+    {
+        visitDictionary(dictionary);
+    }
 
     m_device->write("stream");
     m_device->write("\x0D\x0A");
-    m_device->write(*stream->getContent());
+    m_device->write(*content);
     m_device->write("\x0D\x0A");
     m_device->write("endstream");
     m_device->write("\x0D\x0A");
@@ -295,6 +310,12 @@ PDFOperationResult PDFDocumentWriter::write(QIODevice* device, const PDFDocument
             objectToWrite.accept(&visitor);
             writeObjectFooter(device);
         }
+        else if (m_serializedObjects && i < m_serializedObjects->size() && !(*m_serializedObjects)[i].isEmpty())
+        {
+            writeObjectHeader(device, PDFObjectReference(i, entry.generation));
+            device->write((*m_serializedObjects)[i]);
+            writeObjectFooter(device);
+        }
         else
         {
             PDFWriteObjectVisitor visitor(device);
@@ -72,6 +72,13 @@ public:
     /// \param object Object to be written
     static QByteArray getSerializedObject(const PDFObject& object);
 
+    /// Sets already serialized objects (see \p getSerializedObject), indexed by object number.
+    /// If serialized object is not empty, it is written instead of the object in the document.
+    /// This is useful, when multiple documents sharing the same objects are written. Serialized
+    /// objects are not used, if document is encrypted. Pointer must be valid during writing.
+    /// \param serializedObjects Serialized objects (or nullptr)
+    void setSerializedObjects(const std::vector<QByteArray>* serializedObjects) { m_serializedObjects = serializedObjects; }
+
 private:
     static void writeCRLF(QIODevice* device);
     static void writeObjectHeader(QIODevice* device, PDFObjectReference reference);
@@ -79,6 +86,9 @@ private:
 
     /// Progress indicator
     PDFProgress* m_progress;
+
+    /// Already serialized objects
+    const std::vector<QByteArray>* m_serializedObjects = nullptr;
 };
 
 }   // namespace pdf
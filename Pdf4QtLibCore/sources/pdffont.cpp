@@ -32,6 +32,7 @@
 #include <QFile>
 #include <QMutex>
 #include <QReadWriteLock>
+#include <QAtomicInteger>
 #include <QPainterPath>
 #include <QDataStream>
 
@@ -594,6 +595,9 @@ public:
 
     /// Returns character info
     virtual CharacterInfos getCharacterInfos() const = 0;
+
+    /// Returns storage of glyph outlines in unit size
+    virtual PDFGlyphOutlineStoragePointer getGlyphOutlineStorage() const { return nullptr; }
 };
 
 /// Implementation of the PDFRealizedFont class using PIMPL pattern for Type 3 fonts
@@ -617,27 +621,91 @@ private:
     PDFFontPointer m_parentFont;
 };
 
-/// Implementation of the PDFRealizedFont class using PIMPL pattern
-class PDFRealizedFontImpl : public IRealizedFontImpl
+/// Instance of the FreeType library shared by all fonts. FreeType library
+/// can be used from multiple threads, but creating and destroying of the faces
+/// must be serialized. Library is alive, until last face using it is destroyed.
+class PDFFreeTypeLibrary
 {
 public:
-    explicit PDFRealizedFontImpl();
-    virtual ~PDFRealizedFontImpl();
+    explicit PDFFreeTypeLibrary();
+    ~PDFFreeTypeLibrary();
 
-    virtual void fillTextSequence(const QByteArray& byteArray, TextSequence& textSequence, PDFRenderErrorReporter* reporter) override;
-    virtual bool isHorizontalWritingSystem() const override { return !m_isVertical; }
-    virtual void dumpFontToTreeItem(ITreeFactory* treeFactory) const override;
-    virtual QString getPostScriptName() const override { return m_postScriptName; }
-    virtual CharacterInfos getCharacterInfos() const override;
+    /// Returns shared instance of the library
+    static QSharedPointer<PDFFreeTypeLibrary> getInstance();
+
+    /// Creates new face from font data. Font data must be valid,
+    /// until face is destroyed.
+    /// \param fontData Font data
+    /// \param face Created face
+    FT_Error createFace(const QByteArray& fontData, FT_Face* face);
 
-    static constexpr const PDFReal PIXEL_SIZE_MULTIPLIER = 100.0;
+    /// Destroys the face created by this library
+    /// \param face Face
+    void destroyFace(FT_Face face);
 
 private:
-    friend class PDFRealizedFont;
+    QMutex m_mutex;
+    FT_Library m_library;
+    FT_Error m_error;
+};
 
-    static constexpr const PDFReal FONT_WIDTH_MULTIPLIER = 1.0 / 1000.0;
-    static constexpr const PDFReal FORMAT_26_6_MULTIPLIER = 1 / 64.0;
-    static constexpr const PDFReal FONT_MULTIPLIER = FORMAT_26_6_MULTIPLIER / PIXEL_SIZE_MULTIPLIER;
+PDFFreeTypeLibrary::PDFFreeTypeLibrary() :
+    m_library(nullptr),
+    m_error(0)
+{
+    m_error = FT_Init_FreeType(&m_library);
+}
+
+PDFFreeTypeLibrary::~PDFFreeTypeLibrary()
+{
+    if (m_library)
+    {
+        FT_Done_FreeType(m_library);
+        m_library = nullptr;
+    }
+}
+
+QSharedPointer<PDFFreeTypeLibrary> PDFFreeTypeLibrary::getInstance()
+{
+    static QMutex mutex;
+    static QWeakPointer<PDFFreeTypeLibrary> instance;
+
+    QMutexLocker lock(&mutex);
+    QSharedPointer<PDFFreeTypeLibrary> library = instance.toStrongRef();
+    if (!library)
+    {
+        library.reset(new PDFFreeTypeLibrary());
+        instance = library;
+    }
+
+    return library;
+}
+
+FT_Error PDFFreeTypeLibrary::createFace(const QByteArray& fontData, FT_Face* face)
+{
+    if (m_error)
+    {
+        return m_error;
+    }
+
+    QMutexLocker lock(&m_mutex);
+    return FT_New_Memory_Face(m_library, reinterpret_cast<const FT_Byte*>(fontData.constData()), fontData.size(), 0, face);
+}
+
+void PDFFreeTypeLibrary::destroyFace(FT_Face face)
+{
+    QMutexLocker lock(&m_mutex);
+    FT_Done_Face(face);
+}
+
+/// Glyph outlines of the font in unit size (em square has size 1.0). Outlines
+/// are shared between all realized fonts of the same font, regardless of their
+/// pixel size, scale to the pixel size is applied when text is drawn.
+class PDFGlyphOutlineStorage
+{
+public:
+    explicit PDFGlyphOutlineStorage();
+    ~PDFGlyphOutlineStorage();
 
     struct Glyph
     {
@@ -645,41 +713,66 @@ private:
         PDFReal advance = 0.0;
     };
 
-    static int outlineMoveTo(const FT_Vector* to, void* user);
-    static int outlineLineTo(const FT_Vector* to, void* user);
-    static int outlineConicTo(const FT_Vector* control, const FT_Vector* to, void* user);
-    static int outlineCubicTo(const FT_Vector* control1, const FT_Vector* control2, const FT_Vector* to, void* user);
+    /// Creates glyph outline storage for given font. If it fails,
+    /// then exception is thrown.
+    /// \param font Font
+    /// \param reporter Error reporter
+    static PDFGlyphOutlineStoragePointer createStorage(const PDFFontPointer& font, PDFRenderErrorReporter* reporter);
 
-    /// Get glyph for glyph index
+    /// Get glyph in unit size for glyph index
     const Glyph& getGlyph(unsigned int glyphIndex);
 
+    /// Returns true, if glyph with given index can be loaded
+    bool isGlyphValid(unsigned int glyphIndex);
+
+    /// Returns FreeType face of the font. Face can be used only for
+    /// functions, which doesn't alter the glyph slot of the face.
+    FT_Face getFace() const { return m_face; }
+
+    /// Returns true, if font is embedded
+    bool isEmbedded() const { return m_isEmbedded; }
+
+    /// Returns true, if font has vertical writing system
+    bool isVertical() const { return m_isVertical; }
+
+    /// Returns postscript name of the font
+    const QString& getPostScriptName() const { return m_postScriptName; }
+
+    /// Returns estimate of the memory consumed by glyph outlines (in bytes)
+    qint64 getMemoryConsumptionEstimate() const { return m_memoryConsumption.loadRelaxed(); }
+
     /// Function checks, if error occured, and if yes, then exception is thrown
     static void checkFreeTypeError(FT_Error error);
 
-    /// Read/write lock for accessing the glyph data
+private:
+    /// Pixel size of the face, in which glyphs are loaded. Glyph outlines are then
+    /// scaled to the unit size. It is large enough to make rounding error
+    /// of the 26.6 format negligible.
+    static constexpr const FT_UInt OUTLINE_PIXEL_SIZE = 1000;
+    static constexpr const PDFReal FORMAT_26_6_MULTIPLIER = 1 / 64.0;
+    static constexpr const PDFReal FONT_MULTIPLIER = FORMAT_26_6_MULTIPLIER / OUTLINE_PIXEL_SIZE;
+
+    static int outlineMoveTo(const FT_Vector* to, void* user);
+    static int outlineLineTo(const FT_Vector* to, void* user);
+    static int outlineConicTo(const FT_Vector* control, const FT_Vector* to, void* user);
+    static int outlineCubicTo(const FT_Vector* control1, const FT_Vector* control2, const FT_Vector* to, void* user);
+
+    /// Read/write lock for accessing the glyph data (and glyph slot of the face)
     QReadWriteLock m_readWriteLock;
 
-    /// Glyph cache, must be protected by the mutex above
+    /// Glyph cache, must be protected by the mutex above. Glyphs are
+    /// never removed, so pointers to them remain valid.
     std::unordered_map<unsigned int, Glyph> m_glyphCache;
 
-    /// For embedded fonts, this byte array contains embedded font data
-    QByteArray m_embeddedFontData;
+    /// Font data (either embedded font data, or system font data)
+    QByteArray m_fontData;
 
-    /// For system fonts, this byte array contains system font data
-    QByteArray m_systemFontData;
-
-    /// Instance of FreeType library assigned to this font
-    FT_Library m_library;
+    /// Shared instance of FreeType library
+    QSharedPointer<PDFFreeTypeLibrary> m_library;
 
     /// Face of the font
     FT_Face m_face;
 
-    /// Pixel size of the font
-    PDFReal m_pixelSize;
-
-    /// Parent font
-    PDFFontPointer m_parentFont;
-
     /// True, if font is embedded
     bool m_isEmbedded;
 
@@ -688,36 +781,224 @@ private:
 
     /// Postscript name of the font
     QString m_postScriptName;
+
+    /// Memory consumed by glyph outlines
+    QAtomicInteger<qint64> m_memoryConsumption;
 };
 
-PDFRealizedFontImpl::PDFRealizedFontImpl() :
-    m_library(nullptr),
+PDFGlyphOutlineStorage::PDFGlyphOutlineStorage() :
     m_face(nullptr),
-    m_pixelSize(0.0),
-    m_parentFont(nullptr),
     m_isEmbedded(false),
-    m_isVertical(false)
+    m_isVertical(false),
+    m_memoryConsumption(0)
 {
 
 }
 
-PDFRealizedFontImpl::~PDFRealizedFontImpl()
+PDFGlyphOutlineStorage::~PDFGlyphOutlineStorage()
 {
     if (m_face)
     {
-        FT_Done_Face(m_face);
+        m_library->destroyFace(m_face);
         m_face = nullptr;
     }
+}
 
-    if (m_library)
+PDFGlyphOutlineStoragePointer PDFGlyphOutlineStorage::createStorage(const PDFFontPointer& font, PDFRenderErrorReporter* reporter)
+{
+    PDFGlyphOutlineStoragePointer storage(new PDFGlyphOutlineStorage());
+
+    const PDFFontCMap* cmap = font->getCMap();
+    const FontDescriptor* descriptor = font->getFontDescriptor();
+    if (descriptor->isEmbedded())
     {
-        FT_Done_FreeType(m_library);
-        m_library = nullptr;
+        const QByteArray* embeddedFontData = descriptor->getEmbeddedFontData();
+        Q_ASSERT(embeddedFontData);
+        storage->m_fontData = *embeddedFontData;
+
+        // At this time, embedded font data should not be empty!
+        Q_ASSERT(!storage->m_fontData.isEmpty());
+        storage->m_isEmbedded = true;
+    }
+    else
+    {
+        StandardFontType standardFontType = StandardFontType::Invalid;
+        if (font->getFontType() == FontType::Type1 || font->getFontType() == FontType::MMType1)
+        {
+            Q_ASSERT(dynamic_cast<const PDFType1Font*>(font.get()));
+            const PDFType1Font* type1Font = static_cast<const PDFType1Font*>(font.get());
+            standardFontType = type1Font->getStandardFontType();
+        }
+
+        const PDFSystemFontInfoStorage* fontStorage = PDFSystemFontInfoStorage::getInstance();
+        storage->m_fontData = fontStorage->loadFont(font->getCIDSystemInfo(), descriptor, standardFontType, reporter);
+
+        if (storage->m_fontData.isEmpty())
+        {
+            throw PDFException(PDFTranslationContext::tr("Can't load system font '%1'.").arg(QString::fromLatin1(descriptor->fontName)));
+        }
+
+        storage->m_isEmbedded = false;
+    }
+
+    storage->m_library = PDFFreeTypeLibrary::getInstance();
+    checkFreeTypeError(storage->m_library->createFace(storage->m_fontData, &storage->m_face));
+    FT_Select_Charmap(storage->m_face, FT_ENCODING_UNICODE); // We try to select unicode encoding, but if it fails, we don't do anything (use glyph indices instead)
+    checkFreeTypeError(FT_Set_Pixel_Sizes(storage->m_face, 0, OUTLINE_PIXEL_SIZE));
+    storage->m_isVertical = cmap ? cmap->isVertical() : false;
+
+    if (!storage->m_isEmbedded)
+    {
+        if (const char* postScriptName = FT_Get_Postscript_Name(storage->m_face))
+        {
+            storage->m_postScriptName = QString::fromLatin1(postScriptName);
+        }
+    }
+
+    return storage;
+}
+
+int PDFGlyphOutlineStorage::outlineMoveTo(const FT_Vector* to, void* user)
+{
+    Glyph* glyph = reinterpret_cast<Glyph*>(user);
+    glyph->glyph.moveTo(to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
+    return 0;
+}
+
+int PDFGlyphOutlineStorage::outlineLineTo(const FT_Vector* to, void* user)
+{
+    Glyph* glyph = reinterpret_cast<Glyph*>(user);
+    glyph->glyph.lineTo(to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
+    return 0;
+}
+
+int PDFGlyphOutlineStorage::outlineConicTo(const FT_Vector* control, const FT_Vector* to, void* user)
+{
+    Glyph* glyph = reinterpret_cast<Glyph*>(user);
+    glyph->glyph.quadTo(control->x * FONT_MULTIPLIER, control->y * FONT_MULTIPLIER, to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
+    return 0;
+}
+
+int PDFGlyphOutlineStorage::outlineCubicTo(const FT_Vector* control1, const FT_Vector* control2, const FT_Vector* to, void* user)
+{
+    Glyph* glyph = reinterpret_cast<Glyph*>(user);
+    glyph->glyph.cubicTo(control1->x * FONT_MULTIPLIER, control1->y * FONT_MULTIPLIER, control2->x * FONT_MULTIPLIER, control2->y * FONT_MULTIPLIER, to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
+    return 0;
+}
+
+const PDFGlyphOutlineStorage::Glyph& PDFGlyphOutlineStorage::getGlyph(unsigned int glyphIndex)
+{
+    if (glyphIndex)
+    {
+        {
+            QReadLocker readLock(&m_readWriteLock);
+
+            // First look into cache
+            auto it = m_glyphCache.find(glyphIndex);
+            if (it != m_glyphCache.cend())
+            {
+                return it->second;
+            }
+        }
+
+        QWriteLocker writeLock(&m_readWriteLock);
+
+        // Glyph could be loaded by another thread in the meantime
+        auto it = m_glyphCache.find(glyphIndex);
+        if (it != m_glyphCache.cend())
+        {
+            return it->second;
+        }
+
+        Glyph glyph;
+
+        FT_Outline_Funcs glyphOutlineInterface;
+        glyphOutlineInterface.delta = 0;
+        glyphOutlineInterface.shift = 0;
+        glyphOutlineInterface.move_to = PDFGlyphOutlineStorage::outlineMoveTo;
+        glyphOutlineInterface.line_to = PDFGlyphOutlineStorage::outlineLineTo;
+        glyphOutlineInterface.conic_to = PDFGlyphOutlineStorage::outlineConicTo;
+        glyphOutlineInterface.cubic_to = PDFGlyphOutlineStorage::outlineCubicTo;
+
+        checkFreeTypeError(FT_Load_Glyph(m_face, glyphIndex, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING));
+        checkFreeTypeError(FT_Outline_Decompose(&m_face->glyph->outline, &glyphOutlineInterface, &glyph));
+        glyph.glyph.closeSubpath();
+        glyph.advance = !m_isVertical ? m_face->glyph->advance.x : m_face->glyph->advance.y;
+        glyph.advance *= FONT_MULTIPLIER;
+
+        m_memoryConsumption.fetchAndAddRelaxed(sizeof(Glyph) + sizeof(unsigned int) + glyph.glyph.elementCount() * sizeof(QPainterPath::Element));
+        it = m_glyphCache.insert(std::make_pair(glyphIndex, qMove(glyph))).first;
+        return it->second;
     }
+
+    static Glyph dummy;
+    return dummy;
+}
+
+bool PDFGlyphOutlineStorage::isGlyphValid(unsigned int glyphIndex)
+{
+    QWriteLocker writeLock(&m_readWriteLock);
+    return !FT_Load_Glyph(m_face, glyphIndex, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING);
+}
+
+void PDFGlyphOutlineStorage::checkFreeTypeError(FT_Error error)
+{
+    if (error)
+    {
+        QString message;
+        if (const char* errorString = FT_Error_String(error))
+        {
+            message = QString::fromLatin1(errorString);
+        }
+
+        throw PDFException(PDFTranslationContext::tr("FreeType error code %1: %2").arg(error).arg(message));
+    }
+}
+
+/// Implementation of the PDFRealizedFont class using PIMPL pattern. Glyph outlines
+/// are taken from the outline storage shared by all realized fonts of the same font.
+class PDFRealizedFontImpl : public IRealizedFontImpl
+{
+public:
+    explicit PDFRealizedFontImpl(PDFFontPointer parentFont, PDFReal pixelSize, PDFGlyphOutlineStoragePointer outlineStorage);
+    virtual ~PDFRealizedFontImpl() override = default;
+
+    virtual void fillTextSequence(const QByteArray& byteArray, TextSequence& textSequence, PDFRenderErrorReporter* reporter) override;
+    virtual bool isHorizontalWritingSystem() const override { return !m_outlineStorage->isVertical(); }
+    virtual void dumpFontToTreeItem(ITreeFactory* treeFactory) const override;
+    virtual QString getPostScriptName() const override { return m_outlineStorage->getPostScriptName(); }
+    virtual CharacterInfos getCharacterInfos() const override;
+    virtual PDFGlyphOutlineStoragePointer getGlyphOutlineStorage() const override { return m_outlineStorage; }
+
+private:
+    static constexpr const PDFReal FONT_WIDTH_MULTIPLIER = 1.0 / 1000.0;
+
+    /// Pixel size of the font
+    PDFReal m_pixelSize;
+
+    /// Parent font
+    PDFFontPointer m_parentFont;
+
+    /// Glyph outlines in unit size
+    PDFGlyphOutlineStoragePointer m_outlineStorage;
+
+    /// Face of the font (owned by outline storage)
+    FT_Face m_face;
+};
+
+PDFRealizedFontImpl::PDFRealizedFontImpl(PDFFontPointer parentFont, PDFReal pixelSize, PDFGlyphOutlineStoragePointer outlineStorage) :
+    m_pixelSize(pixelSize),
+    m_parentFont(qMove(parentFont)),
+    m_outlineStorage(qMove(outlineStorage)),
+    m_face(m_outlineStorage->getFace())
+{
+
 }
 
 void PDFRealizedFontImpl::fillTextSequence(const QByteArray& byteArray, TextSequence& textSequence, PDFRenderErrorReporter* reporter)
 {
+    textSequence.glyphScale = m_pixelSize;
+
     switch (m_parentFont->getFontType())
     {
         case FontType::Type1:
@@ -748,8 +1029,8 @@ void PDFRealizedFontImpl::fillTextSequence(const QByteArray& byteArray, TextSequ
 
                 if (glyphIndex)
                 {
-                    const Glyph& glyph = getGlyph(glyphIndex);
-                    textSequence.items.emplace_back(&glyph.glyph, (*encoding)[static_cast<uint8_t>(byteArray[i])], glyph.advance);
+                    const PDFGlyphOutlineStorage::Glyph& glyph = m_outlineStorage->getGlyph(glyphIndex);
+                    textSequence.items.emplace_back(&glyph.glyph, (*encoding)[static_cast<uint8_t>(byteArray[i])], glyph.advance * m_pixelSize);
                 }
                 else
                 {
@@ -783,8 +1064,8 @@ void PDFRealizedFontImpl::fillTextSequence(const QByteArray& byteArray, TextSequ
                 if (glyphIndex)
                 {
                     QChar character = toUnicode->getToUnicode(cid);
-                    const Glyph& glyph = getGlyph(glyphIndex);
-                    textSequence.items.emplace_back(&glyph.glyph, character, glyph.advance);
+                    const PDFGlyphOutlineStorage::Glyph& glyph = m_outlineStorage->getGlyph(glyphIndex);
+                    textSequence.items.emplace_back(&glyph.glyph, character, glyph.advance * m_pixelSize);
                 }
                 else
                 {
@@ -893,7 +1174,7 @@ CharacterInfos PDFRealizedFontImpl::getCharacterInfos() const
                         continue;
                     }
 
-                    if (!FT_Load_Glyph(m_face, gid, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING))
+                    if (m_outlineStorage->isGlyphValid(gid))
                     {
                         CharacterInfo info;
                         info.gid = gid;
@@ -1021,92 +1302,6 @@ void PDFRealizedFontImpl::dumpFontToTreeItem(ITreeFactory* treeFactory) const
     treeFactory->popItem();
 }
 
-int PDFRealizedFontImpl::outlineMoveTo(const FT_Vector* to, void* user)
-{
-    Glyph* glyph = reinterpret_cast<Glyph*>(user);
-    glyph->glyph.moveTo(to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
-    return 0;
-}
-
-int PDFRealizedFontImpl::outlineLineTo(const FT_Vector* to, void* user)
-{
-    Glyph* glyph = reinterpret_cast<Glyph*>(user);
-    glyph->glyph.lineTo(to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
-    return 0;
-}
-
-int PDFRealizedFontImpl::outlineConicTo(const FT_Vector* control, const FT_Vector* to, void* user)
-{
-    Glyph* glyph = reinterpret_cast<Glyph*>(user);
-    glyph->glyph.quadTo(control->x * FONT_MULTIPLIER, control->y * FONT_MULTIPLIER, to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
-    return 0;
-}
-
-int PDFRealizedFontImpl::outlineCubicTo(const FT_Vector* control1, const FT_Vector* control2, const FT_Vector* to, void* user)
-{
-    Glyph* glyph = reinterpret_cast<Glyph*>(user);
-    glyph->glyph.cubicTo(control1->x * FONT_MULTIPLIER, control1->y * FONT_MULTIPLIER, control2->x * FONT_MULTIPLIER, control2->y * FONT_MULTIPLIER, to->x * FONT_MULTIPLIER, to->y * FONT_MULTIPLIER);
-    return 0;
-}
-
-const PDFRealizedFontImpl::Glyph& PDFRealizedFontImpl::getGlyph(unsigned int glyphIndex)
-{
-    if (glyphIndex)
-    {
-        {
-            QReadLocker readLock(&m_readWriteLock);
-
-            // First look into cache
-            auto it = m_glyphCache.find(glyphIndex);
-            if (it != m_glyphCache.cend())
-            {
-                return it->second;
-            }
-        }
-
-        QWriteLocker writeLock(&m_readWriteLock);
-        Glyph glyph;
-
-        FT_Outline_Funcs glyphOutlineInterface;
-        glyphOutlineInterface.delta = 0;
-        glyphOutlineInterface.shift = 0;
-        glyphOutlineInterface.move_to = PDFRealizedFontImpl::outlineMoveTo;
-        glyphOutlineInterface.line_to = PDFRealizedFontImpl::outlineLineTo;
-        glyphOutlineInterface.conic_to = PDFRealizedFontImpl::outlineConicTo;
-        glyphOutlineInterface.cubic_to = PDFRealizedFontImpl::outlineCubicTo;
-
-        checkFreeTypeError(FT_Load_Glyph(m_face, glyphIndex, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING));
-        checkFreeTypeError(FT_Outline_Decompose(&m_face->glyph->outline, &glyphOutlineInterface, &glyph));
-        glyph.glyph.closeSubpath();
-        glyph.advance = !m_isVertical ? m_face->glyph->advance.x : m_face->glyph->advance.y;
-        glyph.advance *= FONT_MULTIPLIER;
-
-        auto it = m_glyphCache.find(glyphIndex);
-        if (it == m_glyphCache.cend())
-        {
-            it = m_glyphCache.insert(std::make_pair(glyphIndex, qMove(glyph))).first;
-        }
-        return it->second;
-    }
-
-    static Glyph dummy;
-    return dummy;
-}
-
-void PDFRealizedFontImpl::checkFreeTypeError(FT_Error error)
-{
-    if (error)
-    {
-        QString message;
-        if (const char* errorString = FT_Error_String(error))
-        {
-            message = QString::fromLatin1(errorString);
-        }
-
-        throw PDFException(PDFTranslationContext::tr("FreeType error code %1: %2").arg(error).arg(message));
-    }
-}
-
 PDFRealizedFont::~PDFRealizedFont()
 {
     delete m_impl;
@@ -1137,7 +1332,15 @@ CharacterInfos PDFRealizedFont::getCharacterInfos() const
     return m_impl->getCharacterInfos();
 }
 
-PDFRealizedFontPointer PDFRealizedFont::createRealizedFont(PDFFontPointer font, PDFReal pixelSize, PDFRenderErrorReporter* reporter)
+PDFGlyphOutlineStoragePointer PDFRealizedFont::getGlyphOutlineStorage() const
+{
+    return m_impl->getGlyphOutlineStorage();
+}
+
+PDFRealizedFontPointer PDFRealizedFont::createRealizedFont(PDFFontPointer font,
+                                                           PDFReal pixelSize,
+                                                           PDFRenderErrorReporter* reporter,
+                                                           PDFGlyphOutlineStoragePointer outlineStorage)
 {
     PDFRealizedFontPointer result;
 
@@ -1152,61 +1355,12 @@ PDFRealizedFontPointer PDFRealizedFont::createRealizedFont(PDFFontPointer font,
     }
     else
     {
-        std::unique_ptr<PDFRealizedFontImpl> implPtr(new PDFRealizedFontImpl());
-
-        PDFRealizedFontImpl* impl = implPtr.get();
-        impl->m_parentFont = font;
-        impl->m_pixelSize = pixelSize;
-
-        const PDFFontCMap* cmap = font->getCMap();
-        const FontDescriptor* descriptor = font->getFontDescriptor();
-        if (descriptor->isEmbedded())
+        if (!outlineStorage)
         {
-            PDFRealizedFontImpl::checkFreeTypeError(FT_Init_FreeType(&impl->m_library));
-            const QByteArray* embeddedFontData = descriptor->getEmbeddedFontData();
-            Q_ASSERT(embeddedFontData);
-            impl->m_embeddedFontData = *embeddedFontData;
-
-            // At this time, embedded font data should not be empty!
-            Q_ASSERT(!impl->m_embeddedFontData.isEmpty());
-
-            PDFRealizedFontImpl::checkFreeTypeError(FT_New_Memory_Face(impl->m_library, reinterpret_cast<const FT_Byte*>(impl->m_embeddedFontData.constData()), impl->m_embeddedFontData.size(), 0, &impl->m_face));
-            FT_Select_Charmap(impl->m_face, FT_ENCODING_UNICODE); // We try to select unicode encoding, but if it fails, we don't do anything (use glyph indices instead)
-            PDFRealizedFontImpl::checkFreeTypeError(FT_Set_Pixel_Sizes(impl->m_face, 0, qRound(pixelSize * PDFRealizedFontImpl::PIXEL_SIZE_MULTIPLIER)));
-            impl->m_isVertical = cmap ? cmap->isVertical() : false;
-            impl->m_isEmbedded = true;
-            result.reset(new PDFRealizedFont(implPtr.release()));
+            outlineStorage = PDFGlyphOutlineStorage::createStorage(font, reporter);
         }
-        else
-        {
-            StandardFontType standardFontType = StandardFontType::Invalid;
-            if (font->getFontType() == FontType::Type1 || font->getFontType() == FontType::MMType1)
-            {
-                Q_ASSERT(dynamic_cast<const PDFType1Font*>(font.get()));
-                const PDFType1Font* type1Font = static_cast<const PDFType1Font*>(font.get());
-                standardFontType = type1Font->getStandardFontType();
-            }
 
-            const PDFSystemFontInfoStorage* fontStorage = PDFSystemFontInfoStorage::getInstance();
-            impl->m_systemFontData = fontStorage->loadFont(font->getCIDSystemInfo(), descriptor, standardFontType, reporter);
-
-            if (impl->m_systemFontData.isEmpty())
-            {
-                throw PDFException(PDFTranslationContext::tr("Can't load system font '%1'.").arg(QString::fromLatin1(descriptor->fontName)));
-            }
-
-            PDFRealizedFontImpl::checkFreeTypeError(FT_Init_FreeType(&impl->m_library));
-            PDFRealizedFontImpl::checkFreeTypeError(FT_New_Memory_Face(impl->m_library, reinterpret_cast<const FT_Byte*>(impl->m_systemFontData.constData()), impl->m_systemFontData.size(), 0, &impl->m_face));
-            FT_Select_Charmap(impl->m_face, FT_ENCODING_UNICODE); // We try to select unicode encoding, but if it fails, we don't do anything (use glyph indices instead)
-            PDFRealizedFontImpl::checkFreeTypeError(FT_Set_Pixel_Sizes(impl->m_face, 0, qRound(pixelSize * PDFRealizedFontImpl::PIXEL_SIZE_MULTIPLIER)));
-            impl->m_isVertical = cmap ? cmap->isVertical() : false;
-            impl->m_isEmbedded = false;
-            if (const char* postScriptName = FT_Get_Postscript_Name(impl->m_face))
-            {
-                impl->m_postScriptName = QString::fromLatin1(postScriptName);
-            }
-            result.reset(new PDFRealizedFont(implPtr.release()));
-        }
+        result.reset(new PDFRealizedFont(new PDFRealizedFontImpl(font, pixelSize, qMove(outlineStorage))));
     }
 
     return result;
@@ -1521,120 +1675,115 @@ PDFFontPointer PDFFont::createFont(const PDFObject& object, const PDFDocument* d
                 const QByteArray* embeddedFontData = fontDescriptor.getEmbeddedFontData();
                 Q_ASSERT(embeddedFontData);
 
-                FT_Library library;
-                if (!FT_Init_FreeType(&library))
+                QSharedPointer<PDFFreeTypeLibrary> library = PDFFreeTypeLibrary::getInstance();
+                FT_Face face;
+                if (!library->createFace(*embeddedFontData, &face))
                 {
-                    FT_Face face;
-                    if (!FT_New_Memory_Face(library, reinterpret_cast<const FT_Byte*>(embeddedFontData->constData()), embeddedFontData->size(), 0, &face))
+                    if (FT_Has_PS_Glyph_Names(face))
                     {
-                        if (FT_Has_PS_Glyph_Names(face))
+                        for (FT_Int i = 0; i < face->num_charmaps; ++i)
                         {
-                            for (FT_Int i = 0; i < face->num_charmaps; ++i)
+                            FT_CharMap charMap = face->charmaps[i];
+                            switch (charMap->encoding)
                             {
-                                FT_CharMap charMap = face->charmaps[i];
-                                switch (charMap->encoding)
+                                case FT_ENCODING_ADOBE_STANDARD:
+                                case FT_ENCODING_ADOBE_LATIN_1:
+                                case FT_ENCODING_ADOBE_CUSTOM:
+                                case FT_ENCODING_ADOBE_EXPERT:
                                 {
-                                    case FT_ENCODING_ADOBE_STANDARD:
-                                    case FT_ENCODING_ADOBE_LATIN_1:
-                                    case FT_ENCODING_ADOBE_CUSTOM:
-                                    case FT_ENCODING_ADOBE_EXPERT:
+                                    // Try to load data from the encoding
+                                    if (!FT_Set_Charmap(face, charMap))
                                     {
-                                        // Try to load data from the encoding
-                                        if (!FT_Set_Charmap(face, charMap))
+                                        for (size_t iTable = 0; iTable < simpleFontEncodingTable.size(); ++iTable)
                                         {
-                                            for (size_t iTable = 0; iTable < simpleFontEncodingTable.size(); ++iTable)
+                                            FT_UInt glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable));
+
+                                            if (glyphIndex == 0)
                                             {
-                                                FT_UInt glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable));
+                                                glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable + 0xF000));
+                                            }
 
-                                                if (glyphIndex == 0)
-                                                {
-                                                    glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable + 0xF000));
-                                                }
+                                            if (glyphIndex == 0)
+                                            {
+                                                glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable + 0xF100));
+                                            }
 
-                                                if (glyphIndex == 0)
-                                                {
-                                                    glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(iTable + 0xF100));
-                                                }
+                                            if (glyphIndex > 0)
+                                            {
+                                                // Fill the glyph index array
+                                                glyphIndexArray[iTable] = glyphIndex;
 
-                                                if (glyphIndex > 0)
+                                                // Set mapping to unicode
+                                                char buffer[128] = { };
+                                                if (!FT_Get_Glyph_Name(face, glyphIndex, buffer, static_cast<FT_ULong>(std::size(buffer))))
                                                 {
-                                                    // Fill the glyph index array
-                                                    glyphIndexArray[iTable] = glyphIndex;
-
-                                                    // Set mapping to unicode
-                                                    char buffer[128] = { };
-                                                    if (!FT_Get_Glyph_Name(face, glyphIndex, buffer, static_cast<FT_ULong>(std::size(buffer))))
+                                                    QByteArray byteArrayBuffer(buffer);
+                                                    QChar character = PDFNameToUnicode::getUnicodeForName(byteArrayBuffer);
+                                                    if (character.isNull())
+                                                    {
+                                                        character = PDFNameToUnicode::getUnicodeForNameZapfDingbats(byteArrayBuffer);
+                                                    }
+                                                    if (!character.isNull())
                                                     {
-                                                        QByteArray byteArrayBuffer(buffer);
-                                                        QChar character = PDFNameToUnicode::getUnicodeForName(byteArrayBuffer);
-                                                        if (character.isNull())
-                                                        {
-                                                            character = PDFNameToUnicode::getUnicodeForNameZapfDingbats(byteArrayBuffer);
-                                                        }
-                                                        if (!character.isNull())
-                                                        {
-                                                            encoding = PDFEncoding::Encoding::Custom;
-                                                            simpleFontEncodingTable[iTable] = character;
-                                                        }
+                                                        encoding = PDFEncoding::Encoding::Custom;
+                                                        simpleFontEncodingTable[iTable] = character;
                                                     }
                                                 }
                                             }
                                         }
-
-                                        break;
                                     }
 
-                                    default:
-                                        break;
+                                    break;
                                 }
+
+                                default:
+                                    break;
                             }
                         }
-                        else if (!FT_Select_Charmap(face, FT_ENCODING_UNICODE))
-                        {
-                            // if we have unicode mapping (3, 1), then we want to skip
-                            // Mac Roman Encoding, according to PDF Specification 2.0.
-                            // We will load encoding using unicode character map below.
-                        }
-                        else if (!FT_Select_Charmap(face, FT_ENCODING_APPLE_ROMAN))
-                        {
-                            // We have (1, 0) Mac Roman Encoding, which is slightly different, than Mac Roman Encoding defined
-                            // in PDF (for 15 characters).
-                            simpleFontEncodingTable = *PDFEncoding::getTableForEncoding(PDFEncoding::Encoding::MacOsRoman);
-                            encoding = PDFEncoding::Encoding::Custom;
+                    }
+                    else if (!FT_Select_Charmap(face, FT_ENCODING_UNICODE))
+                    {
+                        // if we have unicode mapping (3, 1), then we want to skip
+                        // Mac Roman Encoding, according to PDF Specification 2.0.
+                        // We will load encoding using unicode character map below.
+                    }
+                    else if (!FT_Select_Charmap(face, FT_ENCODING_APPLE_ROMAN))
+                    {
+                        // We have (1, 0) Mac Roman Encoding, which is slightly different, than Mac Roman Encoding defined
+                        // in PDF (for 15 characters).
+                        simpleFontEncodingTable = *PDFEncoding::getTableForEncoding(PDFEncoding::Encoding::MacOsRoman);
+                        encoding = PDFEncoding::Encoding::Custom;
 
-                            for (size_t i = 0; i < simpleFontEncodingTable.size(); ++i)
+                        for (size_t i = 0; i < simpleFontEncodingTable.size(); ++i)
+                        {
+                            FT_UInt glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(i));
+                            if (glyphIndex > 0)
                             {
-                                FT_UInt glyphIndex = FT_Get_Char_Index(face, static_cast<FT_ULong>(i));
-                                if (glyphIndex > 0)
-                                {
-                                    glyphIndexArray[i] = glyphIndex;
-                                }
+                                glyphIndexArray[i] = glyphIndex;
                             }
                         }
+                    }
 
-                        finishFont();
+                    finishFont();
 
-                        // Fill the glyph index array from unicode, if we have unicode mapping
-                        if (!FT_Select_Charmap(face, FT_ENCODING_UNICODE))
+                    // Fill the glyph index array from unicode, if we have unicode mapping
+                    if (!FT_Select_Charmap(face, FT_ENCODING_UNICODE))
+                    {
+                        for (size_t i = 0; i < simpleFontEncodingTable.size(); ++i)
                         {
-                            for (size_t i = 0; i < simpleFontEncodingTable.size(); ++i)
+                            QChar character = simpleFontEncodingTable[i];
+                            if (!character.isNull() && character != QChar(QChar::SpecialCharacter::ReplacementCharacter))
                             {
-                                QChar character = simpleFontEncodingTable[i];
-                                if (!character.isNull() && character != QChar(QChar::SpecialCharacter::ReplacementCharacter))
+                                const FT_UInt glyphIndex = FT_Get_Char_Index(face, character.unicode());
+                                if (glyphIndex > 0)
                                 {
-                                    const FT_UInt glyphIndex = FT_Get_Char_Index(face, character.unicode());
-                                    if (glyphIndex > 0)
-                                    {
-                                        glyphIndexArray[i] = glyphIndex;
-                                    }
+                                    glyphIndexArray[i] = glyphIndex;
                                 }
                             }
                         }
-
-                        FT_Done_Face(face);
                     }
 
-                    FT_Done_FreeType(library);
+                    library->destroyFace(face);
                 }
             }
             else
@@ -2064,6 +2213,7 @@ void PDFFontCache::setDocument(const PDFModifiedDocument& document)
         {
             m_fontCache.clear();
             m_realizedFontCache.clear();
+            m_glyphOutlineCache.clear();
         }
     }
 }
@@ -2108,12 +2258,26 @@ PDFRealizedFontPointer PDFFontCache::getRealizedFont(const PDFFontPointer& font,
     auto it = m_realizedFontCache.find(std::make_pair(font, size));
     if (it == m_realizedFontCache.cend())
     {
-        // We must create the realized font
-        PDFRealizedFontPointer realizedFont = PDFRealizedFont::createRealizedFont(font, size, reporter);
+        // We must create the realized font. Glyph outlines are shared between
+        // all realized fonts of the same font, so we reuse them, if they exist.
+        PDFGlyphOutlineStoragePointer outlineStorage;
+        auto outlineIt = m_glyphOutlineCache.find(font);
+        if (outlineIt != m_glyphOutlineCache.cend())
+        {
+            outlineStorage = outlineIt->second;
+        }
 
-        if (m_fontCacheShrinkDisabledObjects.empty() && m_realizedFontCache.size() >= m_realizedFontCacheLimit)
+        PDFRealizedFontPointer realizedFont = PDFRealizedFont::createRealizedFont(font, size, reporter, outlineStorage);
+
+        if (m_fontCacheShrinkDisabledObjects.empty() && (m_realizedFontCache.size() >= m_realizedFontCacheLimit || getGlyphOutlineMemoryConsumptionImpl() > m_glyphOutlineCacheLimit))
         {
             m_realizedFontCache.clear();
+            m_glyphOutlineCache.clear();
+        }
+
+        if (PDFGlyphOutlineStoragePointer realizedOutlineStorage = realizedFont->getGlyphOutlineStorage())
+        {
+            m_glyphOutlineCache[font] = qMove(realizedOutlineStorage);
         }
 
         it = m_realizedFontCache.insert(std::make_pair(std::make_pair(font, size), qMove(realizedFont))).first;
@@ -2156,13 +2320,41 @@ void PDFFontCache::shrink()
         {
             m_fontCache.clear();
         }
-        if (m_realizedFontCache.size() >= m_realizedFontCacheLimit)
+        if (m_realizedFontCache.size() >= m_realizedFontCacheLimit || getGlyphOutlineMemoryConsumptionImpl() > m_glyphOutlineCacheLimit)
         {
             m_realizedFontCache.clear();
+            m_glyphOutlineCache.clear();
         }
     }
 }
 
+void PDFFontCache::setGlyphOutlineCacheLimit(qint64 glyphOutlineCacheLimit)
+{
+    if (m_glyphOutlineCacheLimit != glyphOutlineCacheLimit)
+    {
+        m_glyphOutlineCacheLimit = glyphOutlineCacheLimit;
+        shrink();
+    }
+}
+
+qint64 PDFFontCache::getGlyphOutlineMemoryConsumption() const
+{
+    QMutexLocker lock(&m_mutex);
+    return getGlyphOutlineMemoryConsumptionImpl();
+}
+
+qint64 PDFFontCache::getGlyphOutlineMemoryConsumptionImpl() const
+{
+    qint64 memoryConsumption = 0;
+
+    for (const auto& item : m_glyphOutlineCache)
+    {
+        memoryConsumption += item.second->getMemoryConsumptionEstimate();
+    }
+
+    return memoryConsumption;
+}
+
 const QByteArray* FontDescriptor::getEmbeddedFontData() const
 {
     if (!fontFile.isEmpty())
@@ -2183,20 +2375,7 @@ const QByteArray* FontDescriptor::getEmbeddedFontData() const
 
 PDFFontCMap PDFFontCMap::createFromName(const QByteArray& name)
 {
-    QFile file(QString(":/cmaps/%1").arg(QString::fromLatin1(name)));
-    if (file.exists())
-    {
-        QByteArray data;
-        if (file.open(QFile::ReadOnly))
-        {
-            data = file.readAll();
-            file.close();
-        }
-
-        return createFromData(data);
-    }
-
-    throw PDFException(PDFTranslationContext::tr("Can't load CID font mapping named '%1'.").arg(QString::fromLatin1(name)));
+    return PDFFontCMapRepository::getInstance()->getCMap(name);
 }
 
 PDFFontCMap PDFFontCMap::createFromData(const QByteArray& data)
@@ -2449,12 +2628,19 @@ PDFFontCMap PDFFontCMap::deserialize(const QByteArray& byteArray)
         result.m_entries.push_back(entry);
     }
 
+    result.compile();
     return result;
 }
 
 std::vector<CID> PDFFontCMap::interpret(const QByteArray& byteArray) const
 {
     std::vector<CID> result;
+
+    if (!m_lookup || m_maxKeyLength == 0)
+    {
+        return result;
+    }
+
     result.reserve(byteArray.size() / m_maxKeyLength);
 
     unsigned int value = 0;
@@ -2466,17 +2652,15 @@ std::vector<CID> PDFFontCMap::interpret(const QByteArray& byteArray) const
         ++scannedBytes;
 
         // Find suitable mapping
-        auto it = std::find_if(m_entries.cbegin(), m_entries.cend(), [value, scannedBytes](const Entry& entry) { return entry.from <= value && entry.to >= value && entry.byteCount == scannedBytes; });
-        if (it != m_entries.cend())
+        CID cid = 0;
+        if (scannedBytes <= CompiledLookup::MAX_BYTE_COUNT && m_lookup->codeLookups[scannedBytes - 1].find(value, cid))
         {
-            const Entry& entry = *it;
-            const CID cid = value - entry.from + entry.cid;
             result.push_back(cid);
 
             value = 0;
             scannedBytes = 0;
         }
-        else if (scannedBytes == m_maxKeyLength)
+        else if (scannedBytes >= m_maxKeyLength)
         {
             // This means error occured - fill empty CID
             result.push_back(0);
@@ -2490,13 +2674,11 @@ std::vector<CID> PDFFontCMap::interpret(const QByteArray& byteArray) const
 
 QChar PDFFontCMap::getToUnicode(CID cid) const
 {
-    if (isValid())
+    if (isValid() && m_lookup)
     {
-        auto it = std::find_if(m_entries.cbegin(), m_entries.cend(), [cid](const Entry& entry) { return entry.from <= cid && entry.to >= cid; });
-        if (it != m_entries.cend())
+        CID unicodeCID = 0;
+        if (m_lookup->toUnicodeLookup.find(cid, unicodeCID))
         {
-            const Entry& entry = *it;
-            const CID unicodeCID = cid - entry.from + entry.cid;
             return QChar(unicodeCID);
         }
     }
@@ -2510,6 +2692,134 @@ PDFFontCMap::PDFFontCMap(Entries&& entries, bool vertical) :
     m_vertical(vertical)
 {
     m_maxKeyLength = std::accumulate(m_entries.cbegin(), m_entries.cend(), 0, [](unsigned int a, const Entry& b) { return qMax(a, b.byteCount); });
+    compile();
+}
+
+void PDFFontCMap::compile()
+{
+    std::shared_ptr<CompiledLookup> lookup = std::make_shared<CompiledLookup>();
+
+    for (unsigned int i = 0; i < CompiledLookup::MAX_BYTE_COUNT; ++i)
+    {
+        lookup->codeLookups[i] = Lookup::create(m_entries, i + 1);
+    }
+    lookup->toUnicodeLookup = Lookup::create(m_entries, 0);
+
+    m_lookup = qMove(lookup);
+}
+
+PDFFontCMap::Lookup PDFFontCMap::Lookup::create(const Entries& entries, unsigned int byteCount)
+{
+    Lookup lookup;
+
+    // Disjoint intervals, key is start of the interval. Entries are processed
+    // in the order of priority, so only part of the entry, which is not covered
+    // by previous entries, is inserted.
+    std::map<unsigned int, Entry> intervals;
+
+    for (const Entry& entry : entries)
+    {
+        if ((byteCount != 0 && entry.byteCount != byteCount) || entry.from > entry.to)
+        {
+            continue;
+        }
+
+        auto it = intervals.upper_bound(entry.from);
+        if (it != intervals.begin())
+        {
+            auto previousIt = std::prev(it);
+            if (previousIt->second.to >= entry.from)
+            {
+                it = previousIt;
+            }
+        }
+
+        quint64 current = entry.from;
+        auto insertUncovered = [&](quint64 last)
+        {
+            if (current <= last)
+            {
+                const unsigned int from = static_cast<unsigned int>(current);
+                const unsigned int to = static_cast<unsigned int>(last);
+                const CID cid = entry.cid + (from - entry.from);
+                intervals.emplace(from, Entry(from, to, entry.byteCount, cid));
+            }
+        };
+
+        for (; it != intervals.end() && it->second.from <= entry.to; ++it)
+        {
+            if (it->second.from > 0)
+            {
+                insertUncovered(quint64(it->second.from) - 1);
+            }
+            current = qMax(current, quint64(it->second.to) + 1);
+        }
+        insertUncovered(entry.to);
+    }
+
+    lookup.m_intervals.reserve(intervals.size());
+    for (const auto& item : intervals)
+    {
+        const Entry& interval = item.second;
+        lookup.m_intervals.push_back(interval);
+
+        // Fill direct table
+        for (quint64 code = interval.from; code <= interval.to && code < DIRECT_TABLE_SIZE; ++code)
+        {
+            lookup.m_directTable[code] = static_cast<CID>(interval.cid + (code - interval.from));
+            lookup.m_directTableMapped.set(code);
+        }
+    }
+
+    // Fill page index
+    auto intervalIt = lookup.m_intervals.cbegin();
+    for (unsigned int page = 0; page <= PAGE_COUNT; ++page)
+    {
+        const unsigned int pageStart = page << 8;
+        while (intervalIt != lookup.m_intervals.cend() && intervalIt->to < pageStart)
+        {
+            ++intervalIt;
+        }
+        lookup.m_pages[page] = static_cast<unsigned int>(std::distance(lookup.m_intervals.cbegin(), intervalIt));
+    }
+
+    return lookup;
+}
+
+bool PDFFontCMap::Lookup::findInIntervals(unsigned int code, CID& cid) const
+{
+    const unsigned int page = code >> 8;
+
+    // Interval containing the code can't be before the first interval
+    // ending in the page, and it can't be after the first interval ending in the
+    // next page (intervals are disjoint and sorted).
+    size_t first = 0;
+    size_t last = m_intervals.size();
+
+    if (page < PAGE_COUNT)
+    {
+        first = m_pages[page];
+        last = qMin<size_t>(size_t(m_pages[page + 1]) + 1, m_intervals.size());
+    }
+    else
+    {
+        first = m_pages[PAGE_COUNT];
+    }
+
+    auto begin = std::next(m_intervals.cbegin(), first);
+    auto end = std::next(m_intervals.cbegin(), last);
+    auto it = std::upper_bound(begin, end, code, [](unsigned int value, const Entry& entry) { return value < entry.from; });
+    if (it != begin)
+    {
+        --it;
+        if (it->to >= code)
+        {
+            cid = code - it->from + it->cid;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 PDFFontCMap::Entries PDFFontCMap::optimize(const PDFFontCMap::Entries& entries)
@@ -2594,6 +2904,55 @@ bool PDFFontCMapRepository::loadFromFile(const QString& fileName)
     return false;
 }
 
+void PDFFontCMapRepository::clear()
+{
+    m_cmaps.clear();
+
+    QMutexLocker lock(&m_parsedCMapsMutex);
+    m_parsedCMaps.clear();
+}
+
+PDFFontCMap PDFFontCMapRepository::getCMap(const QByteArray& name)
+{
+    {
+        QMutexLocker lock(&m_parsedCMapsMutex);
+        auto it = m_parsedCMaps.find(name);
+        if (it != m_parsedCMaps.cend())
+        {
+            return it->second;
+        }
+    }
+
+    // Parse the CMap without lock held, because CMap can use another
+    // predefined CMap (usecmap operator).
+    PDFFontCMap cmap;
+    auto serializedIt = m_cmaps.find(name);
+    if (serializedIt != m_cmaps.cend())
+    {
+        cmap = PDFFontCMap::deserialize(serializedIt->second);
+    }
+    else
+    {
+        QFile file(QString(":/cmaps/%1").arg(QString::fromLatin1(name)));
+        if (!file.exists())
+        {
+            throw PDFException(PDFTranslationContext::tr("Can't load CID font mapping named '%1'.").arg(QString::fromLatin1(name)));
+        }
+
+        QByteArray data;
+        if (file.open(QFile::ReadOnly))
+        {
+            data = file.readAll();
+            file.close();
+        }
+
+        cmap = PDFFontCMap::createFromData(data);
+    }
+
+    QMutexLocker lock(&m_parsedCMapsMutex);
+    return m_parsedCMaps.emplace(name, qMove(cmap)).first->second;
+}
+
 PDFFontCMapRepository::PDFFontCMapRepository()
 {
 
@@ -28,6 +28,9 @@
 #include <QSharedPointer>
 
 #include <set>
+#include <array>
+#include <bitset>
+#include <memory>
 #include <unordered_map>
 
 class QPainterPath;
@@ -88,6 +91,10 @@ struct TextSequenceItem
 struct TextSequence
 {
     std::vector<TextSequenceItem> items;
+
+    /// Glyph outlines are stored in unit size (so they can be shared between
+    /// all sizes of the font), this is scale, which must be applied to them.
+    PDFReal glyphScale = 1.0;
 };
 
 constexpr bool isTextRenderingModeFilled(TextRenderingMode mode)
@@ -253,6 +260,9 @@ struct CharacterInfo
 };
 using CharacterInfos = std::vector<CharacterInfo>;
 
+class PDFGlyphOutlineStorage;
+using PDFGlyphOutlineStoragePointer = QSharedPointer<PDFGlyphOutlineStorage>;
+
 /// Font, which has fixed pixel size. It is programmed as PIMPL, because we need
 /// to remove FreeType types from the interface (so we do not include FreeType in the interface).
 class PDF4QTLIBCORESHARED_EXPORT PDFRealizedFont
@@ -279,9 +289,22 @@ public:
     /// Returns character info
     CharacterInfos getCharacterInfos() const;
 
+    /// Returns storage of unit size glyph outlines used by this font (or nullptr,
+    /// if font doesn't have glyph outlines, for example, Type 3 font)
+    PDFGlyphOutlineStoragePointer getGlyphOutlineStorage() const;
+
     /// Creates new realized font from the standard font. If font can't be created,
-    /// then exception is thrown.
-    static PDFRealizedFontPointer createRealizedFont(PDFFontPointer font, PDFReal pixelSize, PDFRenderErrorReporter* reporter);
+    /// then exception is thrown. Glyph outlines are shared between realized fonts
+    /// of the same font, if \p outlineStorage is specified, it is used, otherwise
+    /// new one is created.
+    /// \param font Font
+    /// \param pixelSize Pixel size of the font
+    /// \param reporter Error reporter
+    /// \param outlineStorage Glyph outline storage of the font (can be nullptr)
+    static PDFRealizedFontPointer createRealizedFont(PDFFontPointer font,
+                                                     PDFReal pixelSize,
+                                                     PDFRenderErrorReporter* reporter,
+                                                     PDFGlyphOutlineStoragePointer outlineStorage = nullptr);
 
 private:
     /// Constructs new realized font
@@ -420,6 +443,7 @@ public:
     inline explicit PDFFontCache(size_t fontCacheLimit, size_t realizedFontCacheLimit) :
         m_fontCacheLimit(fontCacheLimit),
         m_realizedFontCacheLimit(realizedFontCacheLimit),
+        m_glyphOutlineCacheLimit(DEFAULT_GLYPH_OUTLINE_CACHE_LIMIT),
         m_document(nullptr)
     {
 
@@ -454,16 +478,34 @@ public:
     /// Set font cache limits
     void setCacheLimits(std::size_t fontCacheLimit, std::size_t instancedFontCacheLimit);
 
+    /// Sets memory budget (in bytes) for glyph outlines. Glyph outlines are
+    /// shared between all sizes of the font, if budget is exceeded, then
+    /// they are released when cache is shrinked. Budget is a soft limit,
+    /// outlines are released all at once (together with realized fonts),
+    /// never per glyph, because text sequences of realized fonts point
+    /// directly to the glyphs. Outlines of a single font can exceed the budget.
+    void setGlyphOutlineCacheLimit(qint64 glyphOutlineCacheLimit);
+
+    /// Returns estimate of memory consumed by glyph outlines (in bytes)
+    qint64 getGlyphOutlineMemoryConsumption() const;
+
     /// If shrinking is enabled, then erase font, if cache limit is exceeded.
     void shrink();
 
+    static constexpr qint64 DEFAULT_GLYPH_OUTLINE_CACHE_LIMIT = 64 * 1024 * 1024;
+
 private:
+    /// Returns estimate of memory consumed by glyph outlines. Mutex must be locked.
+    qint64 getGlyphOutlineMemoryConsumptionImpl() const;
+
     size_t m_fontCacheLimit;
     size_t m_realizedFontCacheLimit;
+    qint64 m_glyphOutlineCacheLimit;
     mutable QMutex m_mutex;
     const PDFDocument* m_document;
     mutable std::map<PDFObjectReference, PDFFontPointer> m_fontCache;
     mutable std::map<std::pair<PDFFontPointer, PDFReal>, PDFRealizedFontPointer> m_realizedFontCache;
+    mutable std::map<PDFFontPointer, PDFGlyphOutlineStoragePointer> m_glyphOutlineCache;
     mutable std::set<const void*> m_fontCacheShrinkDisabledObjects;
 };
 
@@ -584,15 +626,73 @@ private:
 
     using Entries = std::vector<Entry>;
 
+    /// Lookup table compiled from the entries. Entries are transformed to disjoint
+    /// intervals sorted by code (entry, which is first in the entry list, has priority,
+    /// as in linear search). Codes below 256 are mapped directly, codes below 0x10000
+    /// are searched only in intervals of their page (high byte of the code), other
+    /// codes are found by binary search in all intervals.
+    class Lookup
+    {
+    public:
+        /// Creates lookup table from entries with given byte count. If byte
+        /// count is zero, then all entries are used.
+        static Lookup create(const Entries& entries, unsigned int byteCount);
+
+        /// Finds CID for given code. Returns true, if code is mapped.
+        inline bool find(unsigned int code, CID& cid) const
+        {
+            if (code < DIRECT_TABLE_SIZE)
+            {
+                cid = m_directTable[code];
+                return m_directTableMapped[code];
+            }
+
+            return findInIntervals(code, cid);
+        }
+
+        bool isEmpty() const { return m_intervals.empty(); }
+
+    private:
+        static constexpr unsigned int DIRECT_TABLE_SIZE = 256;
+        static constexpr unsigned int PAGE_COUNT = 256;
+
+        bool findInIntervals(unsigned int code, CID& cid) const;
+
+        std::array<CID, DIRECT_TABLE_SIZE> m_directTable = { };
+        std::bitset<DIRECT_TABLE_SIZE> m_directTableMapped;
+
+        /// Disjoint intervals sorted by code
+        Entries m_intervals;
+
+        /// Index of first interval, which ends in the page (or after it)
+        std::array<unsigned int, PAGE_COUNT + 1> m_pages = { };
+    };
+
+    /// Compiled lookup tables (one for each byte count of the code,
+    /// and one for unicode mapping, which doesn't respect byte count).
+    struct CompiledLookup
+    {
+        static constexpr unsigned int MAX_BYTE_COUNT = 4;
+
+        std::array<Lookup, MAX_BYTE_COUNT> codeLookups;
+        Lookup toUnicodeLookup;
+    };
+
     explicit PDFFontCMap(Entries&& entries, bool vertical);
 
     /// Optimizes the entries - merges entries, which can be merged. This function
     /// requires, that entries are sorted.
     static Entries optimize(const Entries& entries);
 
+    /// Compiles lookup tables from the entries
+    void compile();
+
     Entries m_entries;
     unsigned int m_maxKeyLength = 0;
     bool m_vertical = false;
+
+    /// Compiled lookup tables, which are shared between copies of the CMap
+    std::shared_ptr<const CompiledLookup> m_lookup;
 };
 
 class PDFType3Font : public PDFFont
@@ -683,7 +783,7 @@ public:
     void add(const QByteArray& key, QByteArray value) { m_cmaps[key] = qMove(value); }
 
     /// Clears the repository
-    void clear() { m_cmaps.clear(); }
+    void clear();
 
     /// Saves the repository content to the file
     void saveToFile(const QString& fileName) const;
@@ -691,11 +791,23 @@ public:
     /// Loads the repository content from the file
     bool loadFromFile(const QString& fileName);
 
+    /// Returns predefined CMap with given name. Parsed CMaps are cached,
+    /// so each predefined CMap is parsed and compiled only once per process.
+    /// If CMap can't be loaded, then exception is thrown.
+    /// \param name Name of the predefined CMap
+    PDFFontCMap getCMap(const QByteArray& name);
+
 private:
     explicit PDFFontCMapRepository();
 
     /// Storage for predefined cmaps
     std::map<QByteArray, QByteArray> m_cmaps;
+
+    /// Mutex protecting parsed cmaps
+    QMutex m_parsedCMapsMutex;
+
+    /// Parsed predefined cmaps
+    std::map<QByteArray, PDFFontCMap> m_parsedCMaps;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFSystemFont
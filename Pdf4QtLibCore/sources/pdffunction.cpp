@@ -28,6 +28,7 @@
 #include "pdfdbgheap.h"
 
 #include <stack>
+#include <array>
 #include <iterator>
 #include <type_traits>
 
@@ -43,6 +44,23 @@ PDFFunction::PDFFunction(uint32_t m, uint32_t n, std::vector<PDFReal>&& domain,
 
 }
 
+PDFFunction::FunctionResult PDFFunction::applyBatch(const_iterator x, iterator y, size_t count) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const_iterator xBegin = std::next(x, i * m_m);
+        iterator yBegin = std::next(y, i * m_n);
+
+        FunctionResult result = apply(xBegin, std::next(xBegin, m_m), yBegin, std::next(yBegin, m_n));
+        if (!result)
+        {
+            return result;
+        }
+    }
+
+    return true;
+}
+
 PDFFunctionPtr PDFFunction::createFunction(const PDFDocument* document, const PDFObject& object)
 {
     PDFParsingContext context(nullptr);
@@ -1580,251 +1598,1449 @@ void PDFPostScriptFunctionStack::checkUnderflow(size_t n) const
     }
 }
 
-PDFPostScriptFunction::Code PDFPostScriptFunction::getCode(const QByteArray& byteArray)
+/// Executes single instruction of the compiled program (jumps are handled
+/// by the caller). Can throw PDFPostScriptFunctionException.
+static inline void executeCompiledInstruction(const PDFPostScriptFunction::CompiledInstruction& instruction, PDFPostScriptFunction::RegisterValue* registers)
 {
-    static constexpr const std::pair<Code, const  char*> codes[] =
-    {
-        // B.1 Arithmetic operators
-        std::pair<Code, const  char*>{ Code::Add, "add" },
-        std::pair<Code, const  char*>{ Code::Sub, "sub" },
-        std::pair<Code, const  char*>{ Code::Mul, "mul" },
-        std::pair<Code, const  char*>{ Code::Div, "div" },
-        std::pair<Code, const  char*>{ Code::Idiv, "idiv" },
-        std::pair<Code, const  char*>{ Code::Mod, "mod" },
-        std::pair<Code, const  char*>{ Code::Neg, "neg" },
-        std::pair<Code, const  char*>{ Code::Abs, "abs" },
-        std::pair<Code, const  char*>{ Code::Ceiling, "ceiling" },
-        std::pair<Code, const  char*>{ Code::Floor, "floor" },
-        std::pair<Code, const  char*>{ Code::Round, "round" },
-        std::pair<Code, const  char*>{ Code::Truncate, "truncate" },
-        std::pair<Code, const  char*>{ Code::Sqrt, "sqrt" },
-        std::pair<Code, const  char*>{ Code::Sin, "sin" },
-        std::pair<Code, const  char*>{ Code::Cos, "cos" },
-        std::pair<Code, const  char*>{ Code::Atan, "atan" },
-        std::pair<Code, const  char*>{ Code::Exp, "exp" },
-        std::pair<Code, const  char*>{ Code::Ln, "ln" },
-        std::pair<Code, const  char*>{ Code::Log, "log" },
-        std::pair<Code, const  char*>{ Code::Cvi, "cvi" },
-        std::pair<Code, const  char*>{ Code::Cvr, "cvr" },
+    using Code = PDFPostScriptFunction::CompiledCode;
+    using PDFIntegerUnsigned = std::make_unsigned<PDFInteger>::type;
 
-        // B.2 Relational, Boolean and Bitwise operators
-        std::pair<Code, const  char*>{ Code::Eq, "eq" },
-        std::pair<Code, const  char*>{ Code::Ne, "ne" },
-        std::pair<Code, const  char*>{ Code::Gt, "gt" },
-        std::pair<Code, const  char*>{ Code::Ge, "ge" },
-        std::pair<Code, const  char*>{ Code::Lt, "lt" },
-        std::pair<Code, const  char*>{ Code::Le, "le" },
-        std::pair<Code, const  char*>{ Code::And, "and" },
-        std::pair<Code, const  char*>{ Code::Or, "or" },
-        std::pair<Code, const  char*>{ Code::Xor, "xor" },
-        std::pair<Code, const  char*>{ Code::Not, "not" },
-        std::pair<Code, const  char*>{ Code::Bitshift, "bitshift" },
-        std::pair<Code, const  char*>{ Code::True, "true" },
-        std::pair<Code, const  char*>{ Code::False, "false" },
+    PDFPostScriptFunction::RegisterValue& result = registers[instruction.result];
+    const PDFPostScriptFunction::RegisterValue a = registers[instruction.a];
+    const PDFPostScriptFunction::RegisterValue b = registers[instruction.b];
 
-        // B.3 Conditional operators
-        std::pair<Code, const  char*>{ Code::If, "if" },
-        std::pair<Code, const  char*>{ Code::IfElse, "ifelse" },
+    switch (instruction.code)
+    {
+        case Code::AddR:
+            result.realNumber = a.realNumber + b.realNumber;
+            break;
 
-        // B.4 Stack operators
-        std::pair<Code, const  char*>{ Code::Pop, "pop" },
-        std::pair<Code, const  char*>{ Code::Exch, "exch" },
-        std::pair<Code, const  char*>{ Code::Dup, "dup" },
-        std::pair<Code, const  char*>{ Code::Copy, "copy" },
-        std::pair<Code, const  char*>{ Code::Index, "index" },
-        std::pair<Code, const  char*>{ Code::Roll, "roll" }
-    };
+        case Code::SubR:
+            result.realNumber = a.realNumber - b.realNumber;
+            break;
 
-    for (const std::pair<Code, const  char*>& codeItem : codes)
-    {
-        if (byteArray == codeItem.second)
+        case Code::MulR:
+            result.realNumber = a.realNumber * b.realNumber;
+            break;
+
+        case Code::DivR:
         {
-            return codeItem.first;
-        }
-    }
+            if (qFuzzyIsNull(b.realNumber))
+            {
+                throw PDFPostScriptFunction::PDFPostScriptFunctionException(PDFTranslationContext::tr("Division by zero (PostScript engine)."));
+            }
 
-    throw PDFException(PDFTranslationContext::tr("Invalid operator (PostScript function) '%1'.").arg(QString::fromLatin1(byteArray)));
-}
+            result.realNumber = a.realNumber / b.realNumber;
+            break;
+        }
 
-PDFPostScriptFunction::PDFPostScriptFunction(uint32_t m, uint32_t n, std::vector<PDFReal>&& domain, std::vector<PDFReal>&& range, PDFPostScriptFunction::Program&& program) :
-    PDFFunction(m, n, std::move(domain), std::move(range)),
-    m_program(std::move(program))
-{
-    Q_ASSERT(!m_program.empty());
-}
+        case Code::NegR:
+            result.realNumber = -a.realNumber;
+            break;
 
-PDFPostScriptFunction::~PDFPostScriptFunction()
-{
+        case Code::AbsR:
+            result.realNumber = qAbs(a.realNumber);
+            break;
 
-}
+        case Code::CeilingR:
+            result.realNumber = std::ceil(a.realNumber);
+            break;
 
-PDFPostScriptFunction::Program PDFPostScriptFunction::parseProgram(const QByteArray& byteArray)
-{
-    // Lexical analyzer can't handle when '{' or '}' is near next token (for example '{0' etc.)
-    QByteArray adjustedArray = byteArray;
-    adjustedArray.replace('{', " { ").replace('}', " } ");
+        case Code::FloorR:
+            result.realNumber = std::floor(a.realNumber);
+            break;
 
-    Program result;
-    PDFLexicalAnalyzer parser(adjustedArray.constBegin(), adjustedArray.constEnd());
-    parser.setTokenizingPostScriptFunction();
+        case Code::RoundR:
+            result.realNumber = qRound(a.realNumber);
+            break;
 
-    std::stack<InstructionPointer> blockCallStack;
-    while (true)
-    {
-        PDFLexicalAnalyzer::Token token = parser.fetch();
-        if (token.type == PDFLexicalAnalyzer::TokenType::EndOfFile)
-        {
-            // We are at end, stop the parsing
+        case Code::TruncateR:
+            result.realNumber = std::trunc(a.realNumber);
             break;
-        }
 
-        switch (token.type)
+        case Code::SqrtR:
         {
-            case PDFLexicalAnalyzer::TokenType::Boolean:
+            if (a.realNumber < 0.0)
             {
-                result.emplace_back(OperandObject::createBoolean(token.data.toBool()), result.size() + 1);
-                break;
+                throw PDFPostScriptFunction::PDFPostScriptFunctionException(PDFTranslationContext::tr("Square root of negative value can't be computed (PostScript engine)."));
             }
 
-            case PDFLexicalAnalyzer::TokenType::Integer:
-            {
-                result.emplace_back(OperandObject::createInteger(token.data.toLongLong()), result.size() + 1);
-                break;
-            }
+            result.realNumber = std::sqrt(a.realNumber);
+            break;
+        }
 
-            case PDFLexicalAnalyzer::TokenType::Real:
-            {
-                result.emplace_back(OperandObject::createReal(token.data.toDouble()), result.size() + 1);
-                break;
-            }
+        case Code::SinR:
+            result.realNumber = qSin(qDegreesToRadians(a.realNumber));
+            break;
 
-            case PDFLexicalAnalyzer::TokenType::Command:
-            {
-                QByteArray command = token.data.toByteArray();
-                if (command == "{")
-                {
-                    // Opening bracket - means start of block
-                    blockCallStack.push(result.size());
-                    result.emplace_back(Code::Call, INVALID_INSTRUCTION_POINTER);
-                    result.back().operand = OperandObject::createInstructionPointer(result.size());
-                }
-                else if (command == "}")
-                {
-                    // Closing bracket - means end of block
-                    if (blockCallStack.empty())
-                    {
-                        throw PDFException(PDFTranslationContext::tr("Invalid program - bad enclosing brackets (PostScript function)."));
-                    }
+        case Code::CosR:
+            result.realNumber = qCos(qDegreesToRadians(a.realNumber));
+            break;
 
-                    result[blockCallStack.top()].next = result.size() + 1;
-                    blockCallStack.pop();
-                    result.emplace_back(Code::Return, INVALID_INSTRUCTION_POINTER);
-                }
-                else
-                {
-                    result.emplace_back(getCode(command), result.size() + 1);
-                }
+        case Code::AtanR:
+        {
+            const PDFReal angles = qRadiansToDegrees(qAtan2(a.realNumber, b.realNumber));
+            result.realNumber = angles < 0.0 ? (angles + 360.0) : angles;
+            break;
+        }
 
-                break;
+        case Code::ExpR:
+            result.realNumber = qPow(a.realNumber, b.realNumber);
+            break;
+
+        case Code::LnR:
+        {
+            if (a.realNumber < 0.0 || qFuzzyIsNull(a.realNumber))
+            {
+                throw PDFPostScriptFunction::PDFPostScriptFunctionException(PDFTranslationContext::tr("Logarithm's input should be positive value  (PostScript engine)."));
             }
 
-            default:
+            result.realNumber = qLn(a.realNumber);
+            break;
+        }
+
+        case Code::LogR:
+        {
+            if (a.realNumber < 0.0 || qFuzzyIsNull(a.realNumber))
             {
-                // All other tokens treat as invalid.
-                throw PDFException(PDFTranslationContext::tr("Invalid program (PostScript function)."));
+                throw PDFPostScriptFunction::PDFPostScriptFunctionException(PDFTranslationContext::tr("Logarithm's input should be positive value (PostScript engine)."));
             }
+
+            result.realNumber = std::log10(a.realNumber);
+            break;
         }
-    }
 
-    if (result.empty())
-    {
-        throw PDFException(PDFTranslationContext::tr("Empty program (PostScript function)."));
-    }
+        case Code::AddI:
+            result.integerNumber = a.integerNumber + b.integerNumber;
+            break;
 
-    // We must insert execute instructions, where blocks without if/ifelse occurs.
-    // We can have following program "{ 2 3 add }" which must return 5. How to find blocks,
-    // after which instructions must be executed? Next instruction must be if, or next instruction
-    // must be a call and next-next instruction must be ifelse
+        case Code::SubI:
+            result.integerNumber = a.integerNumber - b.integerNumber;
+            break;
 
-    auto isBlockUsed = [&result](InstructionPointer ip)
-    {
-        // We should call this function only on Call opcode
-        Q_ASSERT(result[ip].code == Code::Call);
+        case Code::MulI:
+            result.integerNumber = a.integerNumber * b.integerNumber;
+            break;
 
-        const InstructionPointer next = result[ip].next;
-        if (next < result.size())
+        case Code::IdivI:
+        case Code::ModI:
         {
-            switch (result[next].code)
+            if (b.integerNumber == 0)
             {
-                case Code::If:
-                case Code::IfElse:
-                {
-                    // Block is used in 'If' statement
-                    return true;
-                }
+                throw PDFPostScriptFunction::PDFPostScriptFunctionException(PDFTranslationContext::tr("Division by zero (PostScript engine)."));
+            }
 
-                case Code::Call:
-                {
-                    // We must detect, if we use 'If-Else' statement
-                    const InstructionPointer nextnext = result[next].next;
+            result.integerNumber = (instruction.code == Code::IdivI) ? (a.integerNumber / b.integerNumber) : (a.integerNumber % b.integerNumber);
+            break;
+        }
 
-                    if (nextnext < result.size())
-                    {
-                        return result[nextnext].code == Code::IfElse;
-                    }
-                    return false;
-                }
+        case Code::NegI:
+            result.integerNumber = -a.integerNumber;
+            break;
 
-                default:
-                    return false;
-            }
-        }
+        case Code::AbsI:
+            result.integerNumber = qAbs(a.integerNumber);
+            break;
 
-        return false;
-    };
+        case Code::AndI:
+            result.integerNumber = static_cast<PDFIntegerUnsigned>(a.integerNumber) & static_cast<PDFIntegerUnsigned>(b.integerNumber);
+            break;
 
-    // Insert execute instructions, where there are call blocks, which are not used in if/ifelse statements
-    for (size_t i = 0; i < result.size(); ++i)
-    {
-        if (result[i].code == Code::Call && !isBlockUsed(i))
+        case Code::OrI:
+            result.integerNumber = static_cast<PDFIntegerUnsigned>(a.integerNumber) | static_cast<PDFIntegerUnsigned>(b.integerNumber);
+            break;
+
+        case Code::XorI:
+            result.integerNumber = static_cast<PDFIntegerUnsigned>(a.integerNumber) ^ static_cast<PDFIntegerUnsigned>(b.integerNumber);
+            break;
+
+        case Code::NotI:
+            result.integerNumber = ~static_cast<PDFIntegerUnsigned>(a.integerNumber);
+            break;
+
+        case Code::BitshiftI:
         {
-            InstructionPointer insertPosition = result[i].next;
+            const PDFIntegerUnsigned value = static_cast<PDFIntegerUnsigned>(a.integerNumber);
+            const PDFInteger shift = b.integerNumber;
+            PDFIntegerUnsigned shiftedValue = value;
 
-            // We must update the instructions pointers for inserting the instruction
-            for (CodeObject& codeObject : result)
+            if (shift > 0)
             {
-                if (codeObject.next > insertPosition && codeObject.next != INVALID_INSTRUCTION_POINTER)
-                {
-                    ++codeObject.next;
-                }
-                if (codeObject.operand.type == OperandType::InstructionPointer &&
-                    codeObject.operand.instructionPointer > insertPosition &&
-                    codeObject.operand.instructionPointer != INVALID_INSTRUCTION_POINTER)
-                {
-                    ++codeObject.operand.instructionPointer;
-                }
+                // Positive is left
+                shiftedValue = value << shift;
+            }
+            else if (shift < 0)
+            {
+                // Negative is right
+                shiftedValue = value >> -shift;
             }
 
-            // We must insert an execute statement, block is not used in if/ifelse statement
-            result.insert(std::next(result.begin(), insertPosition), CodeObject(Code::Execute, insertPosition + 1));
+            result.integerNumber = shiftedValue;
+            break;
         }
-    }
 
-    // Mark we are at the end of the program
-    for (CodeObject& codeObject : result)
-    {
-        if (codeObject.next == result.size())
-        {
-            codeObject.next = INVALID_INSTRUCTION_POINTER;
-        }
-    }
-    Q_ASSERT(result.back().next == INVALID_INSTRUCTION_POINTER);
+        case Code::AndB:
+            result.boolean = a.boolean && b.boolean;
+            break;
 
-    result.shrink_to_fit();
-    return result;
+        case Code::OrB:
+            result.boolean = a.boolean || b.boolean;
+            break;
+
+        case Code::XorB:
+        case Code::NeB:
+            result.boolean = a.boolean != b.boolean;
+            break;
+
+        case Code::NotB:
+            result.boolean = !a.boolean;
+            break;
+
+        case Code::EqB:
+            result.boolean = a.boolean == b.boolean;
+            break;
+
+        case Code::EqI:
+            result.boolean = a.integerNumber == b.integerNumber;
+            break;
+
+        case Code::NeI:
+            result.boolean = a.integerNumber != b.integerNumber;
+            break;
+
+        case Code::GtI:
+            result.boolean = a.integerNumber > b.integerNumber;
+            break;
+
+        case Code::GeI:
+            result.boolean = a.integerNumber >= b.integerNumber;
+            break;
+
+        case Code::LtI:
+            result.boolean = a.integerNumber < b.integerNumber;
+            break;
+
+        case Code::LeI:
+            result.boolean = a.integerNumber <= b.integerNumber;
+            break;
+
+        case Code::EqR:
+            result.boolean = a.realNumber == b.realNumber;
+            break;
+
+        case Code::NeR:
+            result.boolean = a.realNumber != b.realNumber;
+            break;
+
+        case Code::GtR:
+            result.boolean = a.realNumber > b.realNumber;
+            break;
+
+        case Code::GeR:
+            result.boolean = a.realNumber >= b.realNumber;
+            break;
+
+        case Code::LtR:
+            result.boolean = a.realNumber < b.realNumber;
+            break;
+
+        case Code::LeR:
+            result.boolean = a.realNumber <= b.realNumber;
+            break;
+
+        case Code::CviR:
+            result.integerNumber = static_cast<PDFInteger>(a.realNumber);
+            break;
+
+        case Code::CvrI:
+            result.realNumber = a.integerNumber;
+            break;
+
+        case Code::Move:
+            result = a;
+            break;
+
+        case Code::Jump:
+        case Code::JumpIfFalse:
+            Q_ASSERT(false);
+            break;
+    }
+}
+
+/// Compiles the postscript program into register based form. Program is executed
+/// symbolically - stack contains registers instead of values, and instructions
+/// working with registers are generated. Types of all operands must be known
+/// at compile time, otherwise compilation fails.
+class PDFPostScriptFunctionCompiler
+{
+public:
+    using Program = PDFPostScriptFunction::Program;
+    using CodeObject = PDFPostScriptFunction::CodeObject;
+    using InstructionPointer = PDFPostScriptFunction::InstructionPointer;
+    using OperandType = PDFPostScriptFunction::OperandType;
+    using CompiledCode = PDFPostScriptFunction::CompiledCode;
+    using CompiledInstruction = PDFPostScriptFunction::CompiledInstruction;
+    using CompiledProgram = PDFPostScriptFunction::CompiledProgram;
+    using Register = PDFPostScriptFunction::Register;
+    using RegisterValue = PDFPostScriptFunction::RegisterValue;
+
+    explicit inline PDFPostScriptFunctionCompiler(const Program& program) :
+        m_program(program)
+    {
+
+    }
+
+    /// Compiles the program. If compilation fails, invalid program is returned.
+    /// \param m Number of input variables
+    /// \param n Number of output variables
+    CompiledProgram compile(uint32_t m, uint32_t n);
+
+private:
+    /// Thrown, when program can't be compiled
+    struct CompilationFailed { };
+
+    /// Value on the stack during compilation, either register, or block of the code
+    struct StackValue
+    {
+        bool isBlock = false;
+        InstructionPointer block = PDFPostScriptFunction::INVALID_INSTRUCTION_POINTER;
+        Register reg = 0;
+
+        bool operator==(const StackValue& other) const { return isBlock == other.isBlock && block == other.block && reg == other.reg; }
+        bool operator!=(const StackValue& other) const { return !(*this == other); }
+    };
+
+    using Stack = std::vector<StackValue>;
+
+    /// Compiles block of code until return statement or end of the program is reached
+    void compileBlock(InstructionPointer ip, Stack& stack, bool isTopLevel);
+
+    /// Compiles conditional statement to the structured branch
+    void compileBranch(Register condition, InstructionPointer trueBlock, InstructionPointer falseBlock, Stack& stack);
+
+    Register createRegister(OperandType type, bool isConstant, RegisterValue value);
+
+    /// Emits instruction (or folds constants, if all operands are constant)
+    Register emit(CompiledCode code, OperandType resultType, Register a, Register b, bool isBinary);
+    Register emitUnary(CompiledCode code, OperandType resultType, Register a) { return emit(code, resultType, a, 0, false); }
+    Register emitBinary(CompiledCode code, OperandType resultType, Register a, Register b) { return emit(code, resultType, a, b, true); }
+
+    void checkUnderflow(const Stack& stack, size_t n = 1) const { if (stack.size() < n) { throw CompilationFailed(); } }
+    void checkOverflow(const Stack& stack) const { if (stack.size() > 100) { throw CompilationFailed(); } }
+
+    void push(Stack& stack, Register reg) { StackValue value; value.reg = reg; stack.push_back(value); checkOverflow(stack); }
+    OperandType getTopType(const Stack& stack) const;
+    bool isBinaryOperation(const Stack& stack, OperandType type) const;
+    Register popRegister(Stack& stack, OperandType type);
+    Register popNumber(Stack& stack);
+    InstructionPointer popBlock(Stack& stack);
+    PDFInteger popConstantInteger(Stack& stack);
+
+    const Program& m_program;
+    std::vector<CompiledInstruction> m_instructions;
+    std::vector<RegisterValue> m_registers;
+    std::vector<OperandType> m_types;
+    std::vector<bool> m_isConstant;
+};
+
+PDFPostScriptFunctionCompiler::CompiledProgram PDFPostScriptFunctionCompiler::compile(uint32_t m, uint32_t n)
+{
+    CompiledProgram result;
+
+    try
+    {
+        Stack stack;
+        RegisterValue zero;
+        zero.realNumber = 0.0;
+
+        for (uint32_t i = 0; i < m; ++i)
+        {
+            push(stack, createRegister(OperandType::Real, false, zero));
+        }
+
+        compileBlock(0, stack, true);
+
+        if (stack.size() != n)
+        {
+            throw CompilationFailed();
+        }
+
+        for (const StackValue& value : stack)
+        {
+            if (value.isBlock || m_types[value.reg] == OperandType::Boolean)
+            {
+                throw CompilationFailed();
+            }
+
+            result.outputRegisters.push_back(value.reg);
+            result.outputIsInteger.push_back(m_types[value.reg] == OperandType::Integer);
+        }
+    }
+    catch (const CompilationFailed&)
+    {
+        return CompiledProgram();
+    }
+
+    result.instructions = qMove(m_instructions);
+    result.registers = qMove(m_registers);
+    result.isValid = true;
+    return result;
+}
+
+void PDFPostScriptFunctionCompiler::compileBlock(InstructionPointer ip, Stack& stack, bool isTopLevel)
+{
+    while (ip != PDFPostScriptFunction::INVALID_INSTRUCTION_POINTER)
+    {
+        if (ip >= m_program.size())
+        {
+            throw CompilationFailed();
+        }
+
+        const CodeObject& instruction = m_program[ip];
+        switch (instruction.code)
+        {
+            case PDFPostScriptFunction::Code::Add:
+            case PDFPostScriptFunction::Code::Sub:
+            case PDFPostScriptFunction::Code::Mul:
+            {
+                const bool isAdd = instruction.code == PDFPostScriptFunction::Code::Add;
+                const bool isSub = instruction.code == PDFPostScriptFunction::Code::Sub;
+
+                if (isBinaryOperation(stack, OperandType::Integer))
+                {
+                    const Register b = popRegister(stack, OperandType::Integer);
+                    const Register a = popRegister(stack, OperandType::Integer);
+                    push(stack, emitBinary(isAdd ? CompiledCode::AddI : (isSub ? CompiledCode::SubI : CompiledCode::MulI), OperandType::Integer, a, b));
+                }
+                else
+                {
+                    const Register b = popNumber(stack);
+                    const Register a = popNumber(stack);
+                    push(stack, emitBinary(isAdd ? CompiledCode::AddR : (isSub ? CompiledCode::SubR : CompiledCode::MulR), OperandType::Real, a, b));
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Div:
+            case PDFPostScriptFunction::Code::Atan:
+            case PDFPostScriptFunction::Code::Exp:
+            {
+                const CompiledCode code = (instruction.code == PDFPostScriptFunction::Code::Div) ? CompiledCode::DivR :
+                                          (instruction.code == PDFPostScriptFunction::Code::Atan) ? CompiledCode::AtanR : CompiledCode::ExpR;
+                const Register b = popNumber(stack);
+                const Register a = popNumber(stack);
+                push(stack, emitBinary(code, OperandType::Real, a, b));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Idiv:
+            case PDFPostScriptFunction::Code::Mod:
+            {
+                const Register b = popRegister(stack, OperandType::Integer);
+                const Register a = popRegister(stack, OperandType::Integer);
+                push(stack, emitBinary(instruction.code == PDFPostScriptFunction::Code::Idiv ? CompiledCode::IdivI : CompiledCode::ModI, OperandType::Integer, a, b));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Neg:
+            case PDFPostScriptFunction::Code::Abs:
+            {
+                const bool isNeg = instruction.code == PDFPostScriptFunction::Code::Neg;
+
+                if (getTopType(stack) == OperandType::Integer)
+                {
+                    push(stack, emitUnary(isNeg ? CompiledCode::NegI : CompiledCode::AbsI, OperandType::Integer, popRegister(stack, OperandType::Integer)));
+                }
+                else
+                {
+                    push(stack, emitUnary(isNeg ? CompiledCode::NegR : CompiledCode::AbsR, OperandType::Real, popRegister(stack, OperandType::Real)));
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Ceiling:
+            case PDFPostScriptFunction::Code::Floor:
+            case PDFPostScriptFunction::Code::Round:
+            case PDFPostScriptFunction::Code::Truncate:
+            {
+                const OperandType type = getTopType(stack);
+                if (type == OperandType::Real)
+                {
+                    CompiledCode code = CompiledCode::CeilingR;
+                    switch (instruction.code)
+                    {
+                        case PDFPostScriptFunction::Code::Floor:
+                            code = CompiledCode::FloorR;
+                            break;
+
+                        case PDFPostScriptFunction::Code::Round:
+                            code = CompiledCode::RoundR;
+                            break;
+
+                        case PDFPostScriptFunction::Code::Truncate:
+                            code = CompiledCode::TruncateR;
+                            break;
+
+                        default:
+                            break;
+                    }
+
+                    push(stack, emitUnary(code, OperandType::Real, popRegister(stack, OperandType::Real)));
+                }
+                else if (type != OperandType::Integer)
+                {
+                    throw CompilationFailed();
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Sqrt:
+            case PDFPostScriptFunction::Code::Sin:
+            case PDFPostScriptFunction::Code::Cos:
+            case PDFPostScriptFunction::Code::Ln:
+            case PDFPostScriptFunction::Code::Log:
+            {
+                CompiledCode code = CompiledCode::SqrtR;
+                switch (instruction.code)
+                {
+                    case PDFPostScriptFunction::Code::Sin:
+                        code = CompiledCode::SinR;
+                        break;
+
+                    case PDFPostScriptFunction::Code::Cos:
+                        code = CompiledCode::CosR;
+                        break;
+
+                    case PDFPostScriptFunction::Code::Ln:
+                        code = CompiledCode::LnR;
+                        break;
+
+                    case PDFPostScriptFunction::Code::Log:
+                        code = CompiledCode::LogR;
+                        break;
+
+                    default:
+                        break;
+                }
+
+                push(stack, emitUnary(code, OperandType::Real, popNumber(stack)));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Cvi:
+            {
+                const OperandType type = getTopType(stack);
+                if (type == OperandType::Real)
+                {
+                    push(stack, emitUnary(CompiledCode::CviR, OperandType::Integer, popRegister(stack, OperandType::Real)));
+                }
+                else if (type != OperandType::Integer)
+                {
+                    throw CompilationFailed();
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Cvr:
+            {
+                const OperandType type = getTopType(stack);
+                if (type == OperandType::Integer)
+                {
+                    push(stack, emitUnary(CompiledCode::CvrI, OperandType::Real, popRegister(stack, OperandType::Integer)));
+                }
+                else if (type != OperandType::Real)
+                {
+                    throw CompilationFailed();
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Eq:
+            case PDFPostScriptFunction::Code::Ne:
+            {
+                const bool isEq = instruction.code == PDFPostScriptFunction::Code::Eq;
+
+                if (isBinaryOperation(stack, OperandType::Integer))
+                {
+                    const Register b = popRegister(stack, OperandType::Integer);
+                    const Register a = popRegister(stack, OperandType::Integer);
+                    push(stack, emitBinary(isEq ? CompiledCode::EqI : CompiledCode::NeI, OperandType::Boolean, a, b));
+                }
+                else if (isBinaryOperation(stack, OperandType::Boolean))
+                {
+                    const Register b = popRegister(stack, OperandType::Boolean);
+                    const Register a = popRegister(stack, OperandType::Boolean);
+                    push(stack, emitBinary(isEq ? CompiledCode::EqB : CompiledCode::NeB, OperandType::Boolean, a, b));
+                }
+                else
+                {
+                    const Register b = popNumber(stack);
+                    const Register a = popNumber(stack);
+                    push(stack, emitBinary(isEq ? CompiledCode::EqR : CompiledCode::NeR, OperandType::Boolean, a, b));
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Gt:
+            case PDFPostScriptFunction::Code::Ge:
+            case PDFPostScriptFunction::Code::Lt:
+            case PDFPostScriptFunction::Code::Le:
+            {
+                const bool isInteger = isBinaryOperation(stack, OperandType::Integer);
+                CompiledCode code = isInteger ? CompiledCode::GtI : CompiledCode::GtR;
+                switch (instruction.code)
+                {
+                    case PDFPostScriptFunction::Code::Ge:
+                        code = isInteger ? CompiledCode::GeI : CompiledCode::GeR;
+                        break;
+
+                    case PDFPostScriptFunction::Code::Lt:
+                        code = isInteger ? CompiledCode::LtI : CompiledCode::LtR;
+                        break;
+
+                    case PDFPostScriptFunction::Code::Le:
+                        code = isInteger ? CompiledCode::LeI : CompiledCode::LeR;
+                        break;
+
+                    default:
+                        break;
+                }
+
+                const Register b = isInteger ? popRegister(stack, OperandType::Integer) : popNumber(stack);
+                const Register a = isInteger ? popRegister(stack, OperandType::Integer) : popNumber(stack);
+                push(stack, emitBinary(code, OperandType::Boolean, a, b));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::And:
+            case PDFPostScriptFunction::Code::Or:
+            case PDFPostScriptFunction::Code::Xor:
+            {
+                const bool isBoolean = isBinaryOperation(stack, OperandType::Boolean);
+                const OperandType type = isBoolean ? OperandType::Boolean : OperandType::Integer;
+                CompiledCode code = isBoolean ? CompiledCode::AndB : CompiledCode::AndI;
+
+                if (instruction.code == PDFPostScriptFunction::Code::Or)
+                {
+                    code = isBoolean ? CompiledCode::OrB : CompiledCode::OrI;
+                }
+                else if (instruction.code == PDFPostScriptFunction::Code::Xor)
+                {
+                    code = isBoolean ? CompiledCode::XorB : CompiledCode::XorI;
+                }
+
+                const Register b = popRegister(stack, type);
+                const Register a = popRegister(stack, type);
+                push(stack, emitBinary(code, type, a, b));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Not:
+            {
+                if (getTopType(stack) == OperandType::Integer)
+                {
+                    push(stack, emitUnary(CompiledCode::NotI, OperandType::Integer, popRegister(stack, OperandType::Integer)));
+                }
+                else
+                {
+                    push(stack, emitUnary(CompiledCode::NotB, OperandType::Boolean, popRegister(stack, OperandType::Boolean)));
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Bitshift:
+            {
+                const Register shift = popRegister(stack, OperandType::Integer);
+                const Register value = popRegister(stack, OperandType::Integer);
+                push(stack, emitBinary(CompiledCode::BitshiftI, OperandType::Integer, value, shift));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::True:
+            case PDFPostScriptFunction::Code::False:
+            {
+                RegisterValue value;
+                value.boolean = instruction.code == PDFPostScriptFunction::Code::True;
+                push(stack, createRegister(OperandType::Boolean, true, value));
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::If:
+            {
+                const InstructionPointer block = popBlock(stack);
+                const Register condition = popRegister(stack, OperandType::Boolean);
+
+                if (m_isConstant[condition])
+                {
+                    if (m_registers[condition].boolean)
+                    {
+                        compileBlock(block, stack, false);
+                    }
+                }
+                else
+                {
+                    compileBranch(condition, block, PDFPostScriptFunction::INVALID_INSTRUCTION_POINTER, stack);
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::IfElse:
+            {
+                const InstructionPointer falseBlock = popBlock(stack);
+                const InstructionPointer trueBlock = popBlock(stack);
+                const Register condition = popRegister(stack, OperandType::Boolean);
+
+                if (m_isConstant[condition])
+                {
+                    compileBlock(m_registers[condition].boolean ? trueBlock : falseBlock, stack, false);
+                }
+                else
+                {
+                    compileBranch(condition, trueBlock, falseBlock, stack);
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Pop:
+            {
+                checkUnderflow(stack);
+                stack.pop_back();
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Exch:
+            {
+                checkUnderflow(stack, 2);
+                std::swap(stack[stack.size() - 2], stack[stack.size() - 1]);
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Dup:
+            {
+                checkUnderflow(stack);
+                stack.push_back(stack.back());
+                checkOverflow(stack);
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Copy:
+            {
+                const PDFInteger n = popConstantInteger(stack);
+
+                if (n < 0)
+                {
+                    throw CompilationFailed();
+                }
+
+                checkUnderflow(stack, static_cast<size_t>(n));
+                const size_t startIndex = stack.size() - n;
+                for (size_t i = 0; i < static_cast<size_t>(n); ++i)
+                {
+                    stack.push_back(stack[startIndex + i]);
+                    checkOverflow(stack);
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Index:
+            {
+                const PDFInteger n = popConstantInteger(stack);
+
+                if (n < 0)
+                {
+                    throw CompilationFailed();
+                }
+
+                checkUnderflow(stack, static_cast<size_t>(n) + 1);
+                stack.push_back(stack[stack.size() - 1 - n]);
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Roll:
+            {
+                PDFInteger j = popConstantInteger(stack);
+                const PDFInteger n = popConstantInteger(stack);
+
+                if (n < 0)
+                {
+                    throw CompilationFailed();
+                }
+
+                if (n == 0)
+                {
+                    break;
+                }
+
+                j = j % n;
+                if (j == 0)
+                {
+                    break;
+                }
+
+                checkUnderflow(stack, n);
+
+                const auto first = std::next(stack.begin(), stack.size() - n);
+                if (j > 0)
+                {
+                    // Rotate left j times
+                    std::rotate(first, stack.end() - j, stack.end());
+                }
+                else
+                {
+                    // Rotate right j times
+                    std::rotate(first, first - j, stack.end());
+                }
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Call:
+            {
+                Q_ASSERT(instruction.operand.type == PDFPostScriptFunction::OperandType::InstructionPointer);
+
+                StackValue value;
+                value.isBlock = true;
+                value.block = instruction.operand.instructionPointer;
+                stack.push_back(value);
+                checkOverflow(stack);
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Execute:
+            {
+                compileBlock(popBlock(stack), stack, false);
+                break;
+            }
+
+            case PDFPostScriptFunction::Code::Return:
+            {
+                if (isTopLevel)
+                {
+                    throw CompilationFailed();
+                }
+                return;
+            }
+
+            case PDFPostScriptFunction::Code::Push:
+            {
+                RegisterValue value;
+                switch (instruction.operand.type)
+                {
+                    case OperandType::Real:
+                        value.realNumber = instruction.operand.realNumber;
+                        break;
+
+                    case OperandType::Integer:
+                        value.integerNumber = instruction.operand.integerNumber;
+                        break;
+
+                    case OperandType::Boolean:
+                        value.boolean = instruction.operand.boolean;
+                        break;
+
+                    default:
+                        throw CompilationFailed();
+                }
+
+                push(stack, createRegister(instruction.operand.type, true, value));
+                break;
+            }
+        }
+
+        ip = instruction.next;
+    }
+
+    if (!isTopLevel)
+    {
+        // Block must be terminated by return
+        throw CompilationFailed();
+    }
+}
+
+void PDFPostScriptFunctionCompiler::compileBranch(Register condition, InstructionPointer trueBlock, InstructionPointer falseBlock, Stack& stack)
+{
+    // Compile both branches separately, then join them, so the stack
+    // has the same layout after both branches.
+    std::vector<CompiledInstruction> outerInstructions = qMove(m_instructions);
+
+    m_instructions.clear();
+    Stack trueStack = stack;
+    compileBlock(trueBlock, trueStack, false);
+    std::vector<CompiledInstruction> trueInstructions = qMove(m_instructions);
+
+    m_instructions.clear();
+    Stack falseStack = stack;
+    if (falseBlock != PDFPostScriptFunction::INVALID_INSTRUCTION_POINTER)
+    {
+        compileBlock(falseBlock, falseStack, false);
+    }
+    std::vector<CompiledInstruction> falseInstructions = qMove(m_instructions);
+
+    m_instructions = qMove(outerInstructions);
+
+    if (trueStack.size() != falseStack.size())
+    {
+        throw CompilationFailed();
+    }
+
+    Stack resultStack = trueStack;
+    for (size_t i = 0; i < trueStack.size(); ++i)
+    {
+        const StackValue& trueValue = trueStack[i];
+        const StackValue& falseValue = falseStack[i];
+
+        if (trueValue == falseValue)
+        {
+            continue;
+        }
+
+        if (trueValue.isBlock || falseValue.isBlock || m_types[trueValue.reg] != m_types[falseValue.reg])
+        {
+            throw CompilationFailed();
+        }
+
+        RegisterValue zero;
+        zero.realNumber = 0.0;
+        const Register reg = createRegister(m_types[trueValue.reg], false, zero);
+        resultStack[i].reg = reg;
+
+        CompiledInstruction trueMove;
+        trueMove.code = CompiledCode::Move;
+        trueMove.result = reg;
+        trueMove.a = trueValue.reg;
+        trueInstructions.push_back(trueMove);
+
+        CompiledInstruction falseMove = trueMove;
+        falseMove.a = falseValue.reg;
+        falseInstructions.push_back(falseMove);
+    }
+
+    auto appendInstructions = [this](const std::vector<CompiledInstruction>& instructions)
+    {
+        const Register offset = Register(m_instructions.size());
+        for (CompiledInstruction instruction : instructions)
+        {
+            if (instruction.code == CompiledCode::Jump || instruction.code == CompiledCode::JumpIfFalse)
+            {
+                instruction.a += offset;
+            }
+            m_instructions.push_back(instruction);
+        }
+    };
+
+    // JumpIfFalse condition, else
+    //   true instructions
+    //   Jump end
+    // else:
+    //   false instructions
+    // end:
+    const size_t jumpToElseIndex = m_instructions.size();
+    CompiledInstruction jumpToElse;
+    jumpToElse.code = CompiledCode::JumpIfFalse;
+    jumpToElse.result = condition;
+    m_instructions.push_back(jumpToElse);
+    appendInstructions(trueInstructions);
+
+    if (!falseInstructions.empty())
+    {
+        const size_t jumpToEndIndex = m_instructions.size();
+        CompiledInstruction jumpToEnd;
+        jumpToEnd.code = CompiledCode::Jump;
+        m_instructions.push_back(jumpToEnd);
+        m_instructions[jumpToElseIndex].a = Register(m_instructions.size());
+        appendInstructions(falseInstructions);
+        m_instructions[jumpToEndIndex].a = Register(m_instructions.size());
+    }
+    else
+    {
+        m_instructions[jumpToElseIndex].a = Register(m_instructions.size());
+    }
+
+    stack = qMove(resultStack);
+}
+
+PDFPostScriptFunctionCompiler::Register PDFPostScriptFunctionCompiler::createRegister(OperandType type, bool isConstant, RegisterValue value)
+{
+    const Register reg = Register(m_registers.size());
+    m_registers.push_back(value);
+    m_types.push_back(type);
+    m_isConstant.push_back(isConstant);
+    return reg;
+}
+
+PDFPostScriptFunctionCompiler::Register PDFPostScriptFunctionCompiler::emit(CompiledCode code, OperandType resultType, Register a, Register b, bool isBinary)
+{
+    RegisterValue zero;
+    zero.realNumber = 0.0;
+
+    const bool isConstant = m_isConstant[a] && (!isBinary || m_isConstant[b]);
+    const Register result = createRegister(resultType, isConstant, zero);
+
+    CompiledInstruction instruction;
+    instruction.code = code;
+    instruction.result = result;
+    instruction.a = a;
+    instruction.b = isBinary ? b : a;
+
+    if (isConstant)
+    {
+        // Fold the constant. If evaluation fails, then the program fails
+        // always, when this instruction is reached - leave it to the interpreter.
+        try
+        {
+            executeCompiledInstruction(instruction, m_registers.data());
+        }
+        catch (const PDFPostScriptFunction::PDFPostScriptFunctionException&)
+        {
+            throw CompilationFailed();
+        }
+    }
+    else
+    {
+        m_instructions.push_back(instruction);
+    }
+
+    return result;
+}
+
+PDFPostScriptFunctionCompiler::OperandType PDFPostScriptFunctionCompiler::getTopType(const Stack& stack) const
+{
+    checkUnderflow(stack);
+
+    const StackValue& value = stack.back();
+    return value.isBlock ? OperandType::InstructionPointer : m_types[value.reg];
+}
+
+bool PDFPostScriptFunctionCompiler::isBinaryOperation(const Stack& stack, OperandType type) const
+{
+    checkUnderflow(stack, 2);
+
+    const StackValue& a = stack[stack.size() - 1];
+    const StackValue& b = stack[stack.size() - 2];
+    return !a.isBlock && !b.isBlock && m_types[a.reg] == type && m_types[b.reg] == type;
+}
+
+PDFPostScriptFunctionCompiler::Register PDFPostScriptFunctionCompiler::popRegister(Stack& stack, OperandType type)
+{
+    if (getTopType(stack) != type)
+    {
+        throw CompilationFailed();
+    }
+
+    const Register reg = stack.back().reg;
+    stack.pop_back();
+    return reg;
+}
+
+PDFPostScriptFunctionCompiler::Register PDFPostScriptFunctionCompiler::popNumber(Stack& stack)
+{
+    switch (getTopType(stack))
+    {
+        case OperandType::Real:
+            return popRegister(stack, OperandType::Real);
+
+        case OperandType::Integer:
+            return emitUnary(CompiledCode::CvrI, OperandType::Real, popRegister(stack, OperandType::Integer));
+
+        default:
+            throw CompilationFailed();
+    }
+}
+
+PDFPostScriptFunctionCompiler::InstructionPointer PDFPostScriptFunctionCompiler::popBlock(Stack& stack)
+{
+    if (getTopType(stack) != OperandType::InstructionPointer)
+    {
+        throw CompilationFailed();
+    }
+
+    const InstructionPointer block = stack.back().block;
+    stack.pop_back();
+    return block;
+}
+
+PDFInteger PDFPostScriptFunctionCompiler::popConstantInteger(Stack& stack)
+{
+    const Register reg = popRegister(stack, OperandType::Integer);
+    if (!m_isConstant[reg])
+    {
+        // Stack layout depends on input values
+        throw CompilationFailed();
+    }
+
+    return m_registers[reg].integerNumber;
+}
+
+PDFPostScriptFunction::Code PDFPostScriptFunction::getCode(const QByteArray& byteArray)
+{
+    static constexpr const std::pair<Code, const  char*> codes[] =
+    {
+        // B.1 Arithmetic operators
+        std::pair<Code, const  char*>{ Code::Add, "add" },
+        std::pair<Code, const  char*>{ Code::Sub, "sub" },
+        std::pair<Code, const  char*>{ Code::Mul, "mul" },
+        std::pair<Code, const  char*>{ Code::Div, "div" },
+        std::pair<Code, const  char*>{ Code::Idiv, "idiv" },
+        std::pair<Code, const  char*>{ Code::Mod, "mod" },
+        std::pair<Code, const  char*>{ Code::Neg, "neg" },
+        std::pair<Code, const  char*>{ Code::Abs, "abs" },
+        std::pair<Code, const  char*>{ Code::Ceiling, "ceiling" },
+        std::pair<Code, const  char*>{ Code::Floor, "floor" },
+        std::pair<Code, const  char*>{ Code::Round, "round" },
+        std::pair<Code, const  char*>{ Code::Truncate, "truncate" },
+        std::pair<Code, const  char*>{ Code::Sqrt, "sqrt" },
+        std::pair<Code, const  char*>{ Code::Sin, "sin" },
+        std::pair<Code, const  char*>{ Code::Cos, "cos" },
+        std::pair<Code, const  char*>{ Code::Atan, "atan" },
+        std::pair<Code, const  char*>{ Code::Exp, "exp" },
+        std::pair<Code, const  char*>{ Code::Ln, "ln" },
+        std::pair<Code, const  char*>{ Code::Log, "log" },
+        std::pair<Code, const  char*>{ Code::Cvi, "cvi" },
+        std::pair<Code, const  char*>{ Code::Cvr, "cvr" },
+
+        // B.2 Relational, Boolean and Bitwise operators
+        std::pair<Code, const  char*>{ Code::Eq, "eq" },
+        std::pair<Code, const  char*>{ Code::Ne, "ne" },
+        std::pair<Code, const  char*>{ Code::Gt, "gt" },
+        std::pair<Code, const  char*>{ Code::Ge, "ge" },
+        std::pair<Code, const  char*>{ Code::Lt, "lt" },
+        std::pair<Code, const  char*>{ Code::Le, "le" },
+        std::pair<Code, const  char*>{ Code::And, "and" },
+        std::pair<Code, const  char*>{ Code::Or, "or" },
+        std::pair<Code, const  char*>{ Code::Xor, "xor" },
+        std::pair<Code, const  char*>{ Code::Not, "not" },
+        std::pair<Code, const  char*>{ Code::Bitshift, "bitshift" },
+        std::pair<Code, const  char*>{ Code::True, "true" },
+        std::pair<Code, const  char*>{ Code::False, "false" },
+
+        // B.3 Conditional operators
+        std::pair<Code, const  char*>{ Code::If, "if" },
+        std::pair<Code, const  char*>{ Code::IfElse, "ifelse" },
+
+        // B.4 Stack operators
+        std::pair<Code, const  char*>{ Code::Pop, "pop" },
+        std::pair<Code, const  char*>{ Code::Exch, "exch" },
+        std::pair<Code, const  char*>{ Code::Dup, "dup" },
+        std::pair<Code, const  char*>{ Code::Copy, "copy" },
+        std::pair<Code, const  char*>{ Code::Index, "index" },
+        std::pair<Code, const  char*>{ Code::Roll, "roll" }
+    };
+
+    for (const std::pair<Code, const  char*>& codeItem : codes)
+    {
+        if (byteArray == codeItem.second)
+        {
+            return codeItem.first;
+        }
+    }
+
+    throw PDFException(PDFTranslationContext::tr("Invalid operator (PostScript function) '%1'.").arg(QString::fromLatin1(byteArray)));
+}
+
+PDFPostScriptFunction::PDFPostScriptFunction(uint32_t m, uint32_t n, std::vector<PDFReal>&& domain, std::vector<PDFReal>&& range, PDFPostScriptFunction::Program&& program) :
+    PDFFunction(m, n, std::move(domain), std::move(range)),
+    m_program(std::move(program))
+{
+    Q_ASSERT(!m_program.empty());
+    m_compiledProgram = compileProgram(m_program, m, n);
+}
+
+PDFPostScriptFunction::~PDFPostScriptFunction()
+{
+
+}
+
+PDFPostScriptFunction::Program PDFPostScriptFunction::parseProgram(const QByteArray& byteArray)
+{
+    // Lexical analyzer can't handle when '{' or '}' is near next token (for example '{0' etc.)
+    QByteArray adjustedArray = byteArray;
+    adjustedArray.replace('{', " { ").replace('}', " } ");
+
+    Program result;
+    PDFLexicalAnalyzer parser(adjustedArray.constBegin(), adjustedArray.constEnd());
+    parser.setTokenizingPostScriptFunction();
+
+    std::stack<InstructionPointer> blockCallStack;
+    while (true)
+    {
+        PDFLexicalAnalyzer::Token token = parser.fetch();
+        if (token.type == PDFLexicalAnalyzer::TokenType::EndOfFile)
+        {
+            // We are at end, stop the parsing
+            break;
+        }
+
+        switch (token.type)
+        {
+            case PDFLexicalAnalyzer::TokenType::Boolean:
+            {
+                result.emplace_back(OperandObject::createBoolean(token.data.toBool()), result.size() + 1);
+                break;
+            }
+
+            case PDFLexicalAnalyzer::TokenType::Integer:
+            {
+                result.emplace_back(OperandObject::createInteger(token.data.toLongLong()), result.size() + 1);
+                break;
+            }
+
+            case PDFLexicalAnalyzer::TokenType::Real:
+            {
+                result.emplace_back(OperandObject::createReal(token.data.toDouble()), result.size() + 1);
+                break;
+            }
+
+            case PDFLexicalAnalyzer::TokenType::Command:
+            {
+                QByteArray command = token.data.toByteArray();
+                if (command == "{")
+                {
+                    // Opening bracket - means start of block
+                    blockCallStack.push(result.size());
+                    result.emplace_back(Code::Call, INVALID_INSTRUCTION_POINTER);
+                    result.back().operand = OperandObject::createInstructionPointer(result.size());
+                }
+                else if (command == "}")
+                {
+                    // Closing bracket - means end of block
+                    if (blockCallStack.empty())
+                    {
+                        throw PDFException(PDFTranslationContext::tr("Invalid program - bad enclosing brackets (PostScript function)."));
+                    }
+
+                    result[blockCallStack.top()].next = result.size() + 1;
+                    blockCallStack.pop();
+                    result.emplace_back(Code::Return, INVALID_INSTRUCTION_POINTER);
+                }
+                else
+                {
+                    result.emplace_back(getCode(command), result.size() + 1);
+                }
+
+                break;
+            }
+
+            default:
+            {
+                // All other tokens treat as invalid.
+                throw PDFException(PDFTranslationContext::tr("Invalid program (PostScript function)."));
+            }
+        }
+    }
+
+    if (result.empty())
+    {
+        throw PDFException(PDFTranslationContext::tr("Empty program (PostScript function)."));
+    }
+
+    // We must insert execute instructions, where blocks without if/ifelse occurs.
+    // We can have following program "{ 2 3 add }" which must return 5. How to find blocks,
+    // after which instructions must be executed? Next instruction must be if, or next instruction
+    // must be a call and next-next instruction must be ifelse
+
+    auto isBlockUsed = [&result](InstructionPointer ip)
+    {
+        // We should call this function only on Call opcode
+        Q_ASSERT(result[ip].code == Code::Call);
+
+        const InstructionPointer next = result[ip].next;
+        if (next < result.size())
+        {
+            switch (result[next].code)
+            {
+                case Code::If:
+                case Code::IfElse:
+                {
+                    // Block is used in 'If' statement
+                    return true;
+                }
+
+                case Code::Call:
+                {
+                    // We must detect, if we use 'If-Else' statement
+                    const InstructionPointer nextnext = result[next].next;
+
+                    if (nextnext < result.size())
+                    {
+                        return result[nextnext].code == Code::IfElse;
+                    }
+                    return false;
+                }
+
+                default:
+                    return false;
+            }
+        }
+
+        return false;
+    };
+
+    // Insert execute instructions, where there are call blocks, which are not used in if/ifelse statements
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        if (result[i].code == Code::Call && !isBlockUsed(i))
+        {
+            InstructionPointer insertPosition = result[i].next;
+
+            // We must update the instructions pointers for inserting the instruction
+            for (CodeObject& codeObject : result)
+            {
+                if (codeObject.next > insertPosition && codeObject.next != INVALID_INSTRUCTION_POINTER)
+                {
+                    ++codeObject.next;
+                }
+                if (codeObject.operand.type == OperandType::InstructionPointer &&
+                    codeObject.operand.instructionPointer > insertPosition &&
+                    codeObject.operand.instructionPointer != INVALID_INSTRUCTION_POINTER)
+                {
+                    ++codeObject.operand.instructionPointer;
+                }
+            }
+
+            // We must insert an execute statement, block is not used in if/ifelse statement
+            result.insert(std::next(result.begin(), insertPosition), CodeObject(Code::Execute, insertPosition + 1));
+        }
+    }
+
+    // Mark we are at the end of the program
+    for (CodeObject& codeObject : result)
+    {
+        if (codeObject.next == result.size())
+        {
+            codeObject.next = INVALID_INSTRUCTION_POINTER;
+        }
+    }
+    Q_ASSERT(result.back().next == INVALID_INSTRUCTION_POINTER);
+
+    result.shrink_to_fit();
+    return result;
 }
 
 PDFFunction::FunctionResult PDFPostScriptFunction::apply(const_iterator x_1, const_iterator x_m, iterator y_1, iterator y_n) const
+{
+    if (!m_compiledProgram.isValid)
+    {
+        return applyInterpreted(x_1, x_m, y_1, y_n);
+    }
+
+    const size_t m = std::distance(x_1, x_m);
+    const size_t n = std::distance(y_1, y_n);
+
+    if (m != m_m)
+    {
+        return PDFTranslationContext::tr("Invalid number of operands for function. Expected %1, provided %2.").arg(m_m).arg(m);
+    }
+    if (n != m_n)
+    {
+        return PDFTranslationContext::tr("Invalid number of output variables for function. Expected %1, provided %2.").arg(m_n).arg(n);
+    }
+
+    return applyBatch(x_1, y_1, 1);
+}
+
+PDFFunction::FunctionResult PDFPostScriptFunction::applyBatch(const_iterator x, iterator y, size_t count) const
+{
+    if (!m_compiledProgram.isValid)
+    {
+        return PDFFunction::applyBatch(x, y, count);
+    }
+
+    // Constant registers are never written, so register file can be reused for all points.
+    // Register file is usually small, so it is kept on the stack, larger register files
+    // are kept in the thread local buffer, so no memory is allocated for each call.
+    std::array<RegisterValue, STACK_REGISTER_COUNT> stackRegisters;
+    RegisterValue* registers = stackRegisters.data();
+
+    const std::vector<RegisterValue>& initialRegisters = m_compiledProgram.registers;
+    if (initialRegisters.size() <= stackRegisters.size())
+    {
+        std::copy(initialRegisters.cbegin(), initialRegisters.cend(), stackRegisters.begin());
+    }
+    else
+    {
+        thread_local std::vector<RegisterValue> heapRegisters;
+        heapRegisters.assign(initialRegisters.cbegin(), initialRegisters.cend());
+        registers = heapRegisters.data();
+    }
+
+    try
+    {
+
+        for (size_t point = 0; point < count; ++point)
+        {
+            const_iterator xPoint = std::next(x, point * m_m);
+            iterator yPoint = std::next(y, point * m_n);
+
+            for (uint32_t i = 0; i < m_m; ++i)
+            {
+                registers[i].realNumber = clampInput(i, xPoint[i]);
+            }
+
+            executeCompiled(registers);
+
+            for (uint32_t i = 0; i < m_n; ++i)
+            {
+                const RegisterValue& value = registers[m_compiledProgram.outputRegisters[i]];
+                const PDFReal outputValue = m_compiledProgram.outputIsInteger[i] ? PDFReal(value.integerNumber) : value.realNumber;
+                yPoint[i] = clampOutput(i, outputValue);
+            }
+        }
+    }
+    catch (const PDFPostScriptFunction::PDFPostScriptFunctionException& exception)
+    {
+        return exception.getMessage();
+    }
+
+    return true;
+}
+
+PDFPostScriptFunction::CompiledProgram PDFPostScriptFunction::compileProgram(const Program& program, uint32_t m, uint32_t n)
+{
+    if (program.empty())
+    {
+        return CompiledProgram();
+    }
+
+    PDFPostScriptFunctionCompiler compiler(program);
+    return compiler.compile(m, n);
+}
+
+void PDFPostScriptFunction::executeCompiled(RegisterValue* registerData) const
+{
+    const std::vector<CompiledInstruction>& instructions = m_compiledProgram.instructions;
+
+    size_t ip = 0;
+    const size_t count = instructions.size();
+    while (ip < count)
+    {
+        const CompiledInstruction& instruction = instructions[ip];
+        switch (instruction.code)
+        {
+            case CompiledCode::Jump:
+            {
+                ip = instruction.a;
+                continue;
+            }
+
+            case CompiledCode::JumpIfFalse:
+            {
+                if (!registerData[instruction.result].boolean)
+                {
+                    ip = instruction.a;
+                    continue;
+                }
+                break;
+            }
+
+            default:
+                executeCompiledInstruction(instruction, registerData);
+                break;
+        }
+
+        ++ip;
+    }
+}
+
+PDFFunction::FunctionResult PDFPostScriptFunction::applyInterpreted(const_iterator x_1, const_iterator x_m, iterator y_1, iterator y_n) const
 {
     const size_t m = std::distance(x_1, x_m);
     const size_t n = std::distance(y_1, y_n);
@@ -86,6 +86,15 @@ public:
     /// \param y_n Iterator to the end of the output values (one item after last value)
     virtual FunctionResult apply(const_iterator x_1, const_iterator x_m, iterator y_1, iterator y_n) const = 0;
 
+    /// Transforms batch of input values to the output values. Input values of the
+    /// points are stored consecutively (m values for each point), output values
+    /// are stored in the same manner (n values for each point). Default implementation
+    /// calls apply for each point. Evaluation stops at first error.
+    /// \param x Input values (m * count values)
+    /// \param y Output values (n * count values)
+    /// \param count Number of points
+    virtual FunctionResult applyBatch(const_iterator x, iterator y, size_t count) const;
+
     /// Creates function from the object. If error occurs, exception is thrown.
     /// \param document Document, owning the pdf object
     /// \param object Object defining the function
@@ -448,6 +457,105 @@ public:
 
     using Program = std::vector<CodeObject>;
 
+    /// Register index of the compiled program
+    using Register = uint32_t;
+
+    /// Instruction codes of the compiled program. Compiled program is
+    /// register based and statically typed, so each code works with
+    /// registers of known types (suffix R = real, I = integer, B = boolean).
+    enum class CompiledCode : uint8_t
+    {
+        // Real arithmetic
+        AddR,
+        SubR,
+        MulR,
+        DivR,
+        NegR,
+        AbsR,
+        CeilingR,
+        FloorR,
+        RoundR,
+        TruncateR,
+        SqrtR,
+        SinR,
+        CosR,
+        AtanR,
+        ExpR,
+        LnR,
+        LogR,
+
+        // Integer arithmetic and bitwise operators
+        AddI,
+        SubI,
+        MulI,
+        IdivI,
+        ModI,
+        NegI,
+        AbsI,
+        AndI,
+        OrI,
+        XorI,
+        NotI,
+        BitshiftI,
+
+        // Boolean operators
+        AndB,
+        OrB,
+        XorB,
+        NotB,
+        EqB,
+        NeB,
+
+        // Relational operators
+        EqI,
+        NeI,
+        GtI,
+        GeI,
+        LtI,
+        LeI,
+        EqR,
+        NeR,
+        GtR,
+        GeR,
+        LtR,
+        LeR,
+
+        // Conversions
+        CviR,
+        CvrI,
+
+        // Control
+        Move,
+        Jump,
+        JumpIfFalse
+    };
+
+    union RegisterValue
+    {
+        PDFReal realNumber;
+        PDFInteger integerNumber;
+        bool boolean;
+    };
+
+    struct CompiledInstruction
+    {
+        CompiledCode code = CompiledCode::Move;
+        Register result = 0;    ///< Result register (or condition register for JumpIfFalse)
+        Register a = 0;         ///< First operand (or jump target for jumps)
+        Register b = 0;         ///< Second operand
+    };
+
+    /// Compiled program. Input values are stored in registers 0, ..., m - 1,
+    /// constants are stored in the initial register file.
+    struct CompiledProgram
+    {
+        bool isValid = false;
+        std::vector<CompiledInstruction> instructions;
+        std::vector<RegisterValue> registers;
+        std::vector<Register> outputRegisters;
+        std::vector<bool> outputIsInteger;
+    };
+
     /// Construct new postscript function.
     /// \param m Number of input variables
     /// \param n Number of output variables
@@ -466,11 +574,46 @@ public:
     /// \param y_n Iterator to the end of the output values (one item after last value)
     virtual FunctionResult apply(const_iterator x_1, const_iterator x_m, iterator y_1, iterator y_n) const override;
 
+    /// Transforms batch of input values to the output values using compiled program.
+    /// \param x Input values (m * count values)
+    /// \param y Output values (n * count values)
+    /// \param count Number of points
+    virtual FunctionResult applyBatch(const_iterator x, iterator y, size_t count) const override;
+
+    /// Transforms input values to the output values using the interpreter,
+    /// even if program is compiled (used for verification of the compiled program).
+    /// \param x_1 Iterator to the first input value
+    /// \param x_n Iterator to the end of the input values (one item after last value)
+    /// \param y_1 Iterator to the first output value
+    /// \param y_n Iterator to the end of the output values (one item after last value)
+    FunctionResult applyInterpreted(const_iterator x_1, const_iterator x_m, iterator y_1, iterator y_n) const;
+
+    /// Compiles the program to the register based form. Program is type checked,
+    /// constants are folded, stack operations are resolved and conditional blocks are
+    /// transformed to structured branches. If program can't be compiled (for example,
+    /// operand types or stack layout depend on input values), invalid program is returned
+    /// and interpreter is used instead.
+    /// \param program Program
+    /// \param m Number of input variables
+    /// \param n Number of output variables
+    static CompiledProgram compileProgram(const Program& program, uint32_t m, uint32_t n);
+
+    /// Returns true, if program was successfully compiled
+    bool isCompiled() const { return m_compiledProgram.isValid; }
+
 private:
+    /// Register files up to this size are allocated on the stack
+    static constexpr size_t STACK_REGISTER_COUNT = 64;
+
+    /// Executes the compiled program on the register file (can throw PDFPostScriptFunctionException)
+    void executeCompiled(RegisterValue* registerData) const;
+
     Program m_program;
+    CompiledProgram m_compiledProgram;
 
     friend class PDFPostScriptFunctionStack;
     friend class PDFPostScriptFunctionExecutor;
+    friend class PDFPostScriptFunctionCompiler;
 };
 
 }   // namespace pdf
@@ -19,6 +19,8 @@
 #include "pdfvisitor.h"
 #include "pdfdbgheap.h"
 
+#include <numeric>
+
 namespace pdf
 {
 
@@ -102,8 +104,12 @@ bool PDFObject::operator==(const PDFObject& other) const
         // values are "equal" (NaN == NaN returns false)
         if (std::holds_alternative<PDFObjectContentPointer>(m_data))
         {
-            Q_ASSERT(std::get<PDFObjectContentPointer>(m_data));
-            return std::get<PDFObjectContentPointer>(m_data)->equals(std::get<PDFObjectContentPointer>(other.m_data).get());
+            const PDFObjectContentPointer& content = std::get<PDFObjectContentPointer>(m_data);
+            const PDFObjectContentPointer& otherContent = std::get<PDFObjectContentPointer>(other.m_data);
+            Q_ASSERT(content);
+
+            // Shared content is always equal
+            return content == otherContent || content->equals(otherContent.get());
         }
 
         return m_data == other.m_data;
@@ -298,6 +304,7 @@ void PDFDictionary::removeEntry(const char* key)
     if (it != m_dictionary.end())
     {
         m_dictionary.erase(it);
+        m_index.clear();
     }
 }
 
@@ -318,48 +325,127 @@ void PDFDictionary::removeNullObjects()
 {
     m_dictionary.erase(std::remove_if(m_dictionary.begin(), m_dictionary.end(), [](const DictionaryEntry& entry) { return entry.second.isNull(); }), m_dictionary.end());
     m_dictionary.shrink_to_fit();
+    m_index.clear();
+}
+
+static inline bool isKeyLess(QByteArrayView left, QByteArrayView right)
+{
+    if (left.size() != right.size())
+    {
+        return left.size() < right.size();
+    }
+
+    return !left.isEmpty() && std::memcmp(left.data(), right.data(), left.size()) < 0;
 }
 
 void PDFDictionary::optimize()
 {
     m_dictionary.shrink_to_fit();
+    m_index.clear();
+
+    if (m_dictionary.size() >= INDEX_THRESHOLD && m_dictionary.size() < std::numeric_limits<uint32_t>::max())
+    {
+        m_index.resize(m_dictionary.size());
+        std::iota(m_index.begin(), m_index.end(), uint32_t(0));
+
+        // Stable sort is used, so in case of duplicate keys, the first
+        // entry is found, as in the case of linear search.
+        auto comparator = [this](uint32_t l, uint32_t r) { return isKeyLess(m_dictionary[l].first.getView(), m_dictionary[r].first.getView()); };
+        std::stable_sort(m_index.begin(), m_index.end(), comparator);
+        m_index.shrink_to_fit();
+    }
+}
+
+size_t PDFDictionary::findIndex(QByteArrayView key) const
+{
+    if (!m_index.empty())
+    {
+        Q_ASSERT(m_index.size() == m_dictionary.size());
+
+        auto comparator = [this](uint32_t index, QByteArrayView value) { return isKeyLess(m_dictionary[index].first.getView(), value); };
+        auto it = std::lower_bound(m_index.cbegin(), m_index.cend(), key, comparator);
+        if (it != m_index.cend() && m_dictionary[*it].first.getView() == key)
+        {
+            return *it;
+        }
+
+        return m_dictionary.size();
+    }
+
+    for (size_t i = 0, count = m_dictionary.size(); i < count; ++i)
+    {
+        if (m_dictionary[i].first.getView() == key)
+        {
+            return i;
+        }
+    }
+
+    return m_dictionary.size();
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::const_iterator PDFDictionary::find(const QByteArray& key) const
 {
-    return std::find_if(m_dictionary.cbegin(), m_dictionary.cend(), [&key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.cbegin(), findIndex(QByteArrayView(key)));
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::iterator PDFDictionary::find(const QByteArray& key)
 {
-    return std::find_if(m_dictionary.begin(), m_dictionary.end(), [&key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.begin(), findIndex(QByteArrayView(key)));
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::const_iterator PDFDictionary::find(const char* key) const
 {
-    return std::find_if(m_dictionary.cbegin(), m_dictionary.cend(), [key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.cbegin(), findIndex(QByteArrayView(key, std::strlen(key))));
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::const_iterator PDFDictionary::find(const PDFInplaceOrMemoryString& key) const
 {
-    return std::find_if(m_dictionary.cbegin(), m_dictionary.cend(), [&key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.cbegin(), findIndex(key.getView()));
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::iterator PDFDictionary::find(const PDFInplaceOrMemoryString& key)
 {
-    return std::find_if(m_dictionary.begin(), m_dictionary.end(), [&key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.begin(), findIndex(key.getView()));
 }
 
 std::vector<PDFDictionary::DictionaryEntry>::iterator PDFDictionary::find(const char* key)
 {
-    return std::find_if(m_dictionary.begin(), m_dictionary.end(), [key](const DictionaryEntry& entry) { return entry.first == key; });
+    return std::next(m_dictionary.begin(), findIndex(QByteArrayView(key, std::strlen(key))));
+}
+
+PDFStream::PDFStream(const PDFStream& other) :
+    m_dictionary(other.m_dictionary),
+    m_content(*other.getContent())
+{
+
+}
+
+PDFStream& PDFStream::operator=(const PDFStream& other)
+{
+    if (this != &other)
+    {
+        m_dictionary = other.m_dictionary;
+        m_content = *other.getContent();
+        m_pendingDecryption.reset();
+    }
+
+    return *this;
 }
 
 bool PDFStream::equals(const PDFObjectContent* other) const
 {
     Q_ASSERT(dynamic_cast<const PDFStream*>(other));
     const PDFStream* otherStream = static_cast<const PDFStream*>(other);
-    return m_dictionary.equals(&otherStream->m_dictionary) && m_content == otherStream->m_content;
+    return m_dictionary.equals(&otherStream->m_dictionary) && *getContent() == *otherStream->getContent();
+}
+
+void PDFStream::decryptContent() const
+{
+    std::call_once(m_pendingDecryption->flag, [this]()
+    {
+        m_content = m_pendingDecryption->decryptFunction(m_content);
+        m_pendingDecryption->decryptFunction = nullptr;
+    });
 }
 
 PDFObject PDFObjectManipulator::merge(PDFObject left, PDFObject right, MergeFlags flags)
@@ -542,19 +628,8 @@ PDFInplaceOrMemoryString::PDFInplaceOrMemoryString(QByteArray string)
 
 bool PDFInplaceOrMemoryString::equals(const char* value, size_t length) const
 {
-    if (std::holds_alternative<PDFInplaceString>(m_value))
-    {
-        const PDFInplaceString& string = std::get<PDFInplaceString>(m_value);
-        return std::equal(string.string.data(), string.string.data() + string.size, value, value + length);
-    }
-
-    if (std::holds_alternative<QByteArray>(m_value))
-    {
-        const QByteArray& string = std::get<QByteArray>(m_value);
-        return std::equal(string.constData(), string.constData() + string.size(), value, value + length);
-    }
-
-    return length == 0;
+    QByteArrayView view = getView();
+    return size_t(view.size()) == length && (length == 0 || std::memcmp(view.data(), value, length) == 0);
 }
 
 bool PDFInplaceOrMemoryString::isInplace() const
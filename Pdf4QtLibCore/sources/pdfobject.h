@@ -22,8 +22,11 @@
 #include "pdfglobal.h"
 
 #include <QByteArray>
+#include <QByteArrayView>
 
 #include <memory>
+#include <mutex>
+#include <functional>
 #include <vector>
 #include <variant>
 #include <array>
@@ -154,6 +157,23 @@ public:
     /// Returns string. If string is inplace, byte array is constructed.
     QByteArray getString() const;
 
+    /// Returns view to the string data. No memory allocation is performed,
+    /// view is valid as long as this object is alive and not modified.
+    inline QByteArrayView getView() const
+    {
+        if (const PDFInplaceString* string = std::get_if<PDFInplaceString>(&m_value))
+        {
+            return QByteArrayView(string->string.data(), string->size);
+        }
+
+        if (const QByteArray* string = std::get_if<QByteArray>(&m_value))
+        {
+            return QByteArrayView(*string);
+        }
+
+        return QByteArrayView();
+    }
+
 private:
     std::variant<typename std::monostate, PDFInplaceString, QByteArray> m_value;
 };
@@ -352,7 +372,9 @@ private:
 /// Represents a dictionary of objects in the PDF file. Dictionary is
 /// an array of pairs key-value, where key is name object and value is any
 /// PDF object. For this reason, we use QByteArray for key. We do not use
-/// map, because dictionaries are usually small.
+/// map, because dictionaries are usually small. Large dictionaries (for example,
+/// font or XObject resources) get sorted key index when optimized, so lookup
+/// in them is logarithmic instead of linear.
 class PDF4QTLIBCORESHARED_EXPORT PDFDictionary : public PDFObjectContent
 {
 public:
@@ -395,12 +417,12 @@ public:
     /// Adds a new entry to the dictionary.
     /// \param key Key
     /// \param value Value
-    void addEntry(PDFInplaceOrMemoryString&& key, PDFObject&& value) { m_dictionary.emplace_back(std::move(key), std::move(value)); }
+    void addEntry(PDFInplaceOrMemoryString&& key, PDFObject&& value) { m_dictionary.emplace_back(std::move(key), std::move(value)); m_index.clear(); }
 
     /// Adds a new entry to the dictionary.
     /// \param key Key
     /// \param value Value
-    void addEntry(const PDFInplaceOrMemoryString& key, PDFObject&& value) { m_dictionary.emplace_back(key, std::move(value)); }
+    void addEntry(const PDFInplaceOrMemoryString& key, PDFObject&& value) { m_dictionary.emplace_back(key, std::move(value)); m_index.clear(); }
 
     /// Sets entry value. If entry with given key doesn't exist,
     /// then it is created.
@@ -425,10 +447,19 @@ public:
     /// Removes null objects from dictionary
     void removeNullObjects();
 
-    /// Optimizes the dictionary for memory consumption
+    /// Optimizes the dictionary for memory consumption. If dictionary
+    /// is large, then sorted key index is also built.
     virtual void optimize() override;
 
 private:
+    /// Minimal number of entries, for which sorted key index is built
+    static constexpr size_t INDEX_THRESHOLD = 12;
+
+    /// Finds index of the entry with given key. If key is not found,
+    /// then count of entries is returned.
+    /// \param key Key to be found
+    size_t findIndex(QByteArrayView key) const;
+
     /// Finds an item in the dictionary array, if the item is not in the dictionary,
     /// then end iterator is returned.
     /// \param key Key to be found
@@ -460,6 +491,10 @@ private:
     std::vector<DictionaryEntry>::iterator find(const PDFInplaceOrMemoryString& key);
 
     std::vector<DictionaryEntry> m_dictionary;
+
+    /// Indices of entries sorted by key (first by key length, then by key
+    /// content). Empty, if dictionary is small or was modified after optimization.
+    std::vector<uint32_t> m_index;
 };
 
 /// Represents a stream object in the PDF file. Stream consists of dictionary
@@ -467,6 +502,9 @@ private:
 class PDF4QTLIBCORESHARED_EXPORT PDFStream : public PDFObjectContent
 {
 public:
+    /// Function, which decrypts the content of the stream
+    using DecryptFunction = std::function<QByteArray(const QByteArray&)>;
+
     inline explicit PDFStream() = default;
     inline explicit PDFStream(PDFDictionary&& dictionary, QByteArray&& content) :
         m_dictionary(std::move(dictionary)),
@@ -475,6 +513,22 @@ public:
 
     }
 
+    /// Creates stream with encrypted content. Content is decrypted using
+    /// \p decryptFunction, when it is accessed for the first time.
+    /// \param dictionary Stream dictionary
+    /// \param encryptedContent Encrypted content of the stream
+    /// \param decryptFunction Decrypt function
+    inline explicit PDFStream(PDFDictionary&& dictionary, QByteArray&& encryptedContent, DecryptFunction decryptFunction) :
+        m_dictionary(std::move(dictionary)),
+        m_content(std::move(encryptedContent)),
+        m_pendingDecryption(std::make_shared<PendingDecryption>())
+    {
+        m_pendingDecryption->decryptFunction = std::move(decryptFunction);
+    }
+
+    PDFStream(const PDFStream& other);
+    PDFStream& operator=(const PDFStream& other);
+
     virtual ~PDFStream() override = default;
 
     virtual bool equals(const PDFObjectContent* other) const override;
@@ -483,14 +537,34 @@ public:
     const PDFDictionary* getDictionary() const { return &m_dictionary; }
 
     /// Optimizes the stream for memory consumption
-    virtual void optimize() override { m_dictionary.optimize(); m_content.shrink_to_fit(); }
+    virtual void optimize() override { m_dictionary.optimize(); if (!m_pendingDecryption) { m_content.shrink_to_fit(); } }
+
+    /// Returns content of the stream. If content is encrypted,
+    /// it is decrypted by the first call of this function.
+    const QByteArray* getContent() const
+    {
+        if (m_pendingDecryption)
+        {
+            decryptContent();
+        }
 
-    /// Returns content of the stream
-    const QByteArray* getContent() const { return &m_content; }
+        return &m_content;
+    }
 
 private:
+    struct PendingDecryption
+    {
+        std::once_flag flag;
+        DecryptFunction decryptFunction;
+    };
+
+    /// Decrypts the content (only once, even if it is called
+    /// from multiple threads)
+    void decryptContent() const;
+
     PDFDictionary m_dictionary;
-    QByteArray m_content;
+    mutable QByteArray m_content;
+    std::shared_ptr<PendingDecryption> m_pendingDecryption;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFObjectManipulator
@@ -65,8 +65,10 @@ void PDFCollectReferencesVisitor::visitReference(const PDFObjectReference refere
 class PDFReplaceReferencesVisitor : public PDFAbstractVisitor
 {
 public:
-    explicit PDFReplaceReferencesVisitor(const std::map<PDFObjectReference, PDFObjectReference>& replacements) :
-        m_replacements(replacements)
+    explicit PDFReplaceReferencesVisitor(const std::map<PDFObjectReference, PDFObjectReference>& replacements,
+                                         const std::map<PDFObjectReference, PDFObjectReference>* baseReplacements = nullptr) :
+        m_replacements(replacements),
+        m_baseReplacements(baseReplacements)
     {
         m_objectStack.reserve(32);
     }
@@ -86,6 +88,7 @@ public:
 
 private:
     const std::map<PDFObjectReference, PDFObjectReference>& m_replacements;
+    const std::map<PDFObjectReference, PDFObjectReference>* m_baseReplacements;
     std::vector<PDFObject> m_objectStack;
 };
 
@@ -166,12 +169,22 @@ void PDFReplaceReferencesVisitor::visitReference(const PDFObjectReference refere
     {
         // Replace the reference
         m_objectStack.push_back(PDFObject::createReference(it->second));
+        return;
     }
-    else
+
+    if (m_baseReplacements)
     {
-        // Preserve old reference
-        m_objectStack.push_back(PDFObject::createReference(reference));
+        auto baseIt = m_baseReplacements->find(reference);
+        if (baseIt != m_baseReplacements->cend())
+        {
+            // Replace the reference using base mapping
+            m_objectStack.push_back(PDFObject::createReference(baseIt->second));
+            return;
+        }
     }
+
+    // Preserve old reference
+    m_objectStack.push_back(PDFObject::createReference(reference));
 }
 
 PDFObject PDFReplaceReferencesVisitor::getObject()
@@ -229,6 +242,15 @@ PDFObject PDFObjectUtils::replaceReferences(const PDFObject& object, const std::
     return replaceReferencesVisitor.getObject();
 }
 
+PDFObject PDFObjectUtils::replaceReferences(const PDFObject& object,
+                                            const std::map<PDFObjectReference, PDFObjectReference>& referenceMapping,
+                                            const std::map<PDFObjectReference, PDFObjectReference>& baseReferenceMapping)
+{
+    PDFReplaceReferencesVisitor replaceReferencesVisitor(referenceMapping, &baseReferenceMapping);
+    object.accept(&replaceReferencesVisitor);
+    return replaceReferencesVisitor.getObject();
+}
+
 QString PDFObjectUtils::getObjectTypeName(PDFObject::Type type)
 {
     switch (type)
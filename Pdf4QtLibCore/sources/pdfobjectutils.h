@@ -45,6 +45,17 @@ public:
 
     static PDFObject replaceReferences(const PDFObject& object, const std::map<PDFObjectReference, PDFObjectReference>& referenceMapping);
 
+    /// Replaces references in the object using layered mapping. Reference is first searched
+    /// in \p referenceMapping, then in \p baseReferenceMapping. If it is in neither of them,
+    /// it is preserved. Large mapping, which is shared by many objects, can be used as
+    /// a base mapping without copying it.
+    /// \param object Object
+    /// \param referenceMapping Reference mapping
+    /// \param baseReferenceMapping Base reference mapping
+    static PDFObject replaceReferences(const PDFObject& object,
+                                       const std::map<PDFObjectReference, PDFObjectReference>& referenceMapping,
+                                       const std::map<PDFObjectReference, PDFObjectReference>& baseReferenceMapping);
+
     /// Returns name for object type
     /// \param type Type
     static QString getObjectTypeName(PDFObject::Type type);
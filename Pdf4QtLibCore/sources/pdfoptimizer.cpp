@@ -26,6 +26,8 @@
 #include "pdfdbgheap.h"
 #include "pdfdocumentwriter.h"
 
+#include <QCryptographicHash>
+
 namespace pdf
 {
 
@@ -224,6 +226,9 @@ bool PDFOptimizer::performRemoveUnusedObjects()
     PDFObjectStorage::PDFObjects objects =  m_storage.getObjects();
     std::set<PDFObjectReference> references = PDFObjectUtils::getReferences({ m_storage.getTrailerDictionary() }, m_storage);
 
+    // Objects are accessed from multiple threads, so they must not be shared
+    objects.detach();
+
     PDFIntegerRange<size_t> range(0, objects.size());
     auto processEntry = [&counter, &objects, &references](size_t index)
     {
@@ -247,21 +252,26 @@ bool PDFOptimizer::performMergeIdenticalObjects()
 {
     std::atomic<PDFInteger> counter = 0;
     std::map<PDFObjectReference, PDFObjectReference> replacementMap;
-    std::map<QByteArray, PDFObjectReference> serializedObjectToReference;
+    std::map<QByteArray, std::vector<PDFObjectReference>> objectHashToReferences;
     PDFObjectStorage::PDFObjects objects =  m_storage.getObjects();
-    std::vector<QByteArray> serializedObjects(objects.size());
+    std::vector<QByteArray> objectHashes(objects.size());
 
+    // Objects are accessed from multiple threads, so they must not be shared
+    objects.detach();
+
+    // We store only hashes of serialized objects, not serialized objects itself,
+    // because serialized objects (for example, fonts or ICC profiles) can be huge.
     PDFIntegerRange<size_t> range(0, objects.size());
-    auto serializeEntry = [&objects, &serializedObjects](size_t index)
+    auto hashEntry = [&objects, &objectHashes](size_t index)
     {
         const PDFObjectStorage::Entry& entry = objects[index];
 
         if (!entry.object.isNull())
         {
-            serializedObjects[index] = PDFDocumentWriter::getSerializedObject(entry.object);
+            objectHashes[index] = QCryptographicHash::hash(PDFDocumentWriter::getSerializedObject(entry.object), QCryptographicHash::Sha256);
         }
     };
-    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Unknown, range.begin(), range.end(), serializeEntry);
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Unknown, range.begin(), range.end(), hashEntry);
 
     // Find same object
     for (PDFInteger index : range)
@@ -284,16 +294,17 @@ bool PDFOptimizer::performMergeIdenticalObjects()
             }
 
             PDFObjectReference currentReference(PDFInteger(index), objects[index].generation);
-            const QByteArray& serializedObject = serializedObjects[index];
-            if (!serializedObjectToReference.count(serializedObject))
+            std::vector<PDFObjectReference>& candidateReferences = objectHashToReferences[objectHashes[index]];
+
+            // Objects with the same hash are compared, so hash collision can't merge different objects
+            auto it = std::find_if(candidateReferences.cbegin(), candidateReferences.cend(), [&](const PDFObjectReference& reference) { return objects[reference.objectNumber].object == entry.object; });
+            if (it == candidateReferences.cend())
             {
-                serializedObjectToReference[serializedObject] = currentReference;
+                candidateReferences.push_back(currentReference);
             }
             else
             {
-                PDFObjectReference oldReference = currentReference;
-                PDFObjectReference newReference = serializedObjectToReference.at(serializedObject);
-                replacementMap[oldReference] = newReference;
+                replacementMap[currentReference] = *it;
                 ++counter;
             }
         }
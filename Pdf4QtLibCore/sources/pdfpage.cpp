@@ -242,6 +242,66 @@ QRectF PDFPage::getRotatedBox(const QRectF& rect, PageRotation rotation)
     return rect;
 }
 
+PDFPage PDFPage::parsePage(const PDFObjectStorage* storage,
+                           const PDFPageInheritableAttributes& parentAttributes,
+                           const PDFObject& pageObject)
+{
+    PDFObjectReference objectReference = pageObject.isReference() ? pageObject.getReference() : PDFObjectReference();
+    const PDFObject& dereferenced = storage->getObject(pageObject);
+
+    if (!dereferenced.isDictionary())
+    {
+        throw PDFException(PDFTranslationContext::tr("Expected dictionary in page tree."));
+    }
+
+    const PDFDictionary* dictionary = dereferenced.getDictionary();
+    PDFPageInheritableAttributes currentInheritableAttributes = PDFPageInheritableAttributes::parse(parentAttributes, pageObject, storage);
+
+    PDFPage page;
+
+    page.m_pageObject = dereferenced;
+    page.m_pageReference = objectReference;
+    page.m_mediaBox = currentInheritableAttributes.getMediaBox();
+    page.m_cropBox = currentInheritableAttributes.getCropBox();
+    page.m_resources = storage->getObject(currentInheritableAttributes.getResources());
+    page.m_pageRotation = currentInheritableAttributes.getPageRotation();
+
+    if (!page.m_cropBox.isValid())
+    {
+        page.m_cropBox = page.m_mediaBox;
+    }
+
+    PDFDocumentDataLoaderDecorator loader(storage);
+    page.m_bleedBox = loader.readRectangle(dictionary->get("BleedBox"), page.getCropBox());
+    page.m_trimBox = loader.readRectangle(dictionary->get("TrimBox"), page.getCropBox());
+    page.m_artBox = loader.readRectangle(dictionary->get("ArtBox"), page.getCropBox());
+    page.m_contents = storage->getObject(dictionary->get("Contents"));
+    page.m_annots = loader.readReferenceArrayFromDictionary(dictionary, "Annots");
+    page.m_lastModified = PDFEncoding::convertToDateTime(loader.readStringFromDictionary(dictionary, "LastModified"));
+    page.m_thumbnailReference = loader.readReferenceFromDictionary(dictionary, "Thumb");
+    page.m_beads = loader.readReferenceArrayFromDictionary(dictionary, "B");
+    page.m_duration = loader.readIntegerFromDictionary(dictionary, "Dur", 0);
+    page.m_structParent = loader.readIntegerFromDictionary(dictionary, "StructParents", 0);
+    page.m_webCaptureContentSetId = loader.readStringFromDictionary(dictionary, "ID");
+    page.m_preferredZoom = loader.readNumberFromDictionary(dictionary, "PZ", 0.0);
+
+    constexpr const std::array<std::pair<const char*, PageTabOrder>, 5> tabStops =
+    {
+        std::pair<const char*, PageTabOrder>{ "R", PageTabOrder::Row },
+        std::pair<const char*, PageTabOrder>{ "C", PageTabOrder::Column },
+        std::pair<const char*, PageTabOrder>{ "S", PageTabOrder::Structure },
+        std::pair<const char*, PageTabOrder>{ "A", PageTabOrder::Array },
+        std::pair<const char*, PageTabOrder>{ "W", PageTabOrder::Widget }
+    };
+
+    page.m_pageTabOrder = loader.readEnumByName(dictionary->get("Tabs"), tabStops.cbegin(), tabStops.cend(), PageTabOrder::Invalid);
+    page.m_templateName = loader.readNameFromDictionary(dictionary, "TemplateInstantiated");
+    page.m_userUnit = loader.readNumberFromDictionary(dictionary, "UserUnit", 1.0);
+    page.m_documentPart = loader.readReferenceFromDictionary(dictionary, "DPart");
+
+    return page;
+}
+
 void PDFPage::parseImpl(std::vector<PDFPage>& pages,
                         std::set<PDFObjectReference>& visitedReferences,
                         const PDFPageInheritableAttributes& templateAttributes,
@@ -249,7 +309,6 @@ void PDFPage::parseImpl(std::vector<PDFPage>& pages,
                         const PDFObjectStorage* storage)
 {
     // Are we in internal node, or leaf (page object)?
-    PDFObjectReference objectReference = root.isReference() ? root.getReference() : PDFObjectReference();
     const PDFObject& dereferenced = storage->getObject(root);
 
     if (dereferenced.isDictionary())
@@ -258,11 +317,11 @@ void PDFPage::parseImpl(std::vector<PDFPage>& pages,
         const PDFObject& typeObject =  storage->getObject(dictionary->get("Type"));
         if (typeObject.isName())
         {
-            PDFPageInheritableAttributes currentInheritableAttributes = PDFPageInheritableAttributes::parse(templateAttributes, root, storage);
-
             QByteArray typeString = typeObject.getString();
             if (typeString == "Pages")
             {
+                PDFPageInheritableAttributes currentInheritableAttributes = PDFPageInheritableAttributes::parse(templateAttributes, root, storage);
+
                 const PDFObject& kids = storage->getObject(dictionary->get("Kids"));
                 if (kids.isArray())
                 {
@@ -296,49 +355,7 @@ void PDFPage::parseImpl(std::vector<PDFPage>& pages,
             }
             else if (typeString == "Page")
             {
-                PDFPage page;
-
-                page.m_pageObject = dereferenced;
-                page.m_pageReference = objectReference;
-                page.m_mediaBox = currentInheritableAttributes.getMediaBox();
-                page.m_cropBox = currentInheritableAttributes.getCropBox();
-                page.m_resources = storage->getObject(currentInheritableAttributes.getResources());
-                page.m_pageRotation = currentInheritableAttributes.getPageRotation();
-
-                if (!page.m_cropBox.isValid())
-                {
-                    page.m_cropBox = page.m_mediaBox;
-                }
-
-                PDFDocumentDataLoaderDecorator loader(storage);
-                page.m_bleedBox = loader.readRectangle(dictionary->get("BleedBox"), page.getCropBox());
-                page.m_trimBox = loader.readRectangle(dictionary->get("TrimBox"), page.getCropBox());
-                page.m_artBox = loader.readRectangle(dictionary->get("ArtBox"), page.getCropBox());
-                page.m_contents = storage->getObject(dictionary->get("Contents"));
-                page.m_annots = loader.readReferenceArrayFromDictionary(dictionary, "Annots");
-                page.m_lastModified = PDFEncoding::convertToDateTime(loader.readStringFromDictionary(dictionary, "LastModified"));
-                page.m_thumbnailReference = loader.readReferenceFromDictionary(dictionary, "Thumb");
-                page.m_beads = loader.readReferenceArrayFromDictionary(dictionary, "B");
-                page.m_duration = loader.readIntegerFromDictionary(dictionary, "Dur", 0);
-                page.m_structParent = loader.readIntegerFromDictionary(dictionary, "StructParents", 0);
-                page.m_webCaptureContentSetId = loader.readStringFromDictionary(dictionary, "ID");
-                page.m_preferredZoom = loader.readNumberFromDictionary(dictionary, "PZ", 0.0);
-
-                constexpr const std::array<std::pair<const char*, PageTabOrder>, 5> tabStops =
-                {
-                    std::pair<const char*, PageTabOrder>{ "R", PageTabOrder::Row },
-                    std::pair<const char*, PageTabOrder>{ "C", PageTabOrder::Column },
-                    std::pair<const char*, PageTabOrder>{ "S", PageTabOrder::Structure },
-                    std::pair<const char*, PageTabOrder>{ "A", PageTabOrder::Array },
-                    std::pair<const char*, PageTabOrder>{ "W", PageTabOrder::Widget }
-                };
-
-                page.m_pageTabOrder = loader.readEnumByName(dictionary->get("Tabs"), tabStops.cbegin(), tabStops.cend(), PageTabOrder::Invalid);
-                page.m_templateName = loader.readNameFromDictionary(dictionary, "TemplateInstantiated");
-                page.m_userUnit = loader.readNumberFromDictionary(dictionary, "UserUnit", 1.0);
-                page.m_documentPart = loader.readReferenceFromDictionary(dictionary, "DPart");
-
-                pages.emplace_back(std::move(page));
+                pages.emplace_back(parsePage(storage, templateAttributes, root));
             }
             else
             {
@@ -150,6 +150,14 @@ public:
     /// \param root Root object of page tree
     static std::vector<PDFPage> parse(const PDFObjectStorage* storage, const PDFObject& root);
 
+    /// Parses single page object (leaf of the page tree). If error occurs, then exception is thrown.
+    /// \param storage Storage owning the page
+    /// \param parentAttributes Inheritable attributes of the parent page tree node
+    /// \param pageObject Page object (reference to the page dictionary)
+    static PDFPage parsePage(const PDFObjectStorage* storage,
+                             const PDFPageInheritableAttributes& parentAttributes,
+                             const PDFObject& pageObject);
+
     inline const QRectF& getMediaBox() const { return m_mediaBox; }
     inline const QRectF& getCropBox() const { return m_cropBox; }
     inline const QRectF& getBleedBox() const { return m_bleedBox; }
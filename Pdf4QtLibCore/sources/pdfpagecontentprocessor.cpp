@@ -3189,6 +3189,9 @@ void PDFPageContentProcessor::drawText(const TextSequence& textSequence)
 
         if (!isType3Font)
         {
+            // Glyph outlines are in unit size, shared between all font sizes
+            const QTransform glyphScaleMatrix = QTransform::fromScale(textSequence.glyphScale, textSequence.glyphScale);
+
             for (const TextSequenceItem& item : textSequence.items)
             {
                 PDFReal displacementX = 0.0;
@@ -3214,20 +3217,22 @@ void PDFPageContentProcessor::drawText(const TextSequence& textSequence)
                     // Then get the glyph path and paint it
                     if (item.glyph)
                     {
-                        const QPainterPath& glyphPath = *item.glyph;
+                        const QPainterPath& unitGlyphPath = *item.glyph;
 
                         QTransform textRenderingMatrix = adjustMatrix * textMatrix;
                         QTransform toDeviceSpaceTransform = textRenderingMatrix * m_graphicState.getCurrentTransformationMatrix();
 
-                        if (!glyphPath.isEmpty())
+                        if (!unitGlyphPath.isEmpty())
                         {
-                            QPainterPath transformedGlyph = textRenderingMatrix.map(glyphPath);
+                            // Glyph scale is folded into the matrix, so the shared
+                            // unit size path is transformed only once.
+                            QPainterPath transformedGlyph = (glyphScaleMatrix * textRenderingMatrix).map(unitGlyphPath);
                             processPathPainting(transformedGlyph, stroke, fill, true, transformedGlyph.fillRule());
 
                             if (clipped)
                             {
                                 // Clipping is enabled, we must transform to the device coordinates
-                                m_textClippingPath = m_textClippingPath.united(toDeviceSpaceTransform.map(glyphPath));
+                                m_textClippingPath = m_textClippingPath.united((glyphScaleMatrix * toDeviceSpaceTransform).map(unitGlyphPath));
                             }
                         }
 
@@ -3239,7 +3244,8 @@ void PDFPageContentProcessor::drawText(const TextSequence& textSequence)
                             info.isVerticalWritingSystem = !isHorizontalWritingSystem;
                             info.advance = item.advance;
                             info.fontSize = fontSize;
-                            info.outline = glyphPath;
+                            info.outline = unitGlyphPath;
+                            info.outlineMatrix = glyphScaleMatrix;
                             info.matrix = toDeviceSpaceTransform;
                             performOutputCharacter(info);
                         }
@@ -21,7 +21,9 @@
 #include "pdfpainterutils.h"
 
 #include <QPainter>
+#include <QPaintEngine>
 #include <QCryptographicHash>
+#include <QtEndian>
 #include <QtMath>
 
 #include "pdfdbgheap.h"
@@ -518,6 +520,63 @@ void PDFPrecompiledPage::draw(QPainter* painter,
     painter->setWorldTransform(QTransform());
     painter->setOpacity(opacity);
 
+    // Determine painting instructions, which can be visible. Visible area is determined
+    // from painter's clipping and, for raster devices, from the window. We do not use
+    // the window for other devices (pictures, printers), because it need not to
+    // correspond to the painted area.
+    bool isCullingActive = false;
+    std::vector<uint32_t> visibleInstructions;
+    if (m_spatialIndex.isValid() && m_spatialIndex.instructionCount == m_instructions.size())
+    {
+        QRectF visibleDeviceRect;
+        bool isVisibleDeviceRectValid = false;
+
+        QPaintEngine* paintEngine = painter->paintEngine();
+        if (paintEngine && (paintEngine->type() == QPaintEngine::Raster || paintEngine->type() == QPaintEngine::OpenGL2))
+        {
+            visibleDeviceRect = painter->window();
+            isVisibleDeviceRectValid = true;
+        }
+
+        if (painter->hasClipping())
+        {
+            const QRectF clipRect = painter->clipBoundingRect();
+            visibleDeviceRect = isVisibleDeviceRectValid ? visibleDeviceRect.intersected(clipRect) : clipRect;
+            isVisibleDeviceRectValid = true;
+        }
+
+        if (isVisibleDeviceRectValid)
+        {
+            // Antialiasing and cosmetic pens can paint outside of the
+            // bounding rectangle of the path, so we must enlarge the visible area.
+            const PDFReal margin = 2.0 + m_spatialIndex.maxCosmeticPenWidth;
+            visibleDeviceRect.adjust(-margin, -margin, margin, margin);
+
+            const QRectF visiblePageRect = pagePointToDevicePointMatrix.inverted().mapRect(visibleDeviceRect);
+            if (!visiblePageRect.contains(m_spatialIndex.bounds))
+            {
+                isCullingActive = true;
+                visibleInstructions = getVisibleInstructions(visiblePageRect);
+            }
+        }
+    }
+
+    auto itVisibleInstruction = visibleInstructions.cbegin();
+    auto isInstructionCulled = [&](size_t index)
+    {
+        if (!isCullingActive)
+        {
+            return false;
+        }
+
+        while (itVisibleInstruction != visibleInstructions.cend() && *itVisibleInstruction < index)
+        {
+            ++itVisibleInstruction;
+        }
+
+        return itVisibleInstruction == visibleInstructions.cend() || *itVisibleInstruction != index;
+    };
+
     if (features.testFlag(PDFRenderer::ClipToCropBox))
     {
         if (cropBox.isValid())
@@ -530,18 +589,28 @@ void PDFPrecompiledPage::draw(QPainter* painter,
 
     painter->setRenderHint(QPainter::SmoothPixmapTransform, features.testFlag(PDFRenderer::SmoothImages));
 
-    // Process all instructions
-    for (const Instruction& instruction : m_instructions)
+    // Process all instructions. Instructions, which change state of the painter
+    // (clipping, graphic state, matrix, composition mode) are always executed,
+    // painting instructions outside of the visible area are skipped.
+    for (size_t i = 0, instructionCount = m_instructions.size(); i < instructionCount; ++i)
     {
+        const Instruction& instruction = m_instructions[i];
         switch (instruction.type)
         {
             case InstructionType::DrawPath:
             {
                 const PathPaintData& data = m_paths[instruction.dataIndex];
 
-                // Set antialiasing
+                // Set antialiasing (even for culled path, because it
+                // affects painting of the following images)
                 const bool antialiasing = (data.isText && features.testFlag(PDFRenderer::TextAntialiasing)) || (!data.isText && features.testFlag(PDFRenderer::Antialiasing));
                 painter->setRenderHint(QPainter::Antialiasing, antialiasing);
+
+                if (isInstructionCulled(i))
+                {
+                    break;
+                }
+
                 painter->setPen(data.pen);
                 painter->setBrush(data.brush);
                 painter->drawPath(data.path);
@@ -550,6 +619,11 @@ void PDFPrecompiledPage::draw(QPainter* painter,
 
             case InstructionType::DrawImage:
             {
+                if (isInstructionCulled(i))
+                {
+                    break;
+                }
+
                 const ImageData& data = m_images[instruction.dataIndex];
                 const QImage& image = data.image;
 
@@ -571,6 +645,11 @@ void PDFPrecompiledPage::draw(QPainter* painter,
 
             case InstructionType::DrawMesh:
             {
+                if (isInstructionCulled(i))
+                {
+                    break;
+                }
+
                 const MeshPaintData& data = m_meshes[instruction.dataIndex];
 
                 painter->save();
@@ -629,6 +708,9 @@ void PDFPrecompiledPage::redact(QPainterPath redactPath, const QTransform& matri
         return;
     }
 
+    // Instructions will be changed, so spatial index is no longer valid
+    m_spatialIndex = SpatialIndex();
+
     std::stack<QTransform> worldMatrixStack;
     worldMatrixStack.push(matrix);
 
@@ -840,10 +922,320 @@ void PDFPrecompiledPage::finalize(qint64 compilingTimeNS, QList<PDFRenderError>
     {
         m_memoryConsumptionEstimate += data.mesh.getMemoryConsumptionEstimate();
     }
+
+    buildSpatialIndex();
+    m_memoryConsumptionEstimate += sizeof(QRectF) * m_spatialIndex.boundingRects.capacity();
+    m_memoryConsumptionEstimate += sizeof(uint32_t) * m_spatialIndex.cellOffsets.capacity();
+    m_memoryConsumptionEstimate += sizeof(uint32_t) * m_spatialIndex.items.capacity();
+    m_memoryConsumptionEstimate += sizeof(uint32_t) * m_spatialIndex.unboundedItems.capacity();
+}
+
+void PDFPrecompiledPage::buildSpatialIndex()
+{
+    m_spatialIndex = SpatialIndex();
+
+    // World matrix is unknown until it is set by the instruction (painter
+    // then paints in device coordinates), so bounding rectangles
+    // of such instructions can't be determined.
+    struct MatrixState
+    {
+        QTransform matrix;
+        bool isValid = false;
+    };
+
+    std::stack<MatrixState> matrixStack;
+    matrixStack.push(MatrixState());
+
+    std::vector<QRectF> boundingRects(m_instructions.size(), QRectF());
+    std::vector<uint32_t> boundedItems;
+    std::vector<uint32_t> unboundedItems;
+    PDFReal maxCosmeticPenWidth = 0.0;
+    QRectF bounds;
+
+    for (size_t i = 0; i < m_instructions.size(); ++i)
+    {
+        const Instruction& instruction = m_instructions[i];
+        const MatrixState& matrixState = matrixStack.top();
+
+        QRectF boundingRect;
+        bool isPainting = false;
+        bool isBounded = matrixState.isValid;
+
+        switch (instruction.type)
+        {
+            case InstructionType::DrawPath:
+            {
+                const PathPaintData& data = m_paths[instruction.dataIndex];
+                QRectF pathRect = data.path.controlPointRect();
+
+                if (data.pen.style() != Qt::NoPen)
+                {
+                    if (data.pen.isCosmetic() || qFuzzyIsNull(data.pen.widthF()))
+                    {
+                        maxCosmeticPenWidth = qMax(maxCosmeticPenWidth, qMax(data.pen.widthF(), 1.0));
+                    }
+                    else
+                    {
+                        // Square caps and miter joins can exceed half of the pen width
+                        const bool isMiterJoin = data.pen.joinStyle() == Qt::MiterJoin || data.pen.joinStyle() == Qt::SvgMiterJoin;
+                        const PDFReal factor = isMiterJoin ? qMax(data.pen.miterLimit(), M_SQRT2) : M_SQRT2;
+                        const PDFReal extent = 0.5 * data.pen.widthF() * factor;
+                        pathRect.adjust(-extent, -extent, extent, extent);
+                    }
+                }
+
+                boundingRect = matrixState.matrix.mapRect(pathRect);
+                isPainting = true;
+                break;
+            }
+
+            case InstructionType::DrawImage:
+            {
+                boundingRect = matrixState.matrix.mapRect(QRectF(0.0, 0.0, 1.0, 1.0));
+                isPainting = true;
+                break;
+            }
+
+            case InstructionType::DrawMesh:
+            {
+                // Mesh is painted in page coordinates, triangle edges are
+                // painted with default pen of width 1.
+                boundingRect = m_meshes[instruction.dataIndex].mesh.getBoundingRect().adjusted(-1.0, -1.0, 1.0, 1.0);
+                isPainting = true;
+                isBounded = true;
+                break;
+            }
+
+            case InstructionType::SaveGraphicState:
+                matrixStack.push(matrixStack.top());
+                break;
+
+            case InstructionType::RestoreGraphicState:
+                if (matrixStack.size() > 1)
+                {
+                    matrixStack.pop();
+                }
+                break;
+
+            case InstructionType::SetWorldMatrix:
+                matrixStack.top() = MatrixState{ m_matrices[instruction.dataIndex], true };
+                break;
+
+            default:
+                break;
+        }
+
+        if (!isPainting)
+        {
+            continue;
+        }
+
+        if (isBounded)
+        {
+            boundingRects[i] = boundingRect;
+            bounds = bounds.united(boundingRect);
+            boundedItems.push_back(static_cast<uint32_t>(i));
+        }
+        else
+        {
+            unboundedItems.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    if (boundedItems.empty())
+    {
+        // Nothing to be culled
+        return;
+    }
+
+    // Use approximately one cell for each painting instruction, but limit the grid size
+    const int gridSize = qBound(1, static_cast<int>(std::sqrt(PDFReal(boundedItems.size()))), 64);
+    const int columns = bounds.width() > 0.0 ? gridSize : 1;
+    const int rows = bounds.height() > 0.0 ? gridSize : 1;
+    const PDFReal cellWidth = bounds.width() / columns;
+    const PDFReal cellHeight = bounds.height() / rows;
+
+    auto getCellRange = [&](const QRectF& rect, int& column1, int& column2, int& row1, int& row2)
+    {
+        column1 = cellWidth > 0.0 ? qBound(0, static_cast<int>((rect.left() - bounds.left()) / cellWidth), columns - 1) : 0;
+        column2 = cellWidth > 0.0 ? qBound(0, static_cast<int>((rect.right() - bounds.left()) / cellWidth), columns - 1) : 0;
+        row1 = cellHeight > 0.0 ? qBound(0, static_cast<int>((rect.top() - bounds.top()) / cellHeight), rows - 1) : 0;
+        row2 = cellHeight > 0.0 ? qBound(0, static_cast<int>((rect.bottom() - bounds.top()) / cellHeight), rows - 1) : 0;
+    };
+
+    // Count items in the cells first, then fill them
+    std::vector<uint32_t> cellOffsets(size_t(columns) * size_t(rows) + 1, 0);
+    for (uint32_t item : boundedItems)
+    {
+        int column1 = 0, column2 = 0, row1 = 0, row2 = 0;
+        getCellRange(boundingRects[item], column1, column2, row1, row2);
+
+        for (int row = row1; row <= row2; ++row)
+        {
+            for (int column = column1; column <= column2; ++column)
+            {
+                ++cellOffsets[size_t(row) * columns + column + 1];
+            }
+        }
+    }
+
+    for (size_t i = 1; i < cellOffsets.size(); ++i)
+    {
+        cellOffsets[i] += cellOffsets[i - 1];
+    }
+
+    std::vector<uint32_t> items(cellOffsets.back(), 0);
+    std::vector<uint32_t> cellPositions(cellOffsets.begin(), std::prev(cellOffsets.end()));
+    for (uint32_t item : boundedItems)
+    {
+        int column1 = 0, column2 = 0, row1 = 0, row2 = 0;
+        getCellRange(boundingRects[item], column1, column2, row1, row2);
+
+        for (int row = row1; row <= row2; ++row)
+        {
+            for (int column = column1; column <= column2; ++column)
+            {
+                items[cellPositions[size_t(row) * columns + column]++] = item;
+            }
+        }
+    }
+
+    m_spatialIndex.bounds = bounds;
+    m_spatialIndex.columns = columns;
+    m_spatialIndex.rows = rows;
+    m_spatialIndex.instructionCount = m_instructions.size();
+    m_spatialIndex.maxCosmeticPenWidth = maxCosmeticPenWidth;
+    m_spatialIndex.boundingRects = qMove(boundingRects);
+    m_spatialIndex.cellOffsets = qMove(cellOffsets);
+    m_spatialIndex.items = qMove(items);
+    m_spatialIndex.unboundedItems = qMove(unboundedItems);
+}
+
+std::vector<uint32_t> PDFPrecompiledPage::getVisibleInstructions(const QRectF& rect) const
+{
+    const SpatialIndex& index = m_spatialIndex;
+    std::vector<uint32_t> result = index.unboundedItems;
+
+    // We do not use QRectF::intersects, because it treats rectangles
+    // with zero width or height (horizontal or vertical lines) as empty.
+    auto isIntersecting = [](const QRectF& r1, const QRectF& r2)
+    {
+        return r1.left() <= r2.right() && r2.left() <= r1.right() &&
+               r1.top() <= r2.bottom() && r2.top() <= r1.bottom();
+    };
+
+    if (index.isValid() && isIntersecting(rect, index.bounds))
+    {
+        const PDFReal cellWidth = index.bounds.width() / index.columns;
+        const PDFReal cellHeight = index.bounds.height() / index.rows;
+
+        auto getCell = [](PDFReal value, PDFReal origin, PDFReal cellSize, int count)
+        {
+            return cellSize > 0.0 ? qBound(0, static_cast<int>((value - origin) / cellSize), count - 1) : 0;
+        };
+
+        const int column1 = getCell(rect.left(), index.bounds.left(), cellWidth, index.columns);
+        const int column2 = getCell(rect.right(), index.bounds.left(), cellWidth, index.columns);
+        const int row1 = getCell(rect.top(), index.bounds.top(), cellHeight, index.rows);
+        const int row2 = getCell(rect.bottom(), index.bounds.top(), cellHeight, index.rows);
+
+        for (int row = row1; row <= row2; ++row)
+        {
+            for (int column = column1; column <= column2; ++column)
+            {
+                const size_t cell = size_t(row) * index.columns + column;
+                for (uint32_t i = index.cellOffsets[cell]; i < index.cellOffsets[cell + 1]; ++i)
+                {
+                    const uint32_t item = index.items[i];
+                    if (isIntersecting(rect, index.boundingRects[item]))
+                    {
+                        result.push_back(item);
+                    }
+                }
+            }
+        }
+    }
+
+    // Instruction can be in more cells
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+/// Fast non-cryptographic 64-bit hash (MurmurHash64A). Data are read
+/// as little endian words, so result is the same on all platforms.
+static quint64 calculateFastHash64(const char* data, size_t size, quint64 seed)
+{
+    constexpr quint64 m = 0xc6a4a7935bd1e995ULL;
+    constexpr int r = 47;
+
+    quint64 h = seed ^ (quint64(size) * m);
+
+    const char* end = data + (size / 8) * 8;
+    for (const char* it = data; it != end; it += 8)
+    {
+        quint64 k = qFromLittleEndian<quint64>(it);
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    const size_t remainder = size % 8;
+    if (remainder > 0)
+    {
+        for (size_t i = 0; i < remainder; ++i)
+        {
+            h ^= quint64(uchar(end[i])) << (8 * i);
+        }
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return h;
+}
+
+void PDFPrecompiledPage::calculateHash(QByteArrayView data, HashAlgorithm algorithm, std::array<uint8_t, 64>& hash)
+{
+    hash.fill(0);
+
+    switch (algorithm)
+    {
+        case HashAlgorithm::Sha512:
+        {
+            QByteArray result = QCryptographicHash::hash(data, QCryptographicHash::Sha512);
+            Q_ASSERT(QCryptographicHash::hashLength(QCryptographicHash::Sha512) == 64);
+
+            size_t size = qMin<size_t>(result.length(), hash.size());
+            std::copy(result.data(), result.data() + size, hash.data());
+            break;
+        }
+
+        case HashAlgorithm::Fast:
+        {
+            // Two independent lanes give us 128-bit hash
+            const quint64 h1 = calculateFastHash64(data.data(), data.size(), 0x243f6a8885a308d3ULL);
+            const quint64 h2 = calculateFastHash64(data.data(), data.size(), 0x13198a2e03707344ULL);
+            qToLittleEndian(h1, hash.data());
+            qToLittleEndian(h2, hash.data() + sizeof(quint64));
+            break;
+        }
+
+        default:
+            Q_ASSERT(false);
+            break;
+    }
 }
 
 PDFPrecompiledPage::GraphicPieceInfos PDFPrecompiledPage::calculateGraphicPieceInfos(QRectF mediaBox,
-                                                                                     PDFReal epsilon) const
+                                                                                     PDFReal epsilon,
+                                                                                     HashAlgorithm hashAlgorithm) const
 {
     GraphicPieceInfos infos;
 
@@ -905,12 +1297,7 @@ PDFPrecompiledPage::GraphicPieceInfos PDFPrecompiledPage::calculateGraphicPieceI
                     }
                 }
 
-                QByteArray hash = QCryptographicHash::hash(serializedPath, QCryptographicHash::Sha512);
-                Q_ASSERT(QCryptographicHash::hashLength(QCryptographicHash::Sha512) == 64);
-
-                size_t size = qMin<size_t>(hash.length(), info.hash.size());
-                std::copy(hash.data(), hash.data() + size, info.hash.data());
-
+                calculateHash(serializedPath, hashAlgorithm, info.hash);
                 infos.emplace_back(std::move(info));
                 break;
             }
@@ -959,17 +1346,8 @@ PDFPrecompiledPage::GraphicPieceInfos PDFPrecompiledPage::calculateGraphicPieceI
                     streamImage.writeBytes(reinterpret_cast<const char*>(image.bits()), image.sizeInBytes());
                 }
 
-                QByteArray hash = QCryptographicHash::hash(serializedPath, QCryptographicHash::Sha512);
-                Q_ASSERT(QCryptographicHash::hashLength(QCryptographicHash::Sha512) == 64);
-
-                QByteArray imageHash = QCryptographicHash::hash(serializedImage, QCryptographicHash::Sha512);
-
-                size_t size = qMin<size_t>(hash.length(), info.hash.size());
-                std::copy(hash.data(), hash.data() + size, info.hash.data());
-
-                size_t sizeImage = qMin<size_t>(imageHash.length(), info.imageHash.size());
-                std::copy(imageHash.data(), imageHash.data() + sizeImage, info.imageHash.data());
-
+                calculateHash(serializedPath, hashAlgorithm, info.hash);
+                calculateHash(serializedImage, hashAlgorithm, info.imageHash);
                 infos.emplace_back(std::move(info));
                 break;
             }
@@ -1009,11 +1387,7 @@ PDFPrecompiledPage::GraphicPieceInfos PDFPrecompiledPage::calculateGraphicPieceI
                     stream.writeBytes(reinterpret_cast<const char*>(shadingTestImage.bits()), shadingTestImage.sizeInBytes());
                 }
 
-                QByteArray hash = QCryptographicHash::hash(serializedMesh, QCryptographicHash::Sha512);
-                Q_ASSERT(QCryptographicHash::hashLength(QCryptographicHash::Sha512) == 64);
-
-                size_t size = qMin<size_t>(hash.length(), info.hash.size());
-                std::copy(hash.data(), hash.data() + size, info.hash.data());
+                calculateHash(serializedMesh, hashAlgorithm, info.hash);
 
                 info.boundingRect = QRectF();
                 info.type = GraphicPieceInfo::Type::Shading;
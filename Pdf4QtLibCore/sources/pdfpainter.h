@@ -184,7 +184,9 @@ public:
         size_t dataIndex = 0;
     };
 
-    /// Paints page onto the painter using matrix
+    /// Paints page onto the painter using matrix. Only paths, images and meshes,
+    /// which intersect visible area of the painter (clip rectangle, or the viewport
+    /// of the raster device), are painted, other instructions are always executed.
     /// \param painter Painter, onto which is page drawn
     /// \param cropBox Page's crop box
     /// \param pagePointToDevicePointMatrix Page point to device point transformation matrix
@@ -251,6 +253,21 @@ public:
     /// \sa markAccessed
     bool hasExpired(qint64 timeout) const { return m_expirationTimer.hasExpired(timeout); }
 
+    /// Hash algorithm used to calculate hashes of graphic pieces
+    enum class HashAlgorithm
+    {
+        Sha512, ///< Cryptographic hash (SHA-512)
+        Fast    ///< Fast non-cryptographic hash (128-bit, rest of the hash is zero)
+    };
+
+    /// Calculates hash of the data using given algorithm. Result
+    /// of the fast algorithm doesn't depend on the platform, so it
+    /// can be persisted.
+    /// \param data Data
+    /// \param algorithm Hash algorithm
+    /// \param hash Calculated hash
+    static void calculateHash(QByteArrayView data, HashAlgorithm algorithm, std::array<uint8_t, 64>& hash);
+
     struct GraphicPieceInfo
     {
         enum class Type
@@ -287,8 +304,10 @@ public:
     /// as equal.
     /// \param mediaBox Page's media box
     /// \param epsilon Epsilon
+    /// \param hashAlgorithm Hash algorithm for graphic pieces
     GraphicPieceInfos calculateGraphicPieceInfos(QRectF mediaBox,
-                                                 PDFReal epsilon) const;
+                                                 PDFReal epsilon,
+                                                 HashAlgorithm hashAlgorithm = HashAlgorithm::Sha512) const;
 
 private:
     struct PathPaintData
@@ -347,6 +366,33 @@ private:
         PDFReal alpha = 1.0;
     };
 
+    /// Spatial index of painting instructions (paths, images and meshes). Area
+    /// covered by painting instructions is divided into uniform grid, and each cell
+    /// contains indices of instructions, whose bounding rectangle intersects the cell.
+    /// All rectangles are in page coordinates.
+    struct SpatialIndex
+    {
+        bool isValid() const { return instructionCount > 0; }
+
+        QRectF bounds;
+        int columns = 0;
+        int rows = 0;
+        size_t instructionCount = 0;            ///< Instruction count, for which index was built
+        PDFReal maxCosmeticPenWidth = 0.0;      ///< Maximal width of cosmetic pen (in device pixels)
+        std::vector<QRectF> boundingRects;      ///< Bounding rectangles of instructions
+        std::vector<uint32_t> cellOffsets;      ///< Offsets of cells into the items array (size is cell count + 1)
+        std::vector<uint32_t> items;            ///< Instruction indices of the cells
+        std::vector<uint32_t> unboundedItems;   ///< Instructions with unknown bounding rectangle (always painted)
+    };
+
+    /// Builds spatial index of the painting instructions
+    void buildSpatialIndex();
+
+    /// Returns sorted indices of painting instructions, which
+    /// can be visible in the given rectangle.
+    /// \param rect Visible rectangle in page coordinates
+    std::vector<uint32_t> getVisibleInstructions(const QRectF& rect) const;
+
     qint64 m_compilingTimeNS = 0;
     qint64 m_memoryConsumptionEstimate = 0;
     QColor m_paperColor = QColor(Qt::white);
@@ -357,6 +403,7 @@ private:
     std::vector<MeshPaintData> m_meshes;
     std::vector<QTransform> m_matrices;
     std::vector<QPainter::CompositionMode> m_compositionModes;
+    SpatialIndex m_spatialIndex;
     QList<PDFRenderError> m_errors;
     PDFSnapInfo m_snapInfo;
     QElapsedTimer m_expirationTimer;
@@ -694,12 +694,19 @@ PDFMesh PDFFunctionShading::createMesh(const PDFMeshQualitySettings& settings,
         };
 
         const bool isSingleFunction = m_functions.size() == 1;
+        const bool isBatchFunction = isSingleFunction &&
+                                     m_functions.front()->getInputVariableCount() == 2 &&
+                                     m_functions.front()->getOutputVariableCount() == colorComponents;
         std::vector<PDFReal> sourceColorBuffer;
         sourceColorBuffer.resize(indices.size() * colorComponents, 0.0);
 
         std::vector<QPointF> gridPoints;
         gridPoints.resize(nodesCount);
 
+        // Domain coordinates of the grid points (two values for each point)
+        std::vector<PDFReal> domainPoints;
+        domainPoints.resize(nodesCount * 2, 0.0);
+
         QMutex functionErrorMutex;
         PDFFunction::FunctionResult functionError(true);
 
@@ -716,11 +723,19 @@ PDFMesh PDFFunctionShading::createMesh(const PDFMeshQualitySettings& settings,
             PDFReal* sourceColorBegin = sourceColorBuffer.data() + colorComponentIndex;
             PDFReal* sourceColorEnd = sourceColorBegin + colorComponents;
 
-            std::array<PDFReal, 2> uv = { node.x(), node.y() };
+            PDFReal* uv = domainPoints.data() + 2 * index;
+            uv[0] = node.x();
+            uv[1] = node.y();
+
+            if (isBatchFunction)
+            {
+                // Colors are evaluated for whole rows at once
+                return;
+            }
 
             if (isSingleFunction)
             {
-                PDFFunction::FunctionResult result = m_functions.front()->apply(uv.data(), uv.data() + uv.size(), sourceColorBegin, sourceColorEnd);
+                PDFFunction::FunctionResult result = m_functions.front()->apply(uv, uv + 2, sourceColorBegin, sourceColorEnd);
                 if (!result)
                 {
                     QMutexLocker lock(&functionErrorMutex);
@@ -734,7 +749,7 @@ PDFMesh PDFFunctionShading::createMesh(const PDFMeshQualitySettings& settings,
             {
                 for (size_t i = 0, count = colorComponents; i < count; ++i)
                 {
-                    PDFFunction::FunctionResult result = m_functions[i]->apply(uv.data(), uv.data() + uv.size(), sourceColorBegin + i, sourceColorBegin + i + 1);
+                    PDFFunction::FunctionResult result = m_functions[i]->apply(uv, uv + 2, sourceColorBegin + i, sourceColorBegin + i + 1);
                     if (!result)
                     {
                         QMutexLocker lock(&functionErrorMutex);
@@ -749,6 +764,31 @@ PDFMesh PDFFunctionShading::createMesh(const PDFMeshQualitySettings& settings,
 
         PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Content, indices.cbegin(), indices.cend(), setColor);
 
+        if (isBatchFunction)
+        {
+            std::vector<size_t> rows;
+            rows.resize(rowCount, 0);
+            std::iota(rows.begin(), rows.end(), 0);
+
+            auto setRowColors = [&](size_t row)
+            {
+                const PDFReal* uv = domainPoints.data() + 2 * rowColumnToIndex(row, 0);
+                PDFReal* sourceColor = sourceColorBuffer.data() + rowColumnToFirstColorComponent(row, 0);
+
+                PDFFunction::FunctionResult result = m_functions.front()->applyBatch(uv, sourceColor, columnCount);
+                if (!result)
+                {
+                    QMutexLocker lock(&functionErrorMutex);
+                    if (!functionError)
+                    {
+                        functionError = result;
+                    }
+                }
+            };
+
+            PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Content, rows.cbegin(), rows.cend(), setRowColors);
+        }
+
         if (!functionError)
         {
             throw PDFRendererException(RenderErrorType::Error, PDFTranslationContext::tr("Error occured during mesh generation of shading: %1").arg(functionError.errorMessage));
@@ -1409,6 +1449,41 @@ qint64 PDFMesh::getMemoryConsumptionEstimate() const
     return memoryConsumption;
 }
 
+QRectF PDFMesh::getBoundingRect() const
+{
+    QRectF boundingRect;
+
+    if (!m_vertices.empty())
+    {
+        PDFReal xMin = m_vertices.front().x();
+        PDFReal xMax = xMin;
+        PDFReal yMin = m_vertices.front().y();
+        PDFReal yMax = yMin;
+
+        for (const QPointF& vertex : m_vertices)
+        {
+            xMin = qMin(xMin, vertex.x());
+            xMax = qMax(xMax, vertex.x());
+            yMin = qMin(yMin, vertex.y());
+            yMax = qMax(yMax, vertex.y());
+        }
+
+        boundingRect = QRectF(xMin, yMin, xMax - xMin, yMax - yMin);
+    }
+
+    if (!m_backgroundPath.isEmpty() && m_backgroundColor.isValid())
+    {
+        boundingRect = boundingRect.united(m_backgroundPath.controlPointRect());
+    }
+
+    if (!m_boundingPath.isEmpty())
+    {
+        boundingRect = boundingRect.intersected(m_boundingPath.controlPointRect());
+    }
+
+    return boundingRect;
+}
+
 void PDFMesh::convertColors(const PDFColorConvertor& colorConvertor)
 {
     for (Triangle& triangle : m_triangles)
@@ -145,6 +145,10 @@ public:
     /// Returns estimate of number of bytes, which this mesh occupies in memory
     qint64 getMemoryConsumptionEstimate() const;
 
+    /// Returns bounding rectangle of the painted area of the mesh (vertices
+    /// and background, restricted by the bounding path)
+    QRectF getBoundingRect() const;
+
     /// Apply color conversion
     void convertColors(const PDFColorConvertor& colorConvertor);
 
@@ -19,6 +19,7 @@
 #include "pdfpainter.h"
 #include "pdfdocumentbuilder.h"
 #include "pdfoptimizer.h"
+#include "pdfexecutionpolicy.h"
 #include "pdfdbgheap.h"
 
 namespace pdf
@@ -42,49 +43,28 @@ PDFRedact::PDFRedact(const PDFDocument* document,
 
 PDFDocument PDFRedact::perform(Options options)
 {
-    PDFDocumentBuilder builder;
-    builder.createDocument();
-
-    PDFRenderer renderer(m_document,
-                         m_fontCache,
-                         m_cms,
-                         m_optionalContentActivity,
-                         PDFRenderer::None,
-                         *m_meshQualitySettings);
-
-    std::map<PDFObjectReference, PDFObjectReference> mapOldPageRefToNewPageRef;
+    const size_t pageCount = m_document->getCatalog()->getPageCount();
 
-    for (size_t i = 0; i < m_document->getCatalog()->getPageCount(); ++i)
+    // Find pages with redact annotations. Only these pages are compiled
+    // and redacted, other pages are carried over unchanged.
+    struct RedactedPage
     {
-        const PDFPage* page = m_document->getCatalog()->getPage(i);
-
+        size_t pageIndex = 0;
+        QPainterPath redactPath;
         PDFPrecompiledPage compiledPage;
-        renderer.compile(&compiledPage, i);
-
-        PDFObjectReference newPageReference = builder.appendPage(page->getMediaBox());
-        mapOldPageRefToNewPageRef[page->getPageReference()] = newPageReference;
+    };
 
-        if (!page->getCropBox().isEmpty())
-        {
-            builder.setPageCropBox(newPageReference, page->getCropBox());
-        }
-        if (!page->getBleedBox().isEmpty())
-        {
-            builder.setPageBleedBox(newPageReference, page->getBleedBox());
-        }
-        if (!page->getTrimBox().isEmpty())
-        {
-            builder.setPageTrimBox(newPageReference, page->getTrimBox());
-        }
-        if (!page->getArtBox().isEmpty())
+    std::vector<RedactedPage> redactedPages;
+    for (size_t i = 0; i < pageCount; ++i)
+    {
+        const PDFPage* page = m_document->getCatalog()->getPage(i);
+        if (!page)
         {
-            builder.setPageArtBox(newPageReference, page->getArtBox());
+            continue;
         }
-        builder.setPageRotation(newPageReference, page->getPageRotation());
-
-        PDFPageContentStreamBuilder contentStreamBuilder(&builder);
 
         QPainterPath redactPath;
+        bool hasRedactAnnotation = false;
 
         for (const PDFObjectReference& annotationReference : page->getAnnotations())
         {
@@ -99,18 +79,123 @@ PDFDocument PDFRedact::perform(Options options)
             Q_ASSERT(redactAnnotation);
 
             redactPath = redactPath.united(redactAnnotation->getRedactionRegion().getPath());
+            hasRedactAnnotation = true;
         }
 
+        if (hasRedactAnnotation)
+        {
+            RedactedPage redactedPage;
+            redactedPage.pageIndex = i;
+            redactedPage.redactPath = qMove(redactPath);
+            redactedPages.emplace_back(qMove(redactedPage));
+        }
+    }
+
+    // Compile and redact affected pages in parallel
+    auto redactPage = [this](RedactedPage& redactedPage)
+    {
+        const PDFPage* page = m_document->getCatalog()->getPage(redactedPage.pageIndex);
+
+        PDFRenderer renderer(m_document,
+                             m_fontCache,
+                             m_cms,
+                             m_optionalContentActivity,
+                             PDFRenderer::None,
+                             *m_meshQualitySettings);
+        renderer.compile(&redactedPage.compiledPage, redactedPage.pageIndex);
+
         QTransform matrix;
         matrix.translate(0, page->getMediaBox().height());
         matrix.scale(1.0, -1.0);
 
-        QPainter* painter = contentStreamBuilder.begin(newPageReference);
-        compiledPage.redact(redactPath, matrix, m_redactFillColor);
-        compiledPage.draw(painter, QRectF(), matrix, PDFRenderer::None, 1.0);
+        redactedPage.compiledPage.redact(redactedPage.redactPath, matrix, m_redactFillColor);
+    };
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, redactedPages.begin(), redactedPages.end(), redactPage);
+
+    // Replace redacted pages in the copy of the source document. Redacted page
+    // is replaced by a new page dictionary under the same reference, so all
+    // references to the page (links, outline, ...) remain valid. Nothing
+    // from the original page (annotations, thumbnail, content) is kept.
+    PDFDocumentBuilder temporaryBuilder(m_document);
+    temporaryBuilder.flattenPageTree();
+
+    for (RedactedPage& redactedPage : redactedPages)
+    {
+        const PDFPage* page = m_document->getCatalog()->getPage(redactedPage.pageIndex);
+        const PDFObjectReference pageReference = page->getPageReference();
+
+        // Annotation objects themselves can be referenced from elsewhere
+        // (for example, form fields), so we must erase them, because their
+        // appearance streams can contain redacted content.
+        for (const PDFObjectReference& annotationReference : page->getAnnotations())
+        {
+            temporaryBuilder.setObject(annotationReference, PDFObject());
+        }
+
+        PDFObjectFactory pageFactory;
+        pageFactory.beginDictionary();
+        pageFactory.beginDictionaryItem("Type");
+        pageFactory << WrapName("Page");
+        pageFactory.endDictionaryItem();
+        pageFactory.beginDictionaryItem("MediaBox");
+        pageFactory << page->getMediaBox();
+        pageFactory.endDictionaryItem();
+        pageFactory.endDictionary();
+
+        // Parent is set later, when page tree of new document is flattened
+        temporaryBuilder.setObject(pageReference, pageFactory.takeObject());
+
+        if (!page->getCropBox().isEmpty())
+        {
+            temporaryBuilder.setPageCropBox(pageReference, page->getCropBox());
+        }
+        if (!page->getBleedBox().isEmpty())
+        {
+            temporaryBuilder.setPageBleedBox(pageReference, page->getBleedBox());
+        }
+        if (!page->getTrimBox().isEmpty())
+        {
+            temporaryBuilder.setPageTrimBox(pageReference, page->getTrimBox());
+        }
+        if (!page->getArtBox().isEmpty())
+        {
+            temporaryBuilder.setPageArtBox(pageReference, page->getArtBox());
+        }
+        temporaryBuilder.setPageRotation(pageReference, page->getPageRotation());
+
+        QTransform matrix;
+        matrix.translate(0, page->getMediaBox().height());
+        matrix.scale(1.0, -1.0);
+
+        PDFPageContentStreamBuilder contentStreamBuilder(&temporaryBuilder);
+        QPainter* painter = contentStreamBuilder.begin(pageReference);
+        redactedPage.compiledPage.draw(painter, QRectF(), matrix, PDFRenderer::None, 1.0);
         contentStreamBuilder.end(painter);
+
+        // Release compiled page, we do not need it anymore
+        redactedPage.compiledPage = PDFPrecompiledPage();
+    }
+
+    // Copy pages to the new document. Pages are copied all at once, so shared
+    // resources are copied only once and references between pages are kept.
+    PDFDocumentBuilder builder;
+    builder.createDocument();
+
+    std::vector<PDFObjectReference> oldPageReferences = temporaryBuilder.getPages();
+    std::vector<PDFObjectReference> newPageReferences = PDFDocumentBuilder::createReferencesFromObjects(builder.copyFrom(PDFDocumentBuilder::createObjectsFromReferences(oldPageReferences), *temporaryBuilder.getStorage(), true));
+    Q_ASSERT(oldPageReferences.size() == newPageReferences.size());
+
+    std::map<PDFObjectReference, PDFObjectReference> mapOldPageRefToNewPageRef;
+    for (size_t i = 0; i < oldPageReferences.size(); ++i)
+    {
+        mapOldPageRefToNewPageRef[oldPageReferences[i]] = newPageReferences[i];
     }
 
+    builder.setPages(newPageReferences);
+
+    // Correct page tree (invalid parents are present)
+    builder.flattenPageTree();
+
     if (options.testFlag(CopyTitle))
     {
         builder.setDocumentTitle(m_document->getInfo()->title);
@@ -25,8 +25,9 @@ namespace pdf
 {
 
 /// Create redacted document from the document, which have redact annotations.
-/// Redacted document has removed content marked by these annotations, and
-/// annotations themselfs are removed.
+/// Only pages containing redact annotations are redacted (in parallel). Content
+/// marked by these annotations is removed from them, together with all their
+/// annotations. Other pages are copied unchanged, including their annotations.
 class PDF4QTLIBCORESHARED_EXPORT PDFRedact
 {
 public:
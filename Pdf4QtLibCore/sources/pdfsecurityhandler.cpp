@@ -60,6 +60,63 @@ void sk_x509_free_impl(STACK_OF(X509)* ptr)
     sk_X509_free(ptr);
 }
 
+/// Encrypts or decrypts data using AES in CBC mode. OpenSSL EVP interface is used,
+/// so hardware acceleration (AES-NI) is used, if it is available. No padding is
+/// added or removed, so size of the data must be multiple of AES_BLOCK_SIZE.
+/// Returns false, if data can't be processed.
+/// \param key Key
+/// \param keyLength Key length in bytes (16, 24 or 32)
+/// \param initializationVector Initialization vector (of size AES_BLOCK_SIZE)
+/// \param input Input data
+/// \param size Size of input data
+/// \param output Output data (can be the same as input)
+/// \param encrypt Encrypt (true), or decrypt (false)
+static bool processAES_CBC(const unsigned char* key,
+                           int keyLength,
+                           const unsigned char* initializationVector,
+                           const unsigned char* input,
+                           qsizetype size,
+                           unsigned char* output,
+                           bool encrypt)
+{
+    const EVP_CIPHER* cipher = nullptr;
+    switch (keyLength)
+    {
+        case 16:
+            cipher = EVP_aes_128_cbc();
+            break;
+
+        case 24:
+            cipher = EVP_aes_192_cbc();
+            break;
+
+        case 32:
+            cipher = EVP_aes_256_cbc();
+            break;
+
+        default:
+            return false;
+    }
+
+    if (size % AES_BLOCK_SIZE != 0 || size > std::numeric_limits<int>::max())
+    {
+        return false;
+    }
+
+    openssl_ptr<EVP_CIPHER_CTX> context(EVP_CIPHER_CTX_new(), &EVP_CIPHER_CTX_free);
+    if (!context)
+    {
+        return false;
+    }
+
+    int outputLength = 0;
+    int finalLength = 0;
+    return EVP_CipherInit_ex(context.get(), cipher, nullptr, key, initializationVector, encrypt ? 1 : 0) == 1 &&
+           EVP_CIPHER_CTX_set_padding(context.get(), 0) == 1 &&
+           EVP_CipherUpdate(context.get(), output, &outputLength, input, static_cast<int>(size)) == 1 &&
+           EVP_CipherFinal_ex(context.get(), output + outputLength, &finalLength) == 1;
+}
+
 // Padding password
 static constexpr std::array<uint8_t, 32> PDFPasswordPadding = {
     0x28, 0xBF, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x41,
@@ -86,6 +143,17 @@ public:
         m_objectStack.reserve(32);
     }
 
+    /// Creates visitor, which decrypts strings immediately, but content of streams
+    /// is decrypted, when it is accessed for the first time.
+    explicit PDFDecryptOrEncryptObjectVisitor(PDFSecurityHandlerPointer securityHandler, PDFObjectReference reference) :
+        m_securityHandler(securityHandler.data()),
+        m_lazyDecryptionSecurityHandler(qMove(securityHandler)),
+        m_reference(reference),
+        m_mode(Mode::Decrypt)
+    {
+        m_objectStack.reserve(32);
+    }
+
     virtual void visitNull() override;
     virtual void visitBool(bool value) override;
     virtual void visitInt(PDFInteger value) override;
@@ -101,6 +169,7 @@ public:
 
 private:
     const PDFSecurityHandler* m_securityHandler = nullptr;
+    PDFSecurityHandlerPointer m_lazyDecryptionSecurityHandler;
     std::vector<PDFObject> m_objectStack;
     PDFObjectReference m_reference;
     Mode m_mode = Mode::Decrypt;
@@ -222,6 +291,19 @@ void PDFDecryptOrEncryptObjectVisitor::visitStream(const PDFStream* stream)
         const bool isEmbeddedFile = object.isName() && object.getString() == "EmbeddedFile";
         const PDFSecurityHandler::EncryptionScope scope = !isEmbeddedFile ? PDFSecurityHandler::EncryptionScope::Stream : PDFSecurityHandler::EncryptionScope::EmbeddedFile;
 
+        if (m_lazyDecryptionSecurityHandler)
+        {
+            // Stream content will be decrypted, when it is needed. Length entry
+            // remains the length of the encrypted data, until the document is written.
+            PDFStream::DecryptFunction decryptFunction = [securityHandler = m_lazyDecryptionSecurityHandler, reference = m_reference, scope](const QByteArray& data)
+            {
+                return securityHandler->decrypt(data, reference, scope);
+            };
+
+            m_objectStack.push_back(PDFObject::createStream(std::make_shared<PDFStream>(qMove(processedDictionary), QByteArray(*stream->getContent()), qMove(decryptFunction))));
+            return;
+        }
+
         switch (m_mode)
         {
             case pdf::PDFDecryptOrEncryptObjectVisitor::Mode::Decrypt:
@@ -284,6 +366,13 @@ PDFObject PDFSecurityHandler::decryptObject(const PDFObject& object, PDFObjectRe
     return visitor.getProcessedObject();
 }
 
+PDFObject PDFSecurityHandler::decryptObjectLazily(const PDFSecurityHandlerPointer& securityHandler, const PDFObject& object, PDFObjectReference reference)
+{
+    PDFDecryptOrEncryptObjectVisitor visitor(securityHandler, reference);
+    object.accept(&visitor);
+    return visitor.getProcessedObject();
+}
+
 PDFObject PDFSecurityHandler::encryptObject(const PDFObject& object, PDFObjectReference reference) const
 {
     PDFDecryptOrEncryptObjectVisitor visitor(this, reference, PDFDecryptOrEncryptObjectVisitor::Mode::Encrypt);
@@ -848,50 +937,36 @@ QByteArray PDFStandardOrPublicSecurityHandler::decryptUsingFilter(const QByteArr
 
     Q_ASSERT(m_authorizationData.isAuthorized());
 
-    struct AES_data
-    {
-        QByteArray initializationVector;
-        QByteArray paddedData;
-    };
-
-    auto prepareAES_data = [](const QByteArray& data)
+    // Decrypts AES data. First AES_BLOCK_SIZE bytes are initialization vector,
+    // decrypted data are written directly to the result (without temporary copies).
+    auto decryptAES = [&data, &decryptedData](const unsigned char* key, int keyLength)
     {
-        AES_data result;
-
-        result.initializationVector = data.left(AES_BLOCK_SIZE);
-
-        // This is an error. But to handle it, we resize the vector
-        // with arbitrary data.
-        if (result.initializationVector.size() < AES_BLOCK_SIZE)
-        {
-            result.initializationVector.resize(AES_BLOCK_SIZE);
-        }
-
-        result.paddedData = data.mid(AES_BLOCK_SIZE);
+        // This is an error. But to handle it, we use zero bytes
+        // as missing bytes of the initialization vector.
+        std::array<unsigned char, AES_BLOCK_SIZE> initializationVector = { };
+        std::copy_n(convertByteArrayToUcharPtr(data), qMin<qsizetype>(data.size(), AES_BLOCK_SIZE), initializationVector.begin());
 
         // Remove errorneous data - we must have a data of multiple of AES_BLOCK_SIZE
-        const int remainder = result.paddedData.size() % AES_BLOCK_SIZE;
-        if (remainder != 0)
+        qsizetype size = qMax<qsizetype>(data.size() - AES_BLOCK_SIZE, 0);
+        size -= size % AES_BLOCK_SIZE;
+
+        if (size == 0)
         {
-            result.paddedData = result.paddedData.left(result.paddedData.size() - remainder);
+            return;
         }
 
-        return result;
-    };
-
-    auto removeAES_padding = [](const QByteArray& data)
-    {
-        if (data.isEmpty())
+        decryptedData.resize(size);
+        if (!processAES_CBC(key, keyLength, initializationVector.data(), convertByteArrayToUcharPtr(data) + AES_BLOCK_SIZE, size, convertByteArrayToUcharPtr(decryptedData), false))
         {
-            return data;
+            decryptedData.clear();
+            return;
         }
 
         // If padding doesnt fit from 1 to AES_BLOCK_SIZE, then it is
         // an error, but just clamp the value.
-        const int padding = data.back();
+        const int padding = decryptedData.back();
         const int clampedPadding = qBound(1, padding, AES_BLOCK_SIZE);
-
-        return data.left(data.size() - clampedPadding);
+        decryptedData.truncate(decryptedData.size() - clampedPadding);
     };
 
     switch (filter.type)
@@ -921,35 +996,14 @@ QByteArray PDFStandardOrPublicSecurityHandler::decryptUsingFilter(const QByteArr
             std::vector<uint8_t> objectEncryptionKey = createAESV2_ObjectEncryptionKey(reference);
 
             // For AES algorithm, always use 16 bytes key (128 bit encryption mode)
-
-            AES_KEY key = { };
-            AES_set_decrypt_key(objectEncryptionKey.data(), static_cast<int>(objectEncryptionKey.size()) * 8, &key);
-
-            AES_data aes_data = prepareAES_data(data);
-            if (!aes_data.paddedData.isEmpty())
-            {
-                decryptedData.resize(aes_data.paddedData.size());
-                AES_cbc_encrypt(convertByteArrayToUcharPtr(aes_data.paddedData), convertByteArrayToUcharPtr(decryptedData), aes_data.paddedData.length(), &key, convertByteArrayToUcharPtr(aes_data.initializationVector), AES_DECRYPT);
-                decryptedData = removeAES_padding(decryptedData);
-            }
-
+            decryptAES(objectEncryptionKey.data(), static_cast<int>(objectEncryptionKey.size()));
             break;
         }
 
         case CryptFilterType::AESV3:      // Use file encryption key for AES 256 bit algorithm
         {
             Q_ASSERT(m_authorizationData.fileEncryptionKey.size() == 32);
-            AES_KEY key = { };
-            AES_set_decrypt_key(convertByteArrayToUcharPtr(m_authorizationData.fileEncryptionKey), static_cast<int>(m_authorizationData.fileEncryptionKey.size()) * 8, &key);
-
-            AES_data aes_data = prepareAES_data(data);
-            if (!aes_data.paddedData.isEmpty())
-            {
-                decryptedData.resize(aes_data.paddedData.size());
-                AES_cbc_encrypt(convertByteArrayToUcharPtr(aes_data.paddedData), convertByteArrayToUcharPtr(decryptedData), aes_data.paddedData.length(), &key, convertByteArrayToUcharPtr(aes_data.initializationVector), AES_DECRYPT);
-                decryptedData = removeAES_padding(decryptedData);
-            }
-
+            decryptAES(convertByteArrayToUcharPtr(m_authorizationData.fileEncryptionKey), static_cast<int>(m_authorizationData.fileEncryptionKey.size()));
             break;
         }
 
@@ -1002,6 +1056,21 @@ QByteArray PDFStandardOrPublicSecurityHandler::encryptUsingFilter(const QByteArr
         return result;
     };
 
+    // Encrypts data using AES, initialization vector is prepended to the encrypted data
+    auto encryptAES = [&data, &encryptedData, &prepareAES_data](const unsigned char* key, int keyLength)
+    {
+        AES_data aes_data = prepareAES_data(data);
+        if (!aes_data.paddedData.isEmpty())
+        {
+            encryptedData.resize(AES_BLOCK_SIZE + aes_data.paddedData.size());
+            std::copy_n(convertByteArrayToUcharPtr(aes_data.initializationVector), AES_BLOCK_SIZE, convertByteArrayToUcharPtr(encryptedData));
+            if (!processAES_CBC(key, keyLength, convertByteArrayToUcharPtr(aes_data.initializationVector), convertByteArrayToUcharPtr(aes_data.paddedData), aes_data.paddedData.size(), convertByteArrayToUcharPtr(encryptedData) + AES_BLOCK_SIZE, true))
+            {
+                throw PDFException(PDFTranslationContext::tr("Encryption of data failed."));
+            }
+        }
+    };
+
     switch (filter.type)
     {
         case CryptFilterType::None:       // The application shall encrypt the data using the security handler
@@ -1031,17 +1100,7 @@ QByteArray PDFStandardOrPublicSecurityHandler::encryptUsingFilter(const QByteArr
 
             // For AES algorithm, always use 16 bytes key (128 bit encryption mode)
 
-            AES_KEY key = { };
-            AES_set_encrypt_key(objectEncryptionKey.data(), static_cast<int>(objectEncryptionKey.size()) * 8, &key);
-
-            AES_data aes_data = prepareAES_data(data);
-            if (!aes_data.paddedData.isEmpty())
-            {
-                QByteArray initializationVectorCopy = aes_data.initializationVector;
-                encryptedData.resize(aes_data.paddedData.size());
-                AES_cbc_encrypt(convertByteArrayToUcharPtr(aes_data.paddedData), convertByteArrayToUcharPtr(encryptedData), aes_data.paddedData.length(), &key, convertByteArrayToUcharPtr(aes_data.initializationVector), AES_ENCRYPT);
-                encryptedData.prepend(initializationVectorCopy);
-            }
+            encryptAES(objectEncryptionKey.data(), static_cast<int>(objectEncryptionKey.size()));
 
             break;
         }
@@ -1049,17 +1108,7 @@ QByteArray PDFStandardOrPublicSecurityHandler::encryptUsingFilter(const QByteArr
         case CryptFilterType::AESV3:      // Use file encryption key for AES 256 bit algorithm
         {
             Q_ASSERT(m_authorizationData.fileEncryptionKey.size() == 32);
-            AES_KEY key = { };
-            AES_set_encrypt_key(convertByteArrayToUcharPtr(m_authorizationData.fileEncryptionKey), static_cast<int>(m_authorizationData.fileEncryptionKey.size()) * 8, &key);
-
-            AES_data aes_data = prepareAES_data(data);
-            if (!aes_data.paddedData.isEmpty())
-            {
-                QByteArray initializationVectorCopy = aes_data.initializationVector;
-                encryptedData.resize(aes_data.paddedData.size());
-                AES_cbc_encrypt(convertByteArrayToUcharPtr(aes_data.paddedData), convertByteArrayToUcharPtr(encryptedData), aes_data.paddedData.length(), &key, convertByteArrayToUcharPtr(aes_data.initializationVector), AES_ENCRYPT);
-                encryptedData.prepend(initializationVectorCopy);
-            }
+            encryptAES(convertByteArrayToUcharPtr(m_authorizationData.fileEncryptionKey), static_cast<int>(m_authorizationData.fileEncryptionKey.size()));
 
             break;
         }
@@ -142,6 +142,15 @@ public:
     /// \returns Decrypted object
     PDFObject decryptObject(const PDFObject& object, PDFObjectReference reference) const;
 
+    /// Decrypts the PDF object. Strings are decrypted immediately, but content of the streams
+    /// is decrypted, when it is accessed for the first time. Security handler must remain
+    /// authorized and must not be changed after this call.
+    /// \param securityHandler Security handler
+    /// \param object Object to be decrypted
+    /// \param reference Reference of indirect object
+    /// \returns Decrypted object
+    static PDFObject decryptObjectLazily(const PDFSecurityHandlerPointer& securityHandler, const PDFObject& object, PDFObjectReference reference);
+
     /// Encrypts the PDF object. This function works properly only (and only if)
     /// \p authenticate function returns user/owner authorization code.
     /// \param object Object to be encrypted
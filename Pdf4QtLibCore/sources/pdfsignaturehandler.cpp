@@ -20,6 +20,7 @@
 #include "pdfencoding.h"
 #include "pdfform.h"
 #include "pdfutils.h"
+#include "pdfexecutionpolicy.h"
 #include "pdfsignaturehandler_impl.h"
 
 #if defined(PDF4QT_COMPILER_MINGW) || defined(PDF4QT_COMPILER_GCC)
@@ -154,30 +155,33 @@ PDFSignature PDFSignature::parse(const PDFObjectStorage* storage, PDFObject obje
     return result;
 }
 
-PDFSignatureHandler* PDFSignatureHandler::createHandler(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters)
+PDFSignatureHandler* PDFSignatureHandler::createHandler(const PDFFormFieldSignature* signatureField,
+                                                        const QByteArray& sourceData,
+                                                        const Parameters& parameters,
+                                                        std::shared_ptr<const PDFSignatureTrustedCertificates> trustedCertificates)
 {
     Q_ASSERT(signatureField);
 
     const QByteArray& subfilter = signatureField->getSignature().getSubfilter();
     if (subfilter == "adbe.pkcs7.detached")
     {
-        return new PDFSignatureHandler_adbe_pkcs7_detached(signatureField, sourceData, parameters);
+        return new PDFSignatureHandler_adbe_pkcs7_detached(signatureField, sourceData, parameters, qMove(trustedCertificates));
     }
     else if (subfilter == "adbe.pkcs7.sha1")
     {
-        return new PDFSignatureHandler_adbe_pkcs7_sha1(signatureField, sourceData, parameters);
+        return new PDFSignatureHandler_adbe_pkcs7_sha1(signatureField, sourceData, parameters, qMove(trustedCertificates));
     }
     else if (subfilter == "adbe.x509.rsa_sha1")
     {
-        return new PDFSignatureHandler_adbe_pkcs7_rsa_sha1(signatureField, sourceData, parameters);
+        return new PDFSignatureHandler_adbe_pkcs7_rsa_sha1(signatureField, sourceData, parameters, qMove(trustedCertificates));
     }
     else if (subfilter == "ETSI.CAdES.detached")
     {
-        return new PDFSignatureHandler_ETSI_CAdES_detached(signatureField, sourceData, parameters);
+        return new PDFSignatureHandler_ETSI_CAdES_detached(signatureField, sourceData, parameters, qMove(trustedCertificates));
     }
     else if (subfilter == "ETSI.RFC3161")
     {
-        return new PDFSignatureHandler_ETSI_RFC3161(signatureField, sourceData, parameters);
+        return new PDFSignatureHandler_ETSI_RFC3161(signatureField, sourceData, parameters, qMove(trustedCertificates));
     }
 
     return nullptr;
@@ -200,13 +204,28 @@ std::vector<PDFSignatureVerificationResult> PDFSignatureHandler::verifySignature
             }
         };
         form.apply(getSignatureFields);
-        result.reserve(signatureFields.size());
+        result.resize(signatureFields.size());
 
-        for (const PDFFormFieldSignature* signatureField : signatureFields)
+        if (signatureFields.empty())
         {
-            if (const PDFSignatureHandler* signatureHandler = createHandler(signatureField, sourceData, parameters))
+            return result;
+        }
+
+        {
+            // Initialization of the library is not thread safe in older
+            // versions of OpenSSL, so do it only once, before verification.
+            PDFOpenSSLGlobalLock lock;
+            OpenSSL_add_all_algorithms();
+        }
+
+        auto trustedCertificates = std::make_shared<const PDFSignatureTrustedCertificates>(parameters);
+
+        auto verifySignature = [&](size_t index)
+        {
+            const PDFFormFieldSignature* signatureField = signatureFields[index];
+            if (const PDFSignatureHandler* signatureHandler = createHandler(signatureField, sourceData, parameters, trustedCertificates))
             {
-                result.emplace_back(signatureHandler->verify());
+                result[index] = signatureHandler->verify();
                 delete signatureHandler;
             }
             else
@@ -215,9 +234,13 @@ std::vector<PDFSignatureVerificationResult> PDFSignatureHandler::verifySignature
                 QString qualifiedName = signatureField->getName(PDFFormField::NameType::FullyQualified);
                 PDFSignatureVerificationResult verificationResult(signatureField->getSignature().getType(), signatureFieldReference, qMove(qualifiedName));
                 verificationResult.addNoHandlerError(signatureField->getSignature().getSubfilter());
-                result.emplace_back(qMove(verificationResult));
+                result[index] = qMove(verificationResult);
             }
-        }
+        };
+
+        // Signatures are independent on each other, so we can verify them in parallel
+        PDFIntegerRange<size_t> range(0, signatureFields.size());
+        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, range.begin(), range.end(), verifySignature);
     }
 
     return result;
@@ -519,10 +542,6 @@ STACK_OF(X509)* PDFPublicKeySignatureHandler::getCertificates(PKCS7* pkcs7)
 
 void PDFPublicKeySignatureHandler::verifyCertificate(PDFSignatureVerificationResult& result) const
 {
-    PDFOpenSSLGlobalLock lock;
-
-    OpenSSL_add_all_algorithms();
-
     const PDFSignature& signature = m_signatureField->getSignature();
     const QByteArray& content = signature.getContents();
 
@@ -653,7 +672,111 @@ void PDFPublicKeySignatureHandler::verifyCertificate(PDFSignatureVerificationRes
     }
 }
 
-BIO* PDFPublicKeySignatureHandler::getSignedDataBuffer(pdf::PDFSignatureVerificationResult& result, QByteArray& outputBuffer) const
+/// Signed data of the signature - byte ranges of the source data. Data are
+/// not copied, they are read by the BIO directly from the source data.
+struct PDFSignedDataRanges
+{
+    QByteArray sourceData;
+    std::vector<std::pair<PDFInteger, PDFInteger>> ranges;
+    size_t rangeIndex = 0;
+    PDFInteger rangeOffset = 0;
+
+    PDFInteger getRemainingBytes() const
+    {
+        PDFInteger remainingBytes = 0;
+        for (size_t i = rangeIndex; i < ranges.size(); ++i)
+        {
+            remainingBytes += ranges[i].second;
+        }
+        return remainingBytes - rangeOffset;
+    }
+};
+
+static int signedDataBioRead(BIO* bio, char* buffer, int length)
+{
+    BIO_clear_retry_flags(bio);
+    PDFSignedDataRanges* data = static_cast<PDFSignedDataRanges*>(BIO_get_data(bio));
+
+    if (!data || !buffer || length <= 0)
+    {
+        return 0;
+    }
+
+    int bytesRead = 0;
+    while (bytesRead < length && data->rangeIndex < data->ranges.size())
+    {
+        const std::pair<PDFInteger, PDFInteger>& range = data->ranges[data->rangeIndex];
+        const PDFInteger bytesToCopy = qMin<PDFInteger>(length - bytesRead, range.second - data->rangeOffset);
+
+        std::memcpy(buffer + bytesRead, data->sourceData.constData() + range.first + data->rangeOffset, bytesToCopy);
+        bytesRead += int(bytesToCopy);
+        data->rangeOffset += bytesToCopy;
+
+        if (data->rangeOffset == range.second)
+        {
+            ++data->rangeIndex;
+            data->rangeOffset = 0;
+        }
+    }
+
+    return bytesRead;
+}
+
+static long signedDataBioCtrl(BIO* bio, int command, long, void*)
+{
+    PDFSignedDataRanges* data = static_cast<PDFSignedDataRanges*>(BIO_get_data(bio));
+
+    if (!data)
+    {
+        return 0;
+    }
+
+    switch (command)
+    {
+        case BIO_CTRL_RESET:
+            data->rangeIndex = 0;
+            data->rangeOffset = 0;
+            return 1;
+
+        case BIO_CTRL_EOF:
+            return data->getRemainingBytes() == 0 ? 1 : 0;
+
+        case BIO_CTRL_PENDING:
+            return long(data->getRemainingBytes());
+
+        case BIO_CTRL_FLUSH:
+            return 1;
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+static int signedDataBioDestroy(BIO* bio)
+{
+    delete static_cast<PDFSignedDataRanges*>(BIO_get_data(bio));
+    BIO_set_data(bio, nullptr);
+    BIO_set_init(bio, 0);
+    return 1;
+}
+
+static const BIO_METHOD* getSignedDataBioMethod()
+{
+    static const BIO_METHOD* method = []()
+    {
+        BIO_METHOD* bioMethod = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "PDF signed data");
+        BIO_meth_set_read(bioMethod, &signedDataBioRead);
+        BIO_meth_set_ctrl(bioMethod, &signedDataBioCtrl);
+        BIO_meth_set_destroy(bioMethod, &signedDataBioDestroy);
+        return bioMethod;
+    }();
+
+    return method;
+}
+
+BIO* PDFPublicKeySignatureHandler::getSignedDataBuffer(pdf::PDFSignatureVerificationResult& result) const
 {
     const PDFSignature& signature = m_signatureField->getSignature();
     const QByteArray& contents = signature.getContents();
@@ -674,8 +797,10 @@ BIO* PDFPublicKeySignatureHandler::getSignedDataBuffer(pdf::PDFSignatureVerifica
     }
 
     PDFClosedIntervalSet bytesCoveredBySignature;
+    std::unique_ptr<PDFSignedDataRanges> signedData = std::make_unique<PDFSignedDataRanges>();
+    signedData->sourceData = sourceData;
+    signedData->ranges.reserve(byteRanges.size());
 
-    outputBuffer.reserve(size);
     for (const PDFSignature::ByteRange& byteRange : byteRanges)
     {
         PDFInteger startOffset = byteRange.offset; // Offset to the first data byte
@@ -693,16 +818,39 @@ BIO* PDFPublicKeySignatureHandler::getSignedDataBuffer(pdf::PDFSignatureVerifica
             return nullptr;
         }
 
-        const int length = endOffset - startOffset;
-        outputBuffer.append(sourceData.constData() + startOffset, length);
+        signedData->ranges.emplace_back(startOffset, endOffset - startOffset);
         bytesCoveredBySignature.addInterval(startOffset, endOffset - 1);
     }
 
     // Jakub Melka: We must find byte string, which corresponds to signature.
     // We find only first occurence, because second one should not exist - because
-    // it will mean that signature must be covered by itself.
+    // it will mean that signature must be covered by itself. Usually, signature
+    // is stored in the gap between first two byte ranges, so try it first,
+    // to avoid scanning of the whole document.
     QByteArray hexContents = contents.toHex();
-    int index = sourceData.indexOf(hexContents);
+    int index = -1;
+    if (signedData->ranges.size() >= 2)
+    {
+        const PDFInteger gapStart = signedData->ranges[0].first + signedData->ranges[0].second;
+        const PDFInteger gapEnd = signedData->ranges[1].first;
+        if (gapStart < gapEnd)
+        {
+            QByteArrayView gap(sourceData.constData() + gapStart, gapEnd - gapStart);
+            index = int(gap.indexOf(hexContents));
+            if (index == -1)
+            {
+                index = int(gap.indexOf(hexContents.toUpper()));
+            }
+            if (index != -1)
+            {
+                index += int(gapStart);
+            }
+        }
+    }
+    if (index == -1)
+    {
+        index = sourceData.indexOf(hexContents);
+    }
     if (index == -1)
     {
         index = sourceData.indexOf(hexContents.toUpper());
@@ -732,15 +880,47 @@ BIO* PDFPublicKeySignatureHandler::getSignedDataBuffer(pdf::PDFSignatureVerifica
 
     result.setBytesCoveredBySignature(qMove(bytesCoveredBySignature));
 
-    return BIO_new_mem_buf(outputBuffer.data(), outputBuffer.length());
+    BIO* bio = BIO_new(getSignedDataBioMethod());
+    if (bio)
+    {
+        BIO_set_data(bio, signedData.release());
+        BIO_set_init(bio, 1);
+    }
+    return bio;
 }
 
-void PDFPublicKeySignatureHandler::verifySignature(PDFSignatureVerificationResult& result) const
+QByteArray PDFPublicKeySignatureHandler::computeDigest(BIO* bio, const EVP_MD* md)
 {
-    PDFOpenSSLGlobalLock lock;
+    QByteArray digest;
+
+    if (!bio || !md)
+    {
+        return digest;
+    }
 
-    OpenSSL_add_all_algorithms();
+    EVP_MD_CTX* context = EVP_MD_CTX_new();
+    Q_ASSERT(context);
 
+    if (EVP_DigestInit(context, md))
+    {
+        std::array<char, 65536> buffer = { };
+        int bytesRead = 0;
+        while ((bytesRead = BIO_read(bio, buffer.data(), int(buffer.size()))) > 0)
+        {
+            EVP_DigestUpdate(context, buffer.data(), bytesRead);
+        }
+
+        unsigned int digestSize = EVP_MD_size(md);
+        digest.resize(digestSize);
+        EVP_DigestFinal(context, convertByteArrayToUcharPtr(digest), &digestSize);
+    }
+
+    EVP_MD_CTX_free(context);
+    return digest;
+}
+
+void PDFPublicKeySignatureHandler::verifySignature(PDFSignatureVerificationResult& result) const
+{
     const PDFSignature& signature = m_signatureField->getSignature();
     const QByteArray& content = signature.getContents();
 
@@ -749,8 +929,7 @@ void PDFPublicKeySignatureHandler::verifySignature(PDFSignatureVerificationResul
     const unsigned char* data = convertByteArrayToUcharPtr(content);
     if (PKCS7* pkcs7 = d2i_PKCS7(nullptr, &data, content.size()))
     {
-        QByteArray buffer;
-        if (BIO* inputBuffer = getSignedDataBuffer(result, buffer))
+        if (BIO* inputBuffer = getSignedDataBuffer(result))
         {
             if (BIO* dataBio = PKCS7_dataInit(pkcs7, inputBuffer))
             {
@@ -865,10 +1044,6 @@ PDFSignatureVerificationResult PDFSignatureHandler_ETSI_RFC3161::verify() const
 
 void PDFSignatureHandler_ETSI_RFC3161::verifySignatureTimestamp(PDFSignatureVerificationResult& result) const
 {
-    PDFOpenSSLGlobalLock lock;
-
-    OpenSSL_add_all_algorithms();
-
     const PDFSignature& signature = m_signatureField->getSignature();
     const QByteArray& content = signature.getContents();
 
@@ -877,8 +1052,7 @@ void PDFSignatureHandler_ETSI_RFC3161::verifySignatureTimestamp(PDFSignatureVeri
     const unsigned char* data = convertByteArrayToUcharPtr(content);
     if (PKCS7* pkcs7 = d2i_PKCS7(nullptr, &data, content.size()))
     {
-        QByteArray buffer;
-        if (BIO* inputBuffer = getSignedDataBuffer(result, buffer))
+        if (BIO* inputBuffer = getSignedDataBuffer(result))
         {
             X509_STORE* store = X509_STORE_new();
 
@@ -972,8 +1146,9 @@ void PDFSignatureHandler_ETSI_RFC3161::verifySignatureTimestamp(PDFSignatureVeri
     }
 }
 
-// This is protected by global mutex, but it is ugly
-static PDFSignatureVerificationResult* s_ETSI_currentResult = nullptr;
+// Signatures are verified in parallel, so each thread has its own current
+// result (verification callback doesn't have user data parameter).
+static thread_local PDFSignatureVerificationResult* s_ETSI_currentResult = nullptr;
 
 int PDFSignatureHandler_ETSI_base::verifyCallback(int ok, X509_STORE_CTX* context)
 {
@@ -1050,12 +1225,8 @@ int PDFSignatureHandler_ETSI_base::verifyCallback(int ok, X509_STORE_CTX* contex
 
 void PDFSignatureHandler_ETSI_base::verifyCertificateCAdES(PDFSignatureVerificationResult& result, int purpose) const
 {
-    PDFOpenSSLGlobalLock lock;
-
     s_ETSI_currentResult = &result;
 
-    OpenSSL_add_all_algorithms();
-
     const PDFSignature& signature = m_signatureField->getSignature();
     const QByteArray& content = signature.getContents();
 
@@ -1260,7 +1431,7 @@ X509* PDFSignatureHandler_adbe_pkcs7_rsa_sha1::createCertificate(size_t index) c
     return nullptr;
 }
 
-bool PDFSignatureHandler_adbe_pkcs7_rsa_sha1::getMessageDigest(const QByteArray& message,
+bool PDFSignatureHandler_adbe_pkcs7_rsa_sha1::getMessageDigest(BIO* message,
                                                                ASN1_OCTET_STRING* encryptedString,
                                                                RSA* rsa,
                                                                int& algorithmNID,
@@ -1273,18 +1444,8 @@ bool PDFSignatureHandler_adbe_pkcs7_rsa_sha1::getMessageDigest(const QByteArray&
 
     if (const EVP_MD* md = EVP_get_digestbynid(algorithmNID))
     {
-        unsigned int messageDigestSize = EVP_MD_size(md);
-        digest.resize(messageDigestSize);
-
-        EVP_MD_CTX* context = EVP_MD_CTX_new();
-        Q_ASSERT(context);
-
-        EVP_DigestInit(context, md);
-        EVP_DigestUpdate(context, message.constData(), message.size());
-        EVP_DigestFinal(context, convertByteArrayToUcharPtr(digest), &messageDigestSize);
-
-        EVP_MD_CTX_free(context);
-        return true;
+        digest = computeDigest(message, md);
+        return !digest.isEmpty();
     }
 
     return false;
@@ -1469,8 +1630,7 @@ void PDFSignatureHandler_adbe_pkcs7_rsa_sha1::verifyRSASignature(PDFSignatureVer
         return;
     }
 
-    QByteArray outputBuffer;
-    openssl_ptr<BIO> bio(this->getSignedDataBuffer(result, outputBuffer), BIO_free_all);
+    openssl_ptr<BIO> bio(this->getSignedDataBuffer(result), BIO_free_all);
     if (bio)
     {
         const PDFSignature& signature = m_signatureField->getSignature();
@@ -1484,7 +1644,7 @@ void PDFSignatureHandler_adbe_pkcs7_rsa_sha1::verifyRSASignature(PDFSignatureVer
         {
             int algorithmNID = NID_undef;
             QByteArray digestBuffer;
-            if (!getMessageDigest(outputBuffer, encryptedString.get(), rsa.get(), algorithmNID, digestBuffer))
+            if (!getMessageDigest(bio.get(), encryptedString.get(), rsa.get(), algorithmNID, digestBuffer))
             {
                 result.addSignatureDataOtherError();
                 return;
@@ -1538,17 +1698,21 @@ PDFSignatureVerificationResult PDFSignatureHandler_adbe_pkcs7_sha1::verify() con
     return result;
 }
 
-BIO* PDFSignatureHandler_adbe_pkcs7_sha1::getSignedDataBuffer(PDFSignatureVerificationResult& result, QByteArray& outputBuffer) const
+BIO* PDFSignatureHandler_adbe_pkcs7_sha1::getSignedDataBuffer(PDFSignatureVerificationResult& result) const
 {
-    QByteArray temporaryBuffer;
-    if (BIO* bio = PDFPublicKeySignatureHandler::getSignedDataBuffer(result, temporaryBuffer))
+    if (BIO* bio = PDFPublicKeySignatureHandler::getSignedDataBuffer(result))
     {
-        // Calculate SHA1
-        outputBuffer.resize(SHA_DIGEST_LENGTH);
-        SHA1(convertByteArrayToUcharPtr(temporaryBuffer), temporaryBuffer.length(), convertByteArrayToUcharPtr(outputBuffer));
+        // Calculate SHA1, memory BIO holds its own copy of the digest
+        const QByteArray digest = computeDigest(bio, EVP_sha1());
         BIO_free(bio);
 
-        return BIO_new_mem_buf(outputBuffer.data(), outputBuffer.length());
+        BIO* digestBio = BIO_new(BIO_s_mem());
+        if (digestBio && BIO_write(digestBio, digest.constData(), digest.length()) != digest.length())
+        {
+            BIO_free(digestBio);
+            digestBio = nullptr;
+        }
+        return digestBio;
     }
 
     return nullptr;
@@ -1682,24 +1846,26 @@ void PDFPublicKeySignatureHandler::addSignatureDateFromSignerInfoStack(STACK_OF(
 
 void pdf::PDFPublicKeySignatureHandler::addTrustedCertificates(X509_STORE* store) const
 {
-    if (m_parameters.store)
+    if (m_trustedCertificates)
     {
-        const PDFCertificateEntries& certificates = m_parameters.store->getCertificates();
+        m_trustedCertificates->addToStore(store);
+    }
+}
+
+pdf::PDFSignatureTrustedCertificates::PDFSignatureTrustedCertificates(const PDFSignatureHandler::Parameters& parameters)
+{
+    if (parameters.store)
+    {
+        const PDFCertificateEntries& certificates = parameters.store->getCertificates();
         for (const auto& entry : certificates)
         {
             QByteArray certificateData = entry.info.getCertificateData();
-            const unsigned char* pointer = convertByteArrayToUcharPtr(certificateData);
-            X509* certificate = d2i_X509(nullptr, &pointer, certificateData.length());
-            if (certificate)
-            {
-                X509_STORE_add_cert(store, certificate);
-                X509_free(certificate);
-            }
+            addCertificate(convertByteArrayToUcharPtr(certificateData), certificateData.length());
         }
     }
 
 #ifdef Q_OS_WIN
-    if (m_parameters.useSystemCertificateStore)
+    if (parameters.useSystemCertificateStore)
     {
         HCERTSTORE certStore = CertOpenSystemStore(0, L"ROOT");
         PCCERT_CONTEXT context = nullptr;
@@ -1707,13 +1873,7 @@ void pdf::PDFPublicKeySignatureHandler::addTrustedCertificates(X509_STORE* store
         {
             while (context = CertEnumCertificatesInStore(certStore, context))
             {
-                const unsigned char* pointer = context->pbCertEncoded;
-                X509* certificate = d2i_X509(nullptr, &pointer, context->cbCertEncoded);
-                if (certificate)
-                {
-                    X509_STORE_add_cert(store, certificate);
-                    X509_free(certificate);
-                }
+                addCertificate(context->pbCertEncoded, context->cbCertEncoded);
             }
 
             CertCloseStore(certStore, CERT_CLOSE_STORE_FORCE_FLAG);
@@ -1722,6 +1882,30 @@ void pdf::PDFPublicKeySignatureHandler::addTrustedCertificates(X509_STORE* store
 #endif
 }
 
+pdf::PDFSignatureTrustedCertificates::~PDFSignatureTrustedCertificates()
+{
+    for (X509* certificate : m_certificates)
+    {
+        X509_free(certificate);
+    }
+}
+
+void pdf::PDFSignatureTrustedCertificates::addToStore(X509_STORE* store) const
+{
+    for (X509* certificate : m_certificates)
+    {
+        X509_STORE_add_cert(store, certificate);
+    }
+}
+
+void pdf::PDFSignatureTrustedCertificates::addCertificate(const unsigned char* data, long length)
+{
+    if (X509* certificate = d2i_X509(nullptr, &data, length))
+    {
+        m_certificates.push_back(certificate);
+    }
+}
+
 #if defined(PDF4QT_COMPILER_MINGW) || defined(PDF4QT_COMPILER_GCC)
 #pragma GCC diagnostic pop
 #endif
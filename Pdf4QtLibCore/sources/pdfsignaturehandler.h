@@ -37,6 +37,7 @@ class PDFObjectStorage;
 class PDFCertificateStore;
 class PDFFormFieldSignature;
 class PDFDocumentSecurityStore;
+class PDFSignatureTrustedCertificates;
 
 /// Signature reference dictionary.
 class PDFSignatureReference
@@ -329,7 +330,8 @@ public:
     };
 
     /// Tries to verify all signatures in the form. If form is invalid, then
-    /// empty vector is returned.
+    /// empty vector is returned. Trusted certificates are decoded only once,
+    /// and independent signatures are verified in parallel.
     /// \param form Form
     /// \param sourceData Source data
     /// \param parameters Verification settings
@@ -342,7 +344,11 @@ private:
     /// \param signatureField Signature field
     /// \param sourceData
     /// \param parameters Verification settings
-    static PDFSignatureHandler* createHandler(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters);
+    /// \param trustedCertificates Trusted certificates shared by all handlers
+    static PDFSignatureHandler* createHandler(const PDFFormFieldSignature* signatureField,
+                                              const QByteArray& sourceData,
+                                              const Parameters& parameters,
+                                              std::shared_ptr<const PDFSignatureTrustedCertificates> trustedCertificates);
 };
 
 } // namespace pdf
@@ -23,18 +23,50 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 #include <openssl/pkcs7.h>
+#include <openssl/evp.h>
+
+#include <memory>
 
 namespace pdf
 {
 
+/// Trusted certificates (from certificate store and from system certificate
+/// store), decoded only once and shared by all signature handlers verifying
+/// signatures of the same document. Certificates are only read, so they
+/// can be used from multiple threads.
+class PDFSignatureTrustedCertificates
+{
+public:
+    explicit PDFSignatureTrustedCertificates(const PDFSignatureHandler::Parameters& parameters);
+    ~PDFSignatureTrustedCertificates();
+
+    PDFSignatureTrustedCertificates(const PDFSignatureTrustedCertificates&) = delete;
+    PDFSignatureTrustedCertificates& operator=(const PDFSignatureTrustedCertificates&) = delete;
+
+    /// Adds all trusted certificates to the certificate store
+    /// \param store Store
+    void addToStore(X509_STORE* store) const;
+
+private:
+    void addCertificate(const unsigned char* data, long length);
+
+    std::vector<X509*> m_certificates;
+};
+
+using PDFSignatureTrustedCertificatesPointer = std::shared_ptr<const PDFSignatureTrustedCertificates>;
+
 /// PKCS7 public key signature handler
 class PDFPublicKeySignatureHandler : public PDFSignatureHandler
 {
 protected:
-    explicit PDFPublicKeySignatureHandler(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
+    explicit PDFPublicKeySignatureHandler(const PDFFormFieldSignature* signatureField,
+                                          const QByteArray& sourceData,
+                                          const Parameters& parameters,
+                                          PDFSignatureTrustedCertificatesPointer trustedCertificates) :
         m_signatureField(signatureField),
         m_sourceData(sourceData),
-        m_parameters(parameters)
+        m_parameters(parameters),
+        m_trustedCertificates(qMove(trustedCertificates))
     {
 
     }
@@ -44,7 +76,16 @@ protected:
     void verifySignature(PDFSignatureVerificationResult& result) const;
     void addTrustedCertificates(X509_STORE* store) const;
 
-    virtual BIO* getSignedDataBuffer(PDFSignatureVerificationResult& result, QByteArray& outputBuffer) const;
+    /// Returns BIO with data signed by the signature. Data are read directly
+    /// from the byte ranges of the source data, they are not copied.
+    /// \param result Verification result (errors and covered bytes are set)
+    virtual BIO* getSignedDataBuffer(PDFSignatureVerificationResult& result) const;
+
+    /// Computes message digest of all data, which can be read from the BIO.
+    /// If digest cannot be computed, empty byte array is returned.
+    /// \param bio Data
+    /// \param md Message digest algorithm
+    static QByteArray computeDigest(BIO* bio, const EVP_MD* md);
 
 public:
     /// Return a list of certificates from PKCS7 object
@@ -81,13 +122,14 @@ protected:
     const PDFFormFieldSignature* m_signatureField;
     QByteArray m_sourceData;
     Parameters m_parameters;
+    PDFSignatureTrustedCertificatesPointer m_trustedCertificates;
 };
 
 class PDFSignatureHandler_adbe_pkcs7_detached : public PDFPublicKeySignatureHandler
 {
 public:
-    explicit PDFSignatureHandler_adbe_pkcs7_detached(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_adbe_pkcs7_detached(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
@@ -98,8 +140,8 @@ public:
 class PDFSignatureHandler_adbe_pkcs7_rsa_sha1 : public PDFPublicKeySignatureHandler
 {
 public:
-    explicit PDFSignatureHandler_adbe_pkcs7_rsa_sha1(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_adbe_pkcs7_rsa_sha1(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
@@ -108,7 +150,7 @@ public:
 
 private:
     X509* createCertificate(size_t index) const;
-    bool getMessageDigest(const QByteArray& message, ASN1_OCTET_STRING* encryptedString, RSA* rsa, int& algorithmNID, QByteArray& digest) const;
+    bool getMessageDigest(BIO* message, ASN1_OCTET_STRING* encryptedString, RSA* rsa, int& algorithmNID, QByteArray& digest) const;
     bool getMessageDigestAlgorithm(ASN1_OCTET_STRING* encryptedString, RSA* rsa, int& algorithmNID) const;
 
     void verifyRSACertificate(PDFSignatureVerificationResult& result) const;
@@ -118,8 +160,8 @@ private:
 class PDFSignatureHandler_adbe_pkcs7_sha1 : public PDFPublicKeySignatureHandler
 {
 public:
-    explicit PDFSignatureHandler_adbe_pkcs7_sha1(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_adbe_pkcs7_sha1(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
@@ -127,14 +169,14 @@ public:
     virtual PDFSignatureVerificationResult verify() const override;
 
 protected:
-    virtual BIO* getSignedDataBuffer(PDFSignatureVerificationResult& result, QByteArray& outputBuffer) const override;
+    virtual BIO* getSignedDataBuffer(PDFSignatureVerificationResult& result) const override;
 };
 
 class PDFSignatureHandler_ETSI_base : public PDFPublicKeySignatureHandler
 {
 public:
-    explicit PDFSignatureHandler_ETSI_base(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_ETSI_base(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFPublicKeySignatureHandler(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
@@ -147,8 +189,8 @@ protected:
 class PDFSignatureHandler_ETSI_CAdES_detached : public PDFSignatureHandler_ETSI_base
 {
 public:
-    explicit PDFSignatureHandler_ETSI_CAdES_detached(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFSignatureHandler_ETSI_base(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_ETSI_CAdES_detached(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFSignatureHandler_ETSI_base(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
@@ -159,8 +201,8 @@ public:
 class PDFSignatureHandler_ETSI_RFC3161: public PDFSignatureHandler_ETSI_base
 {
 public:
-    explicit PDFSignatureHandler_ETSI_RFC3161(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters) :
-        PDFSignatureHandler_ETSI_base(signatureField, sourceData, parameters)
+    explicit PDFSignatureHandler_ETSI_RFC3161(const PDFFormFieldSignature* signatureField, const QByteArray& sourceData, const Parameters& parameters, PDFSignatureTrustedCertificatesPointer trustedCertificates) :
+        PDFSignatureHandler_ETSI_base(signatureField, sourceData, parameters, qMove(trustedCertificates))
     {
 
     }
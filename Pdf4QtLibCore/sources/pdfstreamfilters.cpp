@@ -23,6 +23,11 @@
 #include "pdfutils.h"
 
 #include <zlib.h>
+#include <cstring>
+
+#ifdef PDF4QT_USE_LIBDEFLATE
+#include <libdeflate.h>
+#endif
 
 #include <QtEndian>
 
@@ -31,6 +36,164 @@
 namespace pdf
 {
 
+QByteArray PDFStreamFilterDecoder::readAll()
+{
+    QByteArray result;
+
+    constexpr qint64 CHUNK_SIZE = 64 * 1024;
+    qint64 bytesRead = 0;
+    do
+    {
+        const qsizetype oldSize = result.size();
+        result.resize(oldSize + CHUNK_SIZE);
+        bytesRead = read(result.data() + oldSize, CHUNK_SIZE);
+        result.resize(oldSize + bytesRead);
+    } while (bytesRead > 0);
+
+    return result;
+}
+
+PDFBufferFilterDecoder::PDFBufferFilterDecoder(QByteArray data) :
+    m_data(qMove(data)),
+    m_position(0)
+{
+
+}
+
+qint64 PDFBufferFilterDecoder::read(char* data, qint64 maxSize)
+{
+    const qint64 count = qMin<qint64>(maxSize, m_data.size() - m_position);
+    std::copy(m_data.cbegin() + m_position, m_data.cbegin() + m_position + count, data);
+    m_position += count;
+    return count;
+}
+
+/// Base class for decoders, which decode data read from the input decoder
+/// into the output buffer, chunk by chunk. Input of the decoder is buffered too.
+class PDFBufferedFilterDecoder : public PDFStreamFilterDecoder
+{
+public:
+    explicit PDFBufferedFilterDecoder(PDFStreamFilterDecoderPointer input) :
+        m_input(qMove(input)),
+        m_inputPosition(0),
+        m_outputPosition(0),
+        m_finished(false)
+    {
+
+    }
+
+    virtual qint64 read(char* data, qint64 maxSize) override;
+
+protected:
+    /// Preferred size of the decoded chunk and of the input buffer
+    static constexpr qsizetype CHUNK_SIZE = 64 * 1024;
+
+    /// Decodes next chunk of the data and appends it to the \p output.
+    /// Returns false, if end of stream was reached (decoded data
+    /// written in this call are still used).
+    /// \param output Output buffer
+    virtual bool decode(QByteArray& output) = 0;
+
+    /// Reads next byte of the input data, returns -1, if
+    /// end of input data is reached.
+    inline int readInputByte()
+    {
+        if (m_inputPosition == m_inputBuffer.size() && !fillInputBuffer())
+        {
+            return -1;
+        }
+
+        return static_cast<unsigned char>(m_inputBuffer[m_inputPosition++]);
+    }
+
+    /// Reads at most \p maxSize bytes of input data, returns
+    /// number of bytes read.
+    qsizetype readInput(char* data, qsizetype maxSize);
+
+    /// Returns remaining buffered input data (and marks them as read). If
+    /// no input data remain, false is returned. Returned data are valid
+    /// until next read of the input.
+    bool readInputChunk(const char*& data, qsizetype& size);
+
+private:
+    bool fillInputBuffer();
+
+    PDFStreamFilterDecoderPointer m_input;
+    QByteArray m_inputBuffer;
+    qsizetype m_inputPosition;
+    QByteArray m_outputBuffer;
+    qsizetype m_outputPosition;
+    bool m_finished;
+};
+
+qint64 PDFBufferedFilterDecoder::read(char* data, qint64 maxSize)
+{
+    qint64 bytesRead = 0;
+    while (bytesRead < maxSize)
+    {
+        if (m_outputPosition == m_outputBuffer.size())
+        {
+            if (m_finished)
+            {
+                break;
+            }
+
+            // Buffer is reused, so its capacity is kept
+            m_outputBuffer.resize(0);
+            m_outputPosition = 0;
+            m_finished = !decode(m_outputBuffer);
+            continue;
+        }
+
+        const qint64 count = qMin<qint64>(maxSize - bytesRead, m_outputBuffer.size() - m_outputPosition);
+        std::copy(m_outputBuffer.cbegin() + m_outputPosition, m_outputBuffer.cbegin() + m_outputPosition + count, data + bytesRead);
+        m_outputPosition += count;
+        bytesRead += count;
+    }
+
+    return bytesRead;
+}
+
+qsizetype PDFBufferedFilterDecoder::readInput(char* data, qsizetype maxSize)
+{
+    qsizetype bytesRead = 0;
+    while (bytesRead < maxSize)
+    {
+        if (m_inputPosition == m_inputBuffer.size() && !fillInputBuffer())
+        {
+            break;
+        }
+
+        const qsizetype count = qMin(maxSize - bytesRead, m_inputBuffer.size() - m_inputPosition);
+        std::copy(m_inputBuffer.cbegin() + m_inputPosition, m_inputBuffer.cbegin() + m_inputPosition + count, data + bytesRead);
+        m_inputPosition += count;
+        bytesRead += count;
+    }
+
+    return bytesRead;
+}
+
+bool PDFBufferedFilterDecoder::readInputChunk(const char*& data, qsizetype& size)
+{
+    if (m_inputPosition == m_inputBuffer.size() && !fillInputBuffer())
+    {
+        return false;
+    }
+
+    data = m_inputBuffer.constData() + m_inputPosition;
+    size = m_inputBuffer.size() - m_inputPosition;
+    m_inputPosition = m_inputBuffer.size();
+    return true;
+}
+
+bool PDFBufferedFilterDecoder::fillInputBuffer()
+{
+    m_inputBuffer.resize(CHUNK_SIZE);
+    m_inputBuffer.resize(m_input->read(m_inputBuffer.data(), CHUNK_SIZE));
+    m_inputPosition = 0;
+    return !m_inputBuffer.isEmpty();
+}
+
 QByteArray PDFAsciiHexDecodeFilter::apply(const QByteArray& data,
                                           const PDFObjectFetcher& objectFetcher,
                                           const PDFObject& parameters,
@@ -60,6 +223,80 @@ QByteArray PDFAsciiHexDecodeFilter::apply(const QByteArray& data,
     return QByteArray::fromHex(QByteArray::fromRawData(data.constData(), size));
 }
 
+class PDFAsciiHexFilterDecoder : public PDFBufferedFilterDecoder
+{
+public:
+    using PDFBufferedFilterDecoder::PDFBufferedFilterDecoder;
+
+protected:
+    virtual bool decode(QByteArray& output) override;
+
+private:
+    /// Value of the first digit of the pair, or -1, if no digit was read
+    int m_highDigit = -1;
+};
+
+bool PDFAsciiHexFilterDecoder::decode(QByteArray& output)
+{
+    while (output.size() < CHUNK_SIZE)
+    {
+        const int character = readInputByte();
+        if (character == -1 || character == '>')
+        {
+            // Odd number of digits, last digit is completed by zero
+            if (m_highDigit != -1)
+            {
+                output.push_back(static_cast<char>(m_highDigit << 4));
+            }
+
+            return false;
+        }
+
+        int digit = -1;
+        if (character >= '0' && character <= '9')
+        {
+            digit = character - '0';
+        }
+        else if (character >= 'A' && character <= 'F')
+        {
+            digit = character - 'A' + 10;
+        }
+        else if (character >= 'a' && character <= 'f')
+        {
+            digit = character - 'a' + 10;
+        }
+        else
+        {
+            // Skip whitespaces and invalid characters
+            continue;
+        }
+
+        if (m_highDigit == -1)
+        {
+            m_highDigit = digit;
+        }
+        else
+        {
+            output.push_back(static_cast<char>((m_highDigit << 4) | digit));
+            m_highDigit = -1;
+        }
+    }
+
+    return true;
+}
+
+PDFStreamFilterDecoderPointer PDFAsciiHexDecodeFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                                     const PDFObjectFetcher& objectFetcher,
+                                                                     const PDFObject& parameters,
+                                                                     const PDFSecurityHandler* securityHandler) const
+{
+    Q_UNUSED(objectFetcher);
+    Q_UNUSED(parameters);
+    Q_UNUSED(securityHandler);
+
+    return std::make_unique<PDFAsciiHexFilterDecoder>(qMove(input));
+}
+
 QByteArray PDFAscii85DecodeFilter::apply(const QByteArray& data,
                                          const PDFObjectFetcher& objectFetcher,
                                          const PDFObject& parameters,
@@ -151,12 +388,98 @@ QByteArray PDFAscii85DecodeFilter::apply(const QByteArray& data,
     return result;
 }
 
-class PDFLzwStreamDecoder
+class PDFAscii85FilterDecoder : public PDFBufferedFilterDecoder
+{
+public:
+    using PDFBufferedFilterDecoder::PDFBufferedFilterDecoder;
+
+protected:
+    virtual bool decode(QByteArray& output) override;
+
+private:
+    /// Decodes current group of characters. Missing characters
+    /// of the incomplete group are treated as 'u' characters.
+    void flushGroup(QByteArray& output);
+
+    std::array<uint32_t, 5> m_group = { };
+    size_t m_groupSize = 0;
+};
+
+bool PDFAscii85FilterDecoder::decode(QByteArray& output)
+{
+    while (output.size() < CHUNK_SIZE)
+    {
+        const int character = readInputByte();
+        if (character == -1 || character == '~')
+        {
+            flushGroup(output);
+            return false;
+        }
+
+        if (PDFLexicalAnalyzer::isWhitespace(static_cast<char>(character)))
+        {
+            continue;
+        }
+
+        if (character == 'z' && m_groupSize == 0)
+        {
+            output.append(4, static_cast<char>(0));
+            continue;
+        }
+
+        m_group[m_groupSize++] = character - 33;
+        if (m_groupSize == m_group.size())
+        {
+            flushGroup(output);
+        }
+    }
+
+    return true;
+}
+
+void PDFAscii85FilterDecoder::flushGroup(QByteArray& output)
+{
+    if (m_groupSize == 0)
+    {
+        return;
+    }
+
+    std::fill(std::next(m_group.begin(), m_groupSize), m_group.end(), 84);
+
+    // Decode bytes using 85 base
+    uint32_t decodedBytesPacked = 0;
+    for (const uint32_t value : m_group)
+    {
+        decodedBytesPacked = decodedBytesPacked * 85 + value;
+    }
+
+    for (size_t i = 0; i < m_groupSize - 1; ++i)
+    {
+        output.push_back(static_cast<char>((decodedBytesPacked >> (24 - 8 * i)) & 0xFF));
+    }
+
+    m_groupSize = 0;
+}
+
+PDFStreamFilterDecoderPointer PDFAscii85DecodeFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                                    const PDFObjectFetcher& objectFetcher,
+                                                                    const PDFObject& parameters,
+                                                                    const PDFSecurityHandler* securityHandler) const
+{
+    Q_UNUSED(objectFetcher);
+    Q_UNUSED(parameters);
+    Q_UNUSED(securityHandler);
+
+    return std::make_unique<PDFAscii85FilterDecoder>(qMove(input));
+}
+
+class PDFLzwStreamDecoder : public PDFBufferedFilterDecoder
 {
 public:
-    explicit PDFLzwStreamDecoder(const QByteArray& inputByteArray, uint32_t early);
+    explicit PDFLzwStreamDecoder(PDFStreamFilterDecoderPointer input, uint32_t early);
 
-    QByteArray decompress();
+protected:
+    virtual bool decode(QByteArray& output) override;
 
 private:
     static constexpr const uint32_t CODE_TABLE_RESET = 256;
@@ -191,11 +514,11 @@ private:
     std::array<char, TABLE_SIZE>::iterator m_currentSequenceEnd;
     bool m_first;               ///< Are we reading from stream for first time after the reset
     char m_newCharacter;        ///< New character to be written
-    int m_position;             ///< Position in the input array
-    const QByteArray& m_inputByteArray;
+    uint32_t m_previousCode;    ///< Previously decoded code
 };
 
-PDFLzwStreamDecoder::PDFLzwStreamDecoder(const QByteArray& inputByteArray, uint32_t early) :
+PDFLzwStreamDecoder::PDFLzwStreamDecoder(PDFStreamFilterDecoderPointer input, uint32_t early) :
+    PDFBufferedFilterDecoder(qMove(input)),
     m_table(),
     m_sequence(),
     m_nextCode(0),
@@ -206,8 +529,7 @@ PDFLzwStreamDecoder::PDFLzwStreamDecoder(const QByteArray& inputByteArray, uint3
     m_currentSequenceEnd(m_sequence.begin()),
     m_first(false),
     m_newCharacter(0),
-    m_position(0),
-    m_inputByteArray(inputByteArray)
+    m_previousCode(TABLE_SIZE)
 {
     for (size_t i = 0; i < 256; ++i)
     {
@@ -218,22 +540,16 @@ PDFLzwStreamDecoder::PDFLzwStreamDecoder(const QByteArray& inputByteArray, uint3
     clearTable();
 }
 
-QByteArray PDFLzwStreamDecoder::decompress()
+bool PDFLzwStreamDecoder::decode(QByteArray& output)
 {
-    QByteArray result;
-
-    // Guess output byte array size - assume compress ratio is 2:1
-    result.reserve(m_inputByteArray.size() * 2);
-
-    uint32_t previousCode = TABLE_SIZE;
-    while (true)
+    while (output.size() < CHUNK_SIZE)
     {
         const uint32_t code = getCode();
 
         if (code == CODE_END_OF_STREAM)
         {
             // We are at end of stream
-            break;
+            return false;
         }
         else if (code == CODE_TABLE_RESET)
         {
@@ -279,7 +595,7 @@ QByteArray PDFLzwStreamDecoder::decompress()
             if (m_nextCode < TABLE_SIZE)
             {
                 m_table[m_nextCode].character = m_newCharacter;
-                m_table[m_nextCode].previous = previousCode;
+                m_table[m_nextCode].previous = m_previousCode;
                 ++m_nextCode;
             }
 
@@ -303,14 +619,13 @@ QByteArray PDFLzwStreamDecoder::decompress()
             }
         }
 
-        previousCode = code;
+        m_previousCode = code;
 
         // Copy the input array to the buffer
-        std::copy(m_sequence.begin(), m_currentSequenceEnd, std::back_inserter(result));
+        output.append(m_sequence.data(), std::distance(m_sequence.begin(), m_currentSequenceEnd));
     }
 
-    result.shrink_to_fit();
-    return result;
+    return true;
 }
 
 void PDFLzwStreamDecoder::clearTable()
@@ -328,13 +643,14 @@ uint32_t PDFLzwStreamDecoder::getCode()
 {
     while (m_inputBits < m_nextBits)
     {
-        // Did we reach end of array?
-        if (m_position == m_inputByteArray.size())
+        // Did we reach end of input data?
+        const int inputByte = readInputByte();
+        if (inputByte == -1)
         {
             return CODE_END_OF_STREAM;
         }
 
-        m_inputBuffer = (m_inputBuffer << 8) | static_cast<unsigned char>(m_inputByteArray[m_position++]);
+        m_inputBuffer = (m_inputBuffer << 8) | static_cast<uint32_t>(inputByte);
         m_inputBits += 8;
     }
 
@@ -351,6 +667,14 @@ QByteArray PDFLzwDecodeFilter::apply(const QByteArray& data,
                                      const PDFObjectFetcher& objectFetcher,
                                      const PDFObject& parameters,
                                      const PDFSecurityHandler* securityHandler) const
+{
+    return createDecoder(std::make_unique<PDFBufferFilterDecoder>(data), objectFetcher, parameters, securityHandler)->readAll();
+}
+
+PDFStreamFilterDecoderPointer PDFLzwDecodeFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                                const PDFObjectFetcher& objectFetcher,
+                                                                const PDFObject& parameters,
+                                                                const PDFSecurityHandler* securityHandler) const
 {
     Q_UNUSED(securityHandler);
 
@@ -369,47 +693,173 @@ QByteArray PDFLzwDecodeFilter::apply(const QByteArray& data,
     }
 
     PDFStreamPredictor predictor = PDFStreamPredictor::createPredictor(objectFetcher, parameters);
-    PDFLzwStreamDecoder decoder(data, early);
-    return predictor.apply(decoder.decompress());
+    return predictor.createDecoder(std::make_unique<PDFLzwStreamDecoder>(qMove(input), early));
 }
 
 QByteArray PDFFlateDecodeFilter::apply(const QByteArray& data,
                                        const PDFObjectFetcher& objectFetcher,
                                        const PDFObject& parameters,
                                        const PDFSecurityHandler* securityHandler) const
+{
+    return applyWithLengthHint(data, objectFetcher, parameters, securityHandler, -1);
+}
+
+QByteArray PDFFlateDecodeFilter::applyWithLengthHint(const QByteArray& data,
+                                                     const PDFObjectFetcher& objectFetcher,
+                                                     const PDFObject& parameters,
+                                                     const PDFSecurityHandler* securityHandler,
+                                                     PDFInteger decodedLength) const
+{
+    Q_UNUSED(securityHandler);
+
+    PDFStreamPredictor predictor = PDFStreamPredictor::createPredictor(objectFetcher, parameters);
+    return predictor.apply(uncompress(data, predictor.getEncodedDataLength(decodedLength)));
+}
+
+class PDFFlateFilterDecoder : public PDFBufferedFilterDecoder
+{
+public:
+    explicit PDFFlateFilterDecoder(PDFStreamFilterDecoderPointer input);
+    virtual ~PDFFlateFilterDecoder() override;
+
+protected:
+    virtual bool decode(QByteArray& output) override;
+
+private:
+    z_stream m_stream;
+};
+
+PDFFlateFilterDecoder::PDFFlateFilterDecoder(PDFStreamFilterDecoderPointer input) :
+    PDFBufferedFilterDecoder(qMove(input)),
+    m_stream()
+{
+    if (inflateInit(&m_stream) != Z_OK)
+    {
+        throw PDFException(PDFTranslationContext::tr("Failed to initialize flate decompression stream."));
+    }
+}
+
+PDFFlateFilterDecoder::~PDFFlateFilterDecoder()
+{
+    inflateEnd(&m_stream);
+}
+
+bool PDFFlateFilterDecoder::decode(QByteArray& output)
+{
+    const qsizetype oldSize = output.size();
+    output.resize(oldSize + CHUNK_SIZE);
+
+    m_stream.next_out = reinterpret_cast<Bytef*>(output.data() + oldSize);
+    m_stream.avail_out = static_cast<uInt>(CHUNK_SIZE);
+
+    int error = Z_OK;
+    while (m_stream.avail_out > 0)
+    {
+        if (m_stream.avail_in == 0)
+        {
+            const char* inputData = nullptr;
+            qsizetype inputSize = 0;
+            if (!readInputChunk(inputData, inputSize))
+            {
+                // Input data ended before the end of the compressed stream
+                error = Z_BUF_ERROR;
+                break;
+            }
+
+            m_stream.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(inputData));
+            m_stream.avail_in = static_cast<uInt>(inputSize);
+        }
+
+        error = inflate(&m_stream, Z_NO_FLUSH);
+        if (error != Z_OK)
+        {
+            break;
+        }
+    }
+
+    output.resize(oldSize + CHUNK_SIZE - m_stream.avail_out);
+
+    switch (error)
+    {
+        case Z_OK:
+            return true;
+
+        case Z_STREAM_END:
+            return false; // No error, normal behaviour
+
+        default:
+        {
+            QString errorMessage;
+            if (m_stream.msg)
+            {
+                errorMessage = QString::fromLatin1(m_stream.msg);
+            }
+
+            const bool ignoreError = error == Z_DATA_ERROR && errorMessage == "incorrect data check";
+            if (ignoreError)
+            {
+                return false;
+            }
+
+            if (errorMessage.isEmpty())
+            {
+                errorMessage = PDFTranslationContext::tr("zlib code: %1").arg(error);
+            }
+
+            throw PDFException(PDFTranslationContext::tr("Error decompressing by flate method: %1").arg(errorMessage));
+        }
+    }
+}
+
+PDFStreamFilterDecoderPointer PDFFlateDecodeFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                                  const PDFObjectFetcher& objectFetcher,
+                                                                  const PDFObject& parameters,
+                                                                  const PDFSecurityHandler* securityHandler) const
 {
     Q_UNUSED(securityHandler);
 
     PDFStreamPredictor predictor = PDFStreamPredictor::createPredictor(objectFetcher, parameters);
-    return predictor.apply(uncompress(data));
+    return predictor.createDecoder(std::make_unique<PDFFlateFilterDecoder>(qMove(input)));
 }
 
 QByteArray PDFFlateDecodeFilter::compress(const QByteArray& decompressedData)
 {
-    QByteArray result;
+#ifdef PDF4QT_USE_LIBDEFLATE
+    // Level 12 of libdeflate gives better compression ratio, than maximal level of zlib
+    if (libdeflate_compressor* compressor = libdeflate_alloc_compressor(12))
+    {
+        QByteArray result(libdeflate_zlib_compress_bound(compressor, decompressedData.size()), Qt::Uninitialized);
+        const size_t compressedSize = libdeflate_zlib_compress(compressor, decompressedData.constData(), decompressedData.size(), result.data(), result.size());
+        libdeflate_free_compressor(compressor);
+
+        if (compressedSize > 0)
+        {
+            result.resize(compressedSize);
+            result.squeeze();
+            return result;
+        }
+    }
+#endif
 
     z_stream stream = { };
     stream.next_in = const_cast<Bytef*>(convertByteArrayToUcharPtr(decompressedData));
     stream.avail_in = decompressedData.size();
 
-    std::array<Bytef, 1024> outputBuffer = { };
-
     int error = deflateInit(&stream, Z_BEST_COMPRESSION);
     if (error != Z_OK)
     {
         throw PDFException(PDFTranslationContext::tr("Failed to initialize flate compression stream."));
     }
 
-    do
-    {
-        stream.next_out = outputBuffer.data();
-        stream.avail_out = static_cast<uInt>(outputBuffer.size());
-
-        error = deflate(&stream, Z_FINISH);
+    // Output buffer has maximal size of the compressed data, so data
+    // are compressed in one step, without enlarging the buffer.
+    QByteArray result(deflateBound(&stream, decompressedData.size()), Qt::Uninitialized);
+    stream.next_out = convertByteArrayToUcharPtr(result);
+    stream.avail_out = static_cast<uInt>(result.size());
 
-        int bytesWritten = int(outputBuffer.size()) - stream.avail_out;
-        result.append(reinterpret_cast<const char*>(outputBuffer.data()), bytesWritten);
-    } while (error == Z_OK);
+    error = deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+    result.squeeze();
 
     QString errorMessage;
     if (stream.msg)
@@ -482,15 +932,79 @@ PDFInteger PDFFlateDecodeFilter::getStreamDataLength(const QByteArray& data, PDF
     return -1;
 }
 
-QByteArray PDFFlateDecodeFilter::uncompress(const QByteArray& data)
+QString PDFFlateDecodeFilter::getBackendName()
 {
-    QByteArray result;
+#ifdef PDF4QT_USE_LIBDEFLATE
+    return QString("libdeflate %1, zlib %2").arg(QString::fromLatin1(LIBDEFLATE_VERSION_STRING), QString::fromLatin1(zlibVersion()));
+#else
+    return QString("zlib %1").arg(QString::fromLatin1(zlibVersion()));
+#endif
+}
 
-    z_stream stream = { };
-    stream.next_in = const_cast<Bytef*>(convertByteArrayToUcharPtr(data));
-    stream.avail_in = data.size();
+QByteArray PDFFlateDecodeFilter::uncompress(const QByteArray& data, PDFInteger decodedLength)
+{
+    // Expected length can be wrong, or even malicious, so we accept it only,
+    // if it is not above the maximal length of the decompressed data.
+    if (decodedLength > PDFInteger(data.size()) * MAX_COMPRESSION_RATIO + 1024)
+    {
+        decodedLength = -1;
+    }
 
-    std::array<Bytef, 1024> outputBuffer = { };
+#ifdef PDF4QT_USE_LIBDEFLATE
+    // Whole buffer decompression needs the output buffer to be large enough. If decoded
+    // length is unknown, we guess it and enlarge the buffer, when it is too small. If it
+    // fails (data are damaged), then zlib is used, it can decode data with invalid checksum.
+    // Large buffers are not preallocated, expected length can lie, zlib is used instead.
+    if (decodedLength <= MAX_PREALLOCATED_LENGTH)
+    {
+        if (libdeflate_decompressor* decompressor = libdeflate_alloc_decompressor())
+        {
+            qsizetype bufferSize = (decodedLength >= 0) ? decodedLength : qBound<qsizetype>(1024, data.size() * 4, MAX_PREALLOCATED_LENGTH);
+            libdeflate_result status = LIBDEFLATE_INSUFFICIENT_SPACE;
+            QByteArray result;
+            size_t actualLength = 0;
+
+            while (status == LIBDEFLATE_INSUFFICIENT_SPACE)
+            {
+                // Previous content of the buffer is not needed, data are decompressed again
+                result = QByteArray(bufferSize, Qt::Uninitialized);
+                status = libdeflate_zlib_decompress(decompressor, data.constData(), data.size(), result.data(), result.size(), &actualLength);
+
+                if (status == LIBDEFLATE_INSUFFICIENT_SPACE)
+                {
+                    if (bufferSize >= MAX_PREALLOCATED_LENGTH)
+                    {
+                        break;
+                    }
+
+                    bufferSize = qMin<qsizetype>(qMax<qsizetype>(bufferSize * 2, 1024), MAX_PREALLOCATED_LENGTH);
+                }
+            }
+
+            libdeflate_free_decompressor(decompressor);
+
+            if (status == LIBDEFLATE_SUCCESS)
+            {
+                if (qsizetype(actualLength) != result.size())
+                {
+                    // Buffer was too large, release the unused memory
+                    result.resize(actualLength);
+                    result.squeeze();
+                }
+                return result;
+            }
+        }
+    }
+#endif
+
+    return uncompressZlib(data, decodedLength);
+}
+
+QByteArray PDFFlateDecodeFilter::uncompressZlib(const QByteArray& data, PDFInteger decodedLength)
+{
+    z_stream stream = { };
+    stream.next_in = const_cast<Bytef*>(convertByteArrayToUcharPtr(data));
+    stream.avail_in = data.size();
 
     int error = inflateInit(&stream);
     if (error != Z_OK)
@@ -498,17 +1012,33 @@ QByteArray PDFFlateDecodeFilter::uncompress(const QByteArray& data)
         throw PDFException(PDFTranslationContext::tr("Failed to initialize flate decompression stream."));
     }
 
+    // Data are decompressed directly to the result buffer. If length of the decompressed
+    // data is unknown, we guess it and enlarge the buffer, when it is full. Expected length
+    // can be wrong, so preallocated size is limited.
+    const qsizetype allocatedSize = (decodedLength >= 0) ? qBound<qsizetype>(1024, decodedLength, MAX_PREALLOCATED_LENGTH) : qBound<qsizetype>(1024, data.size() * 4, MAX_PREALLOCATED_LENGTH);
+    QByteArray result(allocatedSize, Qt::Uninitialized);
+    qsizetype position = 0;
+
     do
     {
-        stream.next_out = outputBuffer.data();
-        stream.avail_out = static_cast<uInt>(outputBuffer.size());
+        if (position == result.size())
+        {
+            result.resize(result.size() * 2);
+        }
 
-        error = inflate(&stream, Z_NO_FLUSH);
+        stream.next_out = convertByteArrayToUcharPtr(result) + position;
+        stream.avail_out = static_cast<uInt>(qMin<qsizetype>(result.size() - position, std::numeric_limits<uInt>::max()));
 
-        int bytesWritten = int(outputBuffer.size()) - stream.avail_out;
-        result.append(reinterpret_cast<const char*>(outputBuffer.data()), bytesWritten);
+        error = inflate(&stream, Z_NO_FLUSH);
+        position = std::distance(convertByteArrayToUcharPtr(result), stream.next_out);
     } while (error == Z_OK);
 
+    result.resize(position);
+    if (position != allocatedSize)
+    {
+        result.squeeze();
+    }
+
     QString errorMessage;
     if (stream.msg)
     {
@@ -516,7 +1046,6 @@ QByteArray PDFFlateDecodeFilter::uncompress(const QByteArray& data)
     }
 
     inflateEnd(&stream);
-
     switch (error)
     {
         case Z_STREAM_END:
@@ -581,6 +1110,61 @@ QByteArray PDFRunLengthDecodeFilter::apply(const QByteArray& data,
     return result;
 }
 
+class PDFRunLengthFilterDecoder : public PDFBufferedFilterDecoder
+{
+public:
+    using PDFBufferedFilterDecoder::PDFBufferedFilterDecoder;
+
+protected:
+    virtual bool decode(QByteArray& output) override;
+};
+
+bool PDFRunLengthFilterDecoder::decode(QByteArray& output)
+{
+    while (output.size() < CHUNK_SIZE)
+    {
+        const int current = readInputByte();
+        if (current == -1 || current == 128)
+        {
+            // End of stream marker
+            return false;
+        }
+        else if (current < 128)
+        {
+            // Copy n + 1 characters from the input array literally
+            const qsizetype oldSize = output.size();
+            const qsizetype count = current + 1;
+            output.resize(oldSize + count);
+            output.resize(oldSize + readInput(output.data() + oldSize, count));
+        }
+        else
+        {
+            // Copy 257 - n copies of single character
+            const int toBeCopied = readInputByte();
+            if (toBeCopied == -1)
+            {
+                return false;
+            }
+
+            output.append(257 - current, static_cast<char>(toBeCopied));
+        }
+    }
+
+    return true;
+}
+
+PDFStreamFilterDecoderPointer PDFRunLengthDecodeFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                                      const PDFObjectFetcher& objectFetcher,
+                                                                      const PDFObject& parameters,
+                                                                      const PDFSecurityHandler* securityHandler) const
+{
+    Q_UNUSED(objectFetcher);
+    Q_UNUSED(parameters);
+    Q_UNUSED(securityHandler);
+
+    return std::make_unique<PDFRunLengthFilterDecoder>(qMove(input));
+}
+
 const PDFStreamFilter* PDFStreamFilterStorage::getFilter(const QByteArray& filterName)
 {
     const PDFStreamFilterStorage* instance = getInstance();
@@ -684,6 +1268,15 @@ QByteArray PDFStreamFilterStorage::getDecodedStream(const PDFStream* stream, con
         return QByteArray();
     }
 
+    // Length of the decoded data is known, if it is present
+    // in the stream dictionary. It is output of the last filter.
+    PDFInteger decodedLength = -1;
+    const PDFObject& decodedLengthObject = objectFetcher(stream->getDictionary()->get(PDF_STREAM_DICT_DECODED_LENGTH));
+    if (decodedLengthObject.isInt())
+    {
+        decodedLength = decodedLengthObject.getInteger();
+    }
+
     for (size_t i = 0, count = streamFilters.filterObjects.size(); i < count; ++i)
     {
         const PDFStreamFilter* streamFilter = streamFilters.filterObjects[i];
@@ -691,13 +1284,39 @@ QByteArray PDFStreamFilterStorage::getDecodedStream(const PDFStream* stream, con
 
         if (streamFilter)
         {
-            result = streamFilter->apply(result, objectFetcher, streamFilterParameters, securityHandler);
+            const bool isLastFilter = (i + 1 == count);
+            result = streamFilter->applyWithLengthHint(result, objectFetcher, streamFilterParameters, securityHandler, isLastFilter ? decodedLength : -1);
         }
     }
 
     return result;
 }
 
+PDFStreamFilterDecoderPointer PDFStreamFilterStorage::createDecoder(const PDFStream* stream, const PDFObjectFetcher& objectFetcher, const PDFSecurityHandler* securityHandler)
+{
+    StreamFilters streamFilters = getStreamFilters(stream, objectFetcher);
+
+    if (!streamFilters.valid)
+    {
+        // Stream filters are invalid
+        return std::make_unique<PDFBufferFilterDecoder>(QByteArray());
+    }
+
+    PDFStreamFilterDecoderPointer decoder = std::make_unique<PDFBufferFilterDecoder>(*stream->getContent());
+    for (size_t i = 0, count = streamFilters.filterObjects.size(); i < count; ++i)
+    {
+        const PDFStreamFilter* streamFilter = streamFilters.filterObjects[i];
+        const PDFObject& streamFilterParameters = streamFilters.filterParameterObjects[i];
+
+        if (streamFilter)
+        {
+            decoder = streamFilter->createDecoder(qMove(decoder), objectFetcher, streamFilterParameters, securityHandler);
+        }
+    }
+
+    return decoder;
+}
+
 QByteArray PDFStreamFilterStorage::getDecodedStream(const PDFStream* stream, const PDFSecurityHandler* securityHandler)
 {
     return getDecodedStream(stream, [](const PDFObject& object) -> const PDFObject& { return object; }, securityHandler);
@@ -778,7 +1397,7 @@ PDFStreamPredictor PDFStreamPredictor::createPredictor(const PDFObjectFetcher& o
     return PDFStreamPredictor();
 }
 
-QByteArray PDFStreamPredictor::apply(const QByteArray& data) const
+QByteArray PDFStreamPredictor::apply(QByteArray data) const
 {
     switch (m_predictor)
     {
@@ -786,13 +1405,13 @@ QByteArray PDFStreamPredictor::apply(const QByteArray& data) const
             return data;
 
         case TIFF:
-            return applyTIFFPredictor(data);
+            return applyTIFFPredictor(qMove(data));
 
         default:
         {
             if (m_predictor >= 10)
             {
-                return applyPNGPredictor(data);
+                return applyPNGPredictor(qMove(data));
             }
             break;
         }
@@ -801,137 +1420,398 @@ QByteArray PDFStreamPredictor::apply(const QByteArray& data) const
     throw PDFException(PDFTranslationContext::tr("Invalid predictor algorithm."));
 }
 
-QByteArray PDFStreamPredictor::applyPNGPredictor(const QByteArray& data) const
+QByteArray PDFStreamPredictor::applyPNGPredictor(QByteArray data) const
 {
-    QByteArray outputData;
-    outputData.reserve(data.size());
-
-    auto it = data.cbegin();
-    auto itEnd = data.cend();
+    const qsizetype rowBytes = qsizetype(m_stride) + 1;
+    const qsizetype rowCount = (data.size() + rowBytes - 1) / rowBytes;
+    const qsizetype completeRowCount = data.size() / rowBytes;
+
+    // Rows are decoded in place. Decoded row is shorter than the encoded row (it doesn't
+    // contain the predictor byte), so decoded data never overwrite input data, which
+    // were not used yet.
+    uint8_t* buffer = convertByteArrayToUcharPtr(data);
+    std::vector<uint8_t> zeroRow(m_stride, 0);
+    const uint8_t* previous = zeroRow.data();
+
+    for (qsizetype i = 0; i < completeRowCount; ++i)
+    {
+        const uint8_t* input = buffer + i * rowBytes;
+        uint8_t* output = buffer + i * m_stride;
 
-    int pixelBytes = (m_components * m_bitsPerComponent + 7) / 8;
+        // First byte of the row is the predictor for current line
+        applyPNGPredictorRow(static_cast<Predictor>(input[0] + 10), input + 1, output, previous);
+        previous = output;
+    }
 
-    auto readByte = [&it, &itEnd]() -> uint8_t
+    // According to the PDF specification, incomplete line is completed. For this
+    // reason, we behave as we have zero data in the buffer.
+    std::vector<uint8_t> incompleteRow;
+    if (completeRowCount < rowCount)
     {
-        if (it != itEnd)
-        {
-            return static_cast<uint8_t>(*it++);
-        }
-
-        // According to the PDF specification, incomplete line is completed. For this
-        // reason, we behave as we have zero data in the buffer.
-        return 0;
-    };
+        incompleteRow.resize(rowBytes, 0);
+        std::copy(buffer + completeRowCount * rowBytes, buffer + data.size(), incompleteRow.begin());
+    }
 
-    // Idea: to avoid using if for many cases, we use larger buffer filled with zeros
-    const int totalBytes = m_stride + pixelBytes;
-    std::vector<uint8_t> line(totalBytes, 0);
-    std::vector<uint8_t> lineOld(totalBytes, 0);
+    data.resize(rowCount * m_stride);
 
-    Predictor currentPredictor = m_predictor;
-    while (it != itEnd)
+    if (!incompleteRow.empty())
     {
-        // First, read the predictor data for current line
-        currentPredictor = static_cast<Predictor>(readByte() + 10);
+        buffer = convertByteArrayToUcharPtr(data);
+        previous = (completeRowCount > 0) ? buffer + (completeRowCount - 1) * m_stride : zeroRow.data();
+        applyPNGPredictorRow(static_cast<Predictor>(incompleteRow[0] + 10), incompleteRow.data() + 1, buffer + completeRowCount * m_stride, previous);
+    }
+
+    return data;
+}
 
-        for (int i = 0; i < m_stride; ++i)
+template<int PixelBytes>
+void PDFStreamPredictor::applyPNGPredictorRowImpl(Predictor predictor, const uint8_t* input, uint8_t* output, const uint8_t* previous, int stride, int pixelBytes)
+{
+    // For common pixel sizes, distance of the left pixel is a compile time constant,
+    // so compiler can unroll the loops. Loops without dependency on the left
+    // pixel (Up, None) can be vectorized. Left pixel of the first pixel
+    // in the row is zero, so first pixel is handled separately.
+    const int bpp = (PixelBytes > 0) ? PixelBytes : pixelBytes;
+    const int firstPixelBytes = qMin(bpp, stride);
+
+    switch (predictor)
+    {
+        case PNG_Sub:
         {
-            uint8_t currentByte = readByte();
+            for (int i = 0; i < firstPixelBytes; ++i)
+            {
+                output[i] = input[i];
+            }
 
-            int lineIndex = i + pixelBytes;
-            switch (currentPredictor)
+            for (int i = bpp; i < stride; ++i)
             {
-                case PNG_Sub:
-                {
-                    line[lineIndex] = line[i] + currentByte;
-                    break;
-                }
+                output[i] = input[i] + output[i - bpp];
+            }
+            break;
+        }
 
-                case PNG_Up:
-                {
-                    line[lineIndex] = lineOld[lineIndex] + currentByte;
-                    break;
-                }
+        case PNG_Up:
+        {
+            for (int i = 0; i < stride; ++i)
+            {
+                output[i] = input[i] + previous[i];
+            }
+            break;
+        }
 
-                case PNG_Average:
-                {
-                    line[lineIndex] = (lineOld[lineIndex] + line[i]) / 2 + currentByte;
-                    break;
-                }
+        case PNG_Average:
+        {
+            for (int i = 0; i < firstPixelBytes; ++i)
+            {
+                output[i] = input[i] + previous[i] / 2;
+            }
 
-                case PNG_Paeth:
-                {
-                    // a = left,
-                    // b = upper,
-                    // c = upper left
-                    const int a = line[i];
-                    const int b = lineOld[lineIndex];
-                    const int c = lineOld[i];
-                    const int p = a + b - c;
-                    const int pa = std::abs(p - a);
-                    const int pb = std::abs(p - b);
-                    const int pc = std::abs(p - c);
-                    if (pa <= pb && pa <= pc)
-                    {
-                        line[lineIndex] = a + currentByte;
-                    }
-                    else if (pb <= pc)
-                    {
-                        line[lineIndex] = b + currentByte;
-                    }
-                    else
-                    {
-                        line[lineIndex] = c + currentByte;
-                    }
-                    break;
-                }
+            for (int i = bpp; i < stride; ++i)
+            {
+                output[i] = input[i] + (output[i - bpp] + previous[i]) / 2;
+            }
+            break;
+        }
 
-                case PNG_None:
-                default:
-                {
-                    line[lineIndex] = currentByte;
-                    break;
-                }
+        case PNG_Paeth:
+        {
+            // For the first pixel, left and upper left values are zero,
+            // so predicted value is the upper value.
+            for (int i = 0; i < firstPixelBytes; ++i)
+            {
+                output[i] = input[i] + previous[i];
             }
 
-            // Fill the output buffer
-            outputData.push_back(static_cast<char>(line[lineIndex]));
+            for (int i = bpp; i < stride; ++i)
+            {
+                // a = left,
+                // b = upper,
+                // c = upper left
+                const int a = output[i - bpp];
+                const int b = previous[i];
+                const int c = previous[i - bpp];
+                const int p = a + b - c;
+                const int pa = std::abs(p - a);
+                const int pb = std::abs(p - b);
+                const int pc = std::abs(p - c);
+                const int predicted = (pa <= pb && pa <= pc) ? a : ((pb <= pc) ? b : c);
+                output[i] = input[i] + predicted;
+            }
+            break;
         }
 
-        // Swap the buffers
-        std::swap(line, lineOld);
+        case PNG_None:
+        default:
+        {
+            // Rows can overlap
+            std::memmove(output, input, stride);
+            break;
+        }
     }
+}
+
+void PDFStreamPredictor::applyPNGPredictorRow(Predictor predictor, const uint8_t* input, uint8_t* output, const uint8_t* previous) const
+{
+    const int pixelBytes = getPixelBytes();
+
+    switch (pixelBytes)
+    {
+        case 1:
+            applyPNGPredictorRowImpl<1>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
 
-    return outputData;
+        case 2:
+            applyPNGPredictorRowImpl<2>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+
+        case 3:
+            applyPNGPredictorRowImpl<3>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+
+        case 4:
+            applyPNGPredictorRowImpl<4>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+
+        case 6:
+            applyPNGPredictorRowImpl<6>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+
+        case 8:
+            applyPNGPredictorRowImpl<8>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+
+        default:
+            applyPNGPredictorRowImpl<0>(predictor, input, output, previous, m_stride, pixelBytes);
+            break;
+    }
 }
 
-QByteArray PDFStreamPredictor::applyTIFFPredictor(const QByteArray& data) const
+QByteArray PDFStreamPredictor::applyTIFFPredictor(QByteArray data) const
 {
-    Q_UNUSED(data);
+    if (isTIFFPredictorInPlace() && data.size() % m_stride == 0)
+    {
+        uint8_t* buffer = convertByteArrayToUcharPtr(data);
+        for (qsizetype offset = 0; offset < data.size(); offset += m_stride)
+        {
+            applyTIFFPredictorRow(buffer + offset);
+        }
+
+        return data;
+    }
 
     PDFBitWriter writer(m_bitsPerComponent);
     PDFBitReader reader(&data, m_bitsPerComponent);
 
     writer.reserve(data.size());
-    std::vector<uint32_t> leftValues(m_components, 0);
 
     while (!reader.isAtEnd())
     {
-        for (int i = 0; i < m_columns; ++i)
+        applyTIFFPredictorRow(reader, writer);
+    }
+
+    return writer.takeByteArray();
+}
+
+void PDFStreamPredictor::applyTIFFPredictorRow(uint8_t* row) const
+{
+    Q_ASSERT(isTIFFPredictorInPlace());
+
+    if (m_bitsPerComponent == 8)
+    {
+        for (int i = m_components; i < m_stride; ++i)
+        {
+            row[i] += row[i - m_components];
+        }
+    }
+    else
+    {
+        // Components are 16-bit big endian values
+        const int leftDistance = 2 * m_components;
+        for (int i = leftDistance; i < m_stride; i += 2)
+        {
+            const quint16 value = qFromBigEndian<quint16>(row + i) + qFromBigEndian<quint16>(row + i - leftDistance);
+            qToBigEndian<quint16>(value, row + i);
+        }
+    }
+}
+
+void PDFStreamPredictor::applyTIFFPredictorRow(PDFBitReader& reader, PDFBitWriter& writer) const
+{
+    std::array<uint32_t, PDF_MAX_COLOR_COMPONENTS> leftValues = { };
+
+    for (int i = 0; i < m_columns; ++i)
+    {
+        for (int componentIndex = 0; componentIndex < m_components; ++componentIndex)
         {
-            for (int componentIndex = 0; componentIndex < m_components; ++componentIndex)
+            leftValues[componentIndex] = (leftValues[componentIndex] + reader.read()) & reader.max();
+            writer.write(leftValues[componentIndex]);
+        }
+    }
+
+    reader.alignToBytes();
+    writer.finishLine();
+}
+
+class PDFPredictorFilterDecoder : public PDFBufferedFilterDecoder
+{
+public:
+    explicit PDFPredictorFilterDecoder(PDFStreamFilterDecoderPointer input, PDFStreamPredictor predictor);
+
+protected:
+    virtual bool decode(QByteArray& output) override;
+
+private:
+    bool decodePNG(QByteArray& output);
+    bool decodeTIFF(QByteArray& output);
+
+    PDFStreamPredictor m_predictor;
+    QByteArray m_row;
+    std::vector<uint8_t> m_line;
+    std::vector<uint8_t> m_lineOld;
+};
+
+PDFPredictorFilterDecoder::PDFPredictorFilterDecoder(PDFStreamFilterDecoderPointer input, PDFStreamPredictor predictor) :
+    PDFBufferedFilterDecoder(qMove(input)),
+    m_predictor(qMove(predictor))
+{
+    if (m_predictor.m_predictor == PDFStreamPredictor::TIFF)
+    {
+        m_row.resize(m_predictor.m_stride);
+    }
+    else
+    {
+        m_row.resize(m_predictor.m_stride + 1);
+        m_line.resize(m_predictor.m_stride, 0);
+        m_lineOld.resize(m_predictor.m_stride, 0);
+    }
+}
+
+bool PDFPredictorFilterDecoder::decode(QByteArray& output)
+{
+    if (m_predictor.m_predictor == PDFStreamPredictor::TIFF)
+    {
+        return decodeTIFF(output);
+    }
+
+    return decodePNG(output);
+}
+
+bool PDFPredictorFilterDecoder::decodePNG(QByteArray& output)
+{
+    while (output.size() < CHUNK_SIZE)
+    {
+        const qsizetype bytesRead = readInput(m_row.data(), m_row.size());
+        if (bytesRead == 0)
+        {
+            return false;
+        }
+
+        // According to the PDF specification, incomplete line is completed by zeros
+        std::fill(std::next(m_row.begin(), bytesRead), m_row.end(), 0);
+
+        const uint8_t* row = convertByteArrayToUcharPtr(m_row);
+        m_predictor.applyPNGPredictorRow(static_cast<PDFStreamPredictor::Predictor>(row[0] + 10), row + 1, m_line.data(), m_lineOld.data());
+        output.append(reinterpret_cast<const char*>(m_line.data()), m_predictor.m_stride);
+        std::swap(m_line, m_lineOld);
+
+        if (bytesRead < m_row.size())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool PDFPredictorFilterDecoder::decodeTIFF(QByteArray& output)
+{
+    if (m_predictor.isTIFFPredictorInPlace())
+    {
+        while (output.size() < CHUNK_SIZE)
+        {
+            const qsizetype bytesRead = readInput(m_row.data(), m_row.size());
+            if (bytesRead == 0)
+            {
+                return false;
+            }
+
+            if (bytesRead < m_row.size())
             {
-                leftValues[componentIndex] = (leftValues[componentIndex] + reader.read()) & reader.max();
-                writer.write(leftValues[componentIndex]);
+                throw PDFException(PDFTranslationContext::tr("Not enough data to read %1-bit value.").arg(m_predictor.m_bitsPerComponent));
             }
+
+            m_predictor.applyTIFFPredictorRow(convertByteArrayToUcharPtr(m_row));
+            output.append(m_row);
         }
 
-        std::fill(leftValues.begin(), leftValues.end(), 0);
-        reader.alignToBytes();
-        writer.finishLine();
+        return true;
     }
 
-    return writer.takeByteArray();
+    PDFBitWriter writer(m_predictor.m_bitsPerComponent);
+
+    bool hasMoreData = true;
+    for (qsizetype decodedBytes = 0; decodedBytes < CHUNK_SIZE; decodedBytes += m_row.size())
+    {
+        const qsizetype bytesRead = readInput(m_row.data(), m_row.size());
+        if (bytesRead == 0)
+        {
+            hasMoreData = false;
+            break;
+        }
+
+        // Incomplete row causes an exception in the reader, as in the whole buffer decoding
+        QByteArray row = QByteArray::fromRawData(m_row.constData(), bytesRead);
+        PDFBitReader reader(&row, m_predictor.m_bitsPerComponent);
+        m_predictor.applyTIFFPredictorRow(reader, writer);
+    }
+
+    output.append(writer.takeByteArray());
+    return hasMoreData;
+}
+
+PDFInteger PDFStreamPredictor::getEncodedDataLength(PDFInteger decodedLength) const
+{
+    if (decodedLength < 0)
+    {
+        return -1;
+    }
+
+    if (m_predictor >= 10 && m_stride > 0)
+    {
+        // Each row of the PNG predictor has one extra byte (predictor of the row)
+        const PDFInteger rowCount = decodedLength / m_stride + ((decodedLength % m_stride) ? 1 : 0);
+        if (rowCount > std::numeric_limits<PDFInteger>::max() / (m_stride + 1))
+        {
+            return -1;
+        }
+
+        return rowCount * (m_stride + 1);
+    }
+
+    return decodedLength;
+}
+
+PDFStreamFilterDecoderPointer PDFStreamPredictor::createDecoder(PDFStreamFilterDecoderPointer input) const
+{
+    switch (m_predictor)
+    {
+        case NoPredictor:
+            return input;
+
+        case TIFF:
+            return std::make_unique<PDFPredictorFilterDecoder>(qMove(input), *this);
+
+        default:
+        {
+            if (m_predictor >= 10)
+            {
+                return std::make_unique<PDFPredictorFilterDecoder>(qMove(input), *this);
+            }
+            break;
+        }
+    }
+
+    throw PDFException(PDFTranslationContext::tr("Invalid predictor algorithm."));
 }
 
 QByteArray PDFCryptFilter::apply(const QByteArray& data,
@@ -966,6 +1846,26 @@ QByteArray PDFCryptFilter::apply(const QByteArray& data,
     return securityHandler->decryptByFilter(data, cryptFilterName, objectReference);
 }
 
+QByteArray PDFStreamFilter::applyWithLengthHint(const QByteArray& data,
+                                                const PDFObjectFetcher& objectFetcher,
+                                                const PDFObject& parameters,
+                                                const PDFSecurityHandler* securityHandler,
+                                                PDFInteger decodedLength) const
+{
+    Q_UNUSED(decodedLength);
+
+    return apply(data, objectFetcher, parameters, securityHandler);
+}
+
+PDFStreamFilterDecoderPointer PDFStreamFilter::createDecoder(PDFStreamFilterDecoderPointer input,
+                                                             const PDFObjectFetcher& objectFetcher,
+                                                             const PDFObject& parameters,
+                                                             const PDFSecurityHandler* securityHandler) const
+{
+    QByteArray data = input->readAll();
+    return std::make_unique<PDFBufferFilterDecoder>(apply(data, objectFetcher, parameters, securityHandler));
+}
+
 PDFInteger PDFStreamFilter::getStreamDataLength(const QByteArray& data, PDFInteger offset) const
 {
     Q_UNUSED(data);
@@ -974,4 +1874,46 @@ PDFInteger PDFStreamFilter::getStreamDataLength(const QByteArray& data, PDFInteg
     return -1;
 }
 
+PDFStreamFilterDevice::PDFStreamFilterDevice(PDFStreamFilterDecoderPointer decoder, QObject* parent) :
+    QIODevice(parent),
+    m_decoder(qMove(decoder)),
+    m_finished(false)
+{
+    open(QIODevice::ReadOnly);
+}
+
+bool PDFStreamFilterDevice::atEnd() const
+{
+    return m_finished && QIODevice::atEnd();
+}
+
+qint64 PDFStreamFilterDevice::readData(char* data, qint64 maxSize)
+{
+    if (m_finished)
+    {
+        return 0;
+    }
+
+    try
+    {
+        const qint64 bytesRead = m_decoder->read(data, maxSize);
+        m_finished = bytesRead == 0;
+        return bytesRead;
+    }
+    catch (const PDFException& exception)
+    {
+        setErrorString(exception.getMessage());
+        m_finished = true;
+        return -1;
+    }
+}
+
+qint64 PDFStreamFilterDevice::writeData(const char* data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+
+    return -1;
+}
+
 }   // namespace pdf
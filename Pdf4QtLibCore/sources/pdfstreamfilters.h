@@ -21,17 +21,78 @@
 #include "pdfobject.h"
 
 #include <QByteArray>
+#include <QIODevice>
 
 #include <memory>
 #include <functional>
 
 namespace pdf
 {
+class PDFBitReader;
+class PDFBitWriter;
 class PDFStreamFilter;
 class PDFSecurityHandler;
 
 using PDFObjectFetcher = std::function<const PDFObject&(const PDFObject&)>;
 
+/// Pull-based decoder of the stream data. Decoders are chained - each decoder
+/// reads its input from the previous decoder in the chain, so stream can be decoded
+/// in chunks, without materializing whole intermediate results of the filters.
+class PDF4QTLIBCORESHARED_EXPORT PDFStreamFilterDecoder
+{
+public:
+    explicit PDFStreamFilterDecoder() = default;
+    virtual ~PDFStreamFilterDecoder() = default;
+
+    /// Reads at most \p maxSize bytes of the decoded data into the buffer. Returns
+    /// number of bytes read, zero is returned, if end of stream is reached. If error
+    /// occurs, exception is thrown.
+    /// \param data Output buffer
+    /// \param maxSize Size of the output buffer
+    virtual qint64 read(char* data, qint64 maxSize) = 0;
+
+    /// Reads all remaining decoded data
+    QByteArray readAll();
+};
+
+using PDFStreamFilterDecoderPointer = std::unique_ptr<PDFStreamFilterDecoder>;
+
+/// Decoder, which reads data from the byte array. It is used as a source
+/// of the decoder chain, and for filters, which can't decode data in chunks.
+class PDF4QTLIBCORESHARED_EXPORT PDFBufferFilterDecoder : public PDFStreamFilterDecoder
+{
+public:
+    explicit PDFBufferFilterDecoder(QByteArray data);
+    virtual ~PDFBufferFilterDecoder() override = default;
+
+    virtual qint64 read(char* data, qint64 maxSize) override;
+
+private:
+    QByteArray m_data;
+    qsizetype m_position;
+};
+
+/// Sequential read-only device, which reads decoded stream data from the
+/// decoder chain. Device is opened in the constructor. Errors of the decoding
+/// are reported using error string of the device.
+class PDF4QTLIBCORESHARED_EXPORT PDFStreamFilterDevice : public QIODevice
+{
+public:
+    explicit PDFStreamFilterDevice(PDFStreamFilterDecoderPointer decoder, QObject* parent = nullptr);
+    virtual ~PDFStreamFilterDevice() override = default;
+
+    virtual bool isSequential() const override { return true; }
+    virtual bool atEnd() const override;
+
+protected:
+    virtual qint64 readData(char* data, qint64 maxSize) override;
+    virtual qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    PDFStreamFilterDecoderPointer m_decoder;
+    bool m_finished;
+};
+
 /// Storage for stream filters. Can retrieve stream filters by name. Using singleton
 /// design pattern. Use static methods to retrieve filters.
 class PDFStreamFilterStorage
@@ -54,6 +115,15 @@ public:
     /// \param securityHandler Security handler for Crypt filters
     static QByteArray getDecodedStream(const PDFStream* stream, const PDFSecurityHandler* securityHandler);
 
+    /// Creates decoder chain, which decodes the stream data in chunks. Filter
+    /// parameters are processed when the chain is created, encoded data of the
+    /// stream are shared with the decoder. If stream filters are invalid,
+    /// decoder returns no data.
+    /// \param stream Stream containing the data
+    /// \param objectFetcher Function which retrieves objects (for example, reads objects from reference)
+    /// \param securityHandler Security handler for Crypt filters
+    static PDFStreamFilterDecoderPointer createDecoder(const PDFStream* stream, const PDFObjectFetcher& objectFetcher, const PDFSecurityHandler* securityHandler);
+
     /// Tries to find stream data length using given filter. Stream will
     /// start at given \p offset in \p data. If stream length cannot be determined,
     /// then -1 is returned.
@@ -87,7 +157,7 @@ private:
     std::map<QByteArray, QByteArray> m_abbreviations;
 };
 
-class PDFStreamPredictor
+class PDF4QTLIBCORESHARED_EXPORT PDFStreamPredictor
 {
 public:
     /// Create predictor from stream parameters. If error occurs, exception is thrown.
@@ -95,11 +165,24 @@ public:
     /// \param parameters Parameters of the predictor (must be an dictionary)
     static PDFStreamPredictor createPredictor(const PDFObjectFetcher& objectFetcher, const PDFObject& parameters);
 
-    /// Applies the predictor to the data.
+    /// Applies the predictor to the data. Data are decoded in place,
+    /// so no copy is made, if \p data are not shared.
     /// \param data Data to be decoded using predictor
-    QByteArray apply(const QByteArray& data) const;
+    QByteArray apply(QByteArray data) const;
+
+    /// Returns length of the data before applying the predictor, if length of
+    /// the data after applying the predictor is \p decodedLength. If \p decodedLength
+    /// is negative (unknown), then -1 is returned.
+    /// \param decodedLength Length of the decoded data
+    PDFInteger getEncodedDataLength(PDFInteger decodedLength) const;
+
+    /// Creates decoder, which applies the predictor row by row
+    /// to the data read from \p input decoder.
+    /// \param input Input decoder
+    PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input) const;
 
 private:
+    friend class PDFPredictorFilterDecoder;
 
     enum Predictor
     {
@@ -124,11 +207,40 @@ private:
         m_stride = (m_columns * m_components * m_bitsPerComponent + 7) / 8;
     }
 
-    /// Applies PNG predictor
-    QByteArray applyPNGPredictor(const QByteArray& data) const;
+    /// Applies PNG predictor (in place)
+    QByteArray applyPNGPredictor(QByteArray data) const;
+
+    /// Applies TIFF predictor (in place, if possible)
+    QByteArray applyTIFFPredictor(QByteArray data) const;
+
+    /// Decodes single row using PNG predictor. Output row can overlap
+    /// the input row, if it starts before the input row.
+    /// \param predictor Predictor of the row
+    /// \param input Input data of the row (stride bytes)
+    /// \param output Decoded row (stride bytes)
+    /// \param previous Previously decoded row (zeros for the first row)
+    void applyPNGPredictorRow(Predictor predictor, const uint8_t* input, uint8_t* output, const uint8_t* previous) const;
+
+    /// Implementation of \p applyPNGPredictorRow. If \p PixelBytes is positive,
+    /// then it is used as bytes per pixel, otherwise \p pixelBytes is used.
+    template<int PixelBytes>
+    static void applyPNGPredictorRowImpl(Predictor predictor, const uint8_t* input, uint8_t* output, const uint8_t* previous, int stride, int pixelBytes);
 
-    /// Applies TIFF predictor
-    QByteArray applyTIFFPredictor(const QByteArray& data) const;
+    /// Returns true, if TIFF predictor can be applied in place
+    /// using \p applyTIFFPredictorRow (8 and 16 bits per component)
+    bool isTIFFPredictorInPlace() const { return m_bitsPerComponent == 8 || m_bitsPerComponent == 16; }
+
+    /// Decodes single row using TIFF predictor in place
+    /// \param row Row data (stride bytes)
+    void applyTIFFPredictorRow(uint8_t* row) const;
+
+    /// Decodes single row using TIFF predictor and writes it to the \p writer.
+    /// \param reader Reader of the input data, positioned at the start of the row
+    /// \param writer Writer of the output data
+    void applyTIFFPredictorRow(PDFBitReader& reader, PDFBitWriter& writer) const;
+
+    /// Returns number of bytes of one pixel (rounded up)
+    int getPixelBytes() const { return (m_components * m_bitsPerComponent + 7) / 8; }
 
     Predictor m_predictor = NoPredictor;
     int m_components = 0;
@@ -149,6 +261,22 @@ public:
     /// \param parameters Stream parameters
     virtual QByteArray apply(const QByteArray& data, const PDFObjectFetcher& objectFetcher, const PDFObject& parameters, const PDFSecurityHandler* securityHandler) const = 0;
 
+    /// Apply with expected length of the decoded data. Length is only a hint (it can
+    /// be wrong), filter can use it to preallocate the output buffer. Default
+    /// implementation ignores the hint.
+    /// \param data Stream data to be decoded
+    /// \param objectFetcher Function which retrieves objects (for example, reads objects from reference)
+    /// \param parameters Stream parameters
+    /// \param decodedLength Expected length of the decoded data, -1, if it is unknown
+    virtual QByteArray applyWithLengthHint(const QByteArray& data, const PDFObjectFetcher& objectFetcher, const PDFObject& parameters, const PDFSecurityHandler* securityHandler, PDFInteger decodedLength) const;
+
+    /// Creates decoder, which decodes data from the \p input decoder in chunks. Default
+    /// implementation reads whole input and applies the filter to it.
+    /// \param input Input decoder
+    /// \param objectFetcher Function which retrieves objects (for example, reads objects from reference)
+    /// \param parameters Stream parameters
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input, const PDFObjectFetcher& objectFetcher, const PDFObject& parameters, const PDFSecurityHandler* securityHandler) const;
+
     /// Apply without object fetcher - it assumes no references exists in the streams dictionary
     /// \param data Stream data to be decoded
     /// \param parameters Stream parameters
@@ -174,6 +302,11 @@ public:
                              const PDFObjectFetcher& objectFetcher,
                              const PDFObject& parameters,
                              const PDFSecurityHandler* securityHandler) const override;
+
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input,
+                                                       const PDFObjectFetcher& objectFetcher,
+                                                       const PDFObject& parameters,
+                                                       const PDFSecurityHandler* securityHandler) const override;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFAscii85DecodeFilter : public PDFStreamFilter
@@ -186,6 +319,11 @@ public:
                              const PDFObjectFetcher& objectFetcher,
                              const PDFObject& parameters,
                              const PDFSecurityHandler* securityHandler) const override;
+
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input,
+                                                       const PDFObjectFetcher& objectFetcher,
+                                                       const PDFObject& parameters,
+                                                       const PDFSecurityHandler* securityHandler) const override;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFLzwDecodeFilter : public PDFStreamFilter
@@ -198,6 +336,11 @@ public:
                              const PDFObjectFetcher& objectFetcher,
                              const PDFObject& parameters,
                              const PDFSecurityHandler* securityHandler) const override;
+
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input,
+                                                       const PDFObjectFetcher& objectFetcher,
+                                                       const PDFObject& parameters,
+                                                       const PDFSecurityHandler* securityHandler) const override;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFFlateDecodeFilter : public PDFStreamFilter
@@ -211,6 +354,17 @@ public:
                              const PDFObject& parameters,
                              const PDFSecurityHandler* securityHandler) const override;
 
+    virtual QByteArray applyWithLengthHint(const QByteArray& data,
+                                           const PDFObjectFetcher& objectFetcher,
+                                           const PDFObject& parameters,
+                                           const PDFSecurityHandler* securityHandler,
+                                           PDFInteger decodedLength) const override;
+
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input,
+                                                       const PDFObjectFetcher& objectFetcher,
+                                                       const PDFObject& parameters,
+                                                       const PDFSecurityHandler* securityHandler) const override;
+
     virtual PDFInteger getStreamDataLength(const QByteArray& data, PDFInteger offset) const override;
 
     /// Recompresses data. So, first, data are decompressed, and then
@@ -222,8 +376,28 @@ public:
     /// \param data Compressed data to be recompressed
     static QByteArray recompress(const QByteArray& data);
 
+    /// Returns name of the deflate backend used for compression and decompression
+    static QString getBackendName();
+
 private:
-    static QByteArray uncompress(const QByteArray& data);
+    /// Maximal compression ratio of the deflate algorithm (it is slightly
+    /// above 1032:1), used to validate expected length of decoded data.
+    static constexpr PDFInteger MAX_COMPRESSION_RATIO = 1040;
+
+    /// Maximal size of the buffer, which is preallocated using expected (or guessed) length
+    /// of decoded data. Expected length can be wrong, so larger buffers are
+    /// not preallocated, but they grow, as data are decompressed.
+    static constexpr PDFInteger MAX_PREALLOCATED_LENGTH = 64 * 1024 * 1024;
+
+    /// Decompresses the data
+    /// \param data Compressed data
+    /// \param decodedLength Expected length of the decompressed data (hint), -1, if it is unknown
+    static QByteArray uncompress(const QByteArray& data, PDFInteger decodedLength = -1);
+
+    /// Decompresses the data using zlib
+    /// \param data Compressed data
+    /// \param decodedLength Expected length of the decompressed data (hint), -1, if it is unknown
+    static QByteArray uncompressZlib(const QByteArray& data, PDFInteger decodedLength);
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFRunLengthDecodeFilter : public PDFStreamFilter
@@ -236,6 +410,11 @@ public:
                              const PDFObjectFetcher& objectFetcher,
                              const PDFObject& parameters,
                              const PDFSecurityHandler* securityHandler) const override;
+
+    virtual PDFStreamFilterDecoderPointer createDecoder(PDFStreamFilterDecoderPointer input,
+                                                       const PDFObjectFetcher& objectFetcher,
+                                                       const PDFObject& parameters,
+                                                       const PDFSecurityHandler* securityHandler) const override;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFCryptFilter : public PDFStreamFilter
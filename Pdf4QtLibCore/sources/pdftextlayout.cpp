@@ -279,7 +279,7 @@ void PDFTextLayout::addCharacter(const PDFTextCharacterInfo& info)
     QLineF fontMappedLine = info.matrix.map(fontTestLine);
     character.fontSize = fontMappedLine.length();
 
-    QRectF boundingBox = info.outline.boundingRect();
+    QRectF boundingBox = info.outlineMatrix.mapRect(info.outline.boundingRect());
     character.boundingBox.addPolygon(info.matrix.map(boundingBox));
 
     m_characters.emplace_back(qMove(character));
@@ -549,6 +549,67 @@ PDFTextSelection PDFTextLayout::selectLineInBlock(const size_t blockIndex, const
     return selection;
 }
 
+PDFTextSelectionItems PDFTextLayout::selectAll(PDFInteger pageIndex) const
+{
+    PDFTextSelectionItems items;
+
+    for (size_t blockId = 0, blockCount = m_blocks.size(); blockId < blockCount; ++blockId)
+    {
+        const PDFTextBlock& block = m_blocks[blockId];
+        const PDFTextLines& lines = block.getLines();
+
+        if (!lines.empty())
+        {
+            const PDFTextLine& lastLine = lines.back();
+            Q_ASSERT(!lastLine.getCharacters().empty());
+
+            PDFCharacterPointer ptrStart;
+            ptrStart.pageIndex = pageIndex;
+            ptrStart.blockIndex = blockId;
+            ptrStart.lineIndex = 0;
+            ptrStart.characterIndex = 0;
+
+            PDFCharacterPointer ptrEnd;
+            ptrEnd.pageIndex = pageIndex;
+            ptrEnd.blockIndex = blockId;
+            ptrEnd.lineIndex = lines.size() - 1;
+            ptrEnd.characterIndex = lastLine.getCharacters().size() - 1;
+
+            items.emplace_back(ptrStart, ptrEnd);
+        }
+    }
+
+    return items;
+}
+
+PDFFindResults PDFTextLayout::find(const QString& text, Qt::CaseSensitivity caseSensitivity, PDFTextFlow::FlowFlags flowFlags, PDFInteger pageIndex) const
+{
+    PDFFindResults results;
+
+    PDFTextFlows textFlows = PDFTextFlow::createTextFlows(*this, flowFlags, pageIndex);
+    for (const PDFTextFlow& textFlow : textFlows)
+    {
+        PDFFindResults flowResults = textFlow.find(text, caseSensitivity);
+        results.insert(results.end(), flowResults.begin(), flowResults.end());
+    }
+
+    return results;
+}
+
+PDFFindResults PDFTextLayout::find(const QRegularExpression& expression, PDFTextFlow::FlowFlags flowFlags, PDFInteger pageIndex) const
+{
+    PDFFindResults results;
+
+    PDFTextFlows textFlows = PDFTextFlow::createTextFlows(*this, flowFlags, pageIndex);
+    for (const PDFTextFlow& textFlow : textFlows)
+    {
+        PDFFindResults flowResults = textFlow.find(expression);
+        results.insert(results.end(), flowResults.begin(), flowResults.end());
+    }
+
+    return results;
+}
+
 QString PDFTextLayout::getTextFromSelection(PDFTextSelection::iterator itBegin, PDFTextSelection::iterator itEnd, PDFInteger pageIndex) const
 {
     QStringList text;
@@ -1135,18 +1196,13 @@ PDFFindResults PDFTextLayoutStorage::find(const QString& text, Qt::CaseSensitivi
     QMutex resultsMutex;
     auto findImpl = [this, flowFlags, caseSensitivity, &results, &resultsMutex, &text](size_t pageIndex)
     {
-        PDFTextLayout textLayout = getTextLayout(pageIndex);
-        PDFTextFlows textFlows = PDFTextFlow::createTextFlows(textLayout, flowFlags, pageIndex);
-        for (const PDFTextFlow& textFlow : textFlows)
-        {
-            PDFFindResults flowResults = textFlow.find(text, caseSensitivity);
+        PDFFindResults pageResults = getTextLayout(pageIndex).find(text, caseSensitivity, flowFlags, pageIndex);
 
-            // Jakub Melka: Do not lock mutex, if we didn't find anything. In that case, just skip to next flow.
-            if (!flowResults.empty())
-            {
-                QMutexLocker lock(&resultsMutex);
-                results.insert(results.end(), flowResults.begin(), flowResults.end());
-            }
+        // Jakub Melka: Do not lock mutex, if we didn't find anything. In that case, just skip to next page.
+        if (!pageResults.empty())
+        {
+            QMutexLocker lock(&resultsMutex);
+            results.insert(results.end(), pageResults.begin(), pageResults.end());
         }
     };
 
@@ -1164,18 +1220,13 @@ PDFFindResults PDFTextLayoutStorage::find(const QRegularExpression& expression,
     QMutex resultsMutex;
     auto findImpl = [this, flowFlags, &results, &resultsMutex, &expression](size_t pageIndex)
     {
-        PDFTextLayout textLayout = getTextLayout(pageIndex);
-        PDFTextFlows textFlows = PDFTextFlow::createTextFlows(textLayout, flowFlags, pageIndex);
-        for (const PDFTextFlow& textFlow : textFlows)
-        {
-            PDFFindResults flowResults = textFlow.find(expression);
+        PDFFindResults pageResults = getTextLayout(pageIndex).find(expression, flowFlags, pageIndex);
 
-            // Jakub Melka: Do not lock mutex, if we didn't find anything. In that case, just skip to next flow.
-            if (!flowResults.empty())
-            {
-                QMutexLocker lock(&resultsMutex);
-                results.insert(results.end(), flowResults.begin(), flowResults.end());
-            }
+        // Jakub Melka: Do not lock mutex, if we didn't find anything. In that case, just skip to next page.
+        if (!pageResults.empty())
+        {
+            QMutexLocker lock(&resultsMutex);
+            results.insert(results.end(), pageResults.begin(), pageResults.end());
         }
     };
 
@@ -1672,29 +1723,100 @@ QPainterPath PDFTextSelectionPainter::prepareGeometry(PDFInteger pageIndex, PDFT
     return path;
 }
 
-PDFTextLayoutCache::PDFTextLayoutCache(std::function<PDFTextLayout (PDFInteger)> textLayoutGetter) :
+PDFTextLayoutCache::PDFTextLayoutCache(std::function<std::optional<PDFTextLayout>(PDFInteger)> textLayoutGetter, size_t capacity) :
     m_textLayoutGetter(qMove(textLayoutGetter)),
-    m_pageIndex(-1),
-    m_layout()
+    m_capacity(qMax(capacity, size_t(1)))
 {
 
 }
 
 void PDFTextLayoutCache::clear()
 {
-    m_pageIndex = -1;
-    m_layout = PDFTextLayout();
+    QMutexLocker lock(&m_mutex);
+    m_entries.clear();
+    m_pageToEntry.clear();
+}
+
+void PDFTextLayoutCache::setCapacity(size_t capacity)
+{
+    QMutexLocker lock(&m_mutex);
+    m_capacity = qMax(capacity, size_t(1));
+    shrink();
+}
+
+bool PDFTextLayoutCache::contains(PDFInteger pageIndex) const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_pageToEntry.count(pageIndex);
 }
 
-const PDFTextLayout& PDFTextLayoutCache::getTextLayout(PDFInteger pageIndex)
+void PDFTextLayoutCache::insert(PDFInteger pageIndex, PDFTextLayout layout)
 {
-    if (m_pageIndex != pageIndex)
+    TextLayoutPointer pointer = std::make_shared<const PDFTextLayout>(qMove(layout));
+
+    QMutexLocker lock(&m_mutex);
+    auto it = m_pageToEntry.find(pageIndex);
+    if (it != m_pageToEntry.cend())
     {
-        m_pageIndex = pageIndex;
-        m_layout = m_textLayoutGetter(pageIndex);
+        m_entries.erase(it->second);
+        m_pageToEntry.erase(it);
     }
 
-    return m_layout;
+    insertImpl(pageIndex, qMove(pointer));
+}
+
+PDFTextLayoutCache::TextLayoutPointer PDFTextLayoutCache::getTextLayout(PDFInteger pageIndex)
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        auto it = m_pageToEntry.find(pageIndex);
+        if (it != m_pageToEntry.cend())
+        {
+            // Mark text layout as most recently used
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return it->second->second;
+        }
+    }
+
+    // Create text layout without locked mutex, it can take
+    // a long time and other pages can be accessed meanwhile.
+    std::optional<PDFTextLayout> layout = m_textLayoutGetter(pageIndex);
+    if (!layout)
+    {
+        // Text layout can't be created now, do not cache anything
+        return std::make_shared<const PDFTextLayout>();
+    }
+
+    TextLayoutPointer pointer = std::make_shared<const PDFTextLayout>(qMove(*layout));
+
+    QMutexLocker lock(&m_mutex);
+    auto it = m_pageToEntry.find(pageIndex);
+    if (it != m_pageToEntry.cend())
+    {
+        // Someone else was faster
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->second;
+    }
+
+    return insertImpl(pageIndex, qMove(pointer));
+}
+
+PDFTextLayoutCache::TextLayoutPointer PDFTextLayoutCache::insertImpl(PDFInteger pageIndex, TextLayoutPointer layout)
+{
+    m_entries.emplace_front(pageIndex, qMove(layout));
+    m_pageToEntry[pageIndex] = m_entries.begin();
+    TextLayoutPointer result = m_entries.front().second;
+    shrink();
+    return result;
+}
+
+void PDFTextLayoutCache::shrink()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        m_pageToEntry.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
 }
 
 }   // namespace pdf
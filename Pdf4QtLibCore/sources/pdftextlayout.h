@@ -22,14 +22,17 @@
 #include "pdfutils.h"
 
 #include <QColor>
+#include <QMutex>
 #include <QDataStream>
 #include <QPainterPath>
 
 #include <set>
+#include <map>
+#include <list>
+#include <memory>
+#include <optional>
 #include <compare>
 
-class QMutex;
-
 namespace pdf
 {
 class PDFTextLayout;
@@ -44,6 +47,10 @@ struct PDFTextCharacterInfo
     /// Character path
     QPainterPath outline;
 
+    /// Transformation matrix from outline space to character space
+    /// (glyph outlines can be shared between font sizes in unit size)
+    QTransform outlineMatrix;
+
     /// Do we use a vertical writing system?
     bool isVerticalWritingSystem = false;
 
@@ -414,6 +421,23 @@ public:
     /// \param color Selection color
     PDFTextSelection selectLineInBlock(const size_t blockIndex, const size_t lineIndex, PDFInteger pageIndex, QColor color) const;
 
+    /// Creates text selection items for all text blocks of the page
+    /// \param pageIndex pageIndex
+    PDFTextSelectionItems selectAll(PDFInteger pageIndex) const;
+
+    /// Finds simple text in the page. All text occurences are returned.
+    /// \param text Text to be found
+    /// \param caseSensitivity Case sensitivity
+    /// \param flowFlags Text flow flags
+    /// \param pageIndex Page index
+    PDFFindResults find(const QString& text, Qt::CaseSensitivity caseSensitivity, PDFTextFlow::FlowFlags flowFlags, PDFInteger pageIndex) const;
+
+    /// Finds regular expression matches in the page. All text occurences are returned.
+    /// \param expression Regular expression to be matched
+    /// \param flowFlags Text flow flags
+    /// \param pageIndex Page index
+    PDFFindResults find(const QRegularExpression& expression, PDFTextFlow::FlowFlags flowFlags, PDFInteger pageIndex) const;
+
     friend QDataStream& operator<<(QDataStream& stream, const PDFTextLayout& layout);
     friend QDataStream& operator>>(QDataStream& stream, PDFTextLayout& layout);
 
@@ -437,25 +461,68 @@ private:
     PDFTextBlocks m_blocks;
 };
 
-/// Cache for storing single text layout
+/// Cache for storing recently used text layouts. Text layouts are created
+/// on demand using text layout getter function, and least recently used
+/// text layouts are evicted, when capacity of the cache is exceeded. Text layouts
+/// are shared, so evicted text layout remains valid for its current users.
+/// Cache is thread safe.
 class PDF4QTLIBCORESHARED_EXPORT PDFTextLayoutCache
 {
 public:
-    explicit PDFTextLayoutCache(std::function<PDFTextLayout(PDFInteger)> textLayoutGetter);
+    using TextLayoutPointer = std::shared_ptr<const PDFTextLayout>;
+
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+
+    /// Creates text layout cache. Text layout getter creates text layout of the page,
+    /// if text layout can't be created now (for example, compiler is not active), it
+    /// returns no layout, and nothing is cached.
+    /// \param textLayoutGetter Text layout getter
+    /// \param capacity Maximal number of cached text layouts
+    explicit PDFTextLayoutCache(std::function<std::optional<PDFTextLayout>(PDFInteger)> textLayoutGetter, size_t capacity = DEFAULT_CAPACITY);
 
     /// Clears the cache
     void clear();
 
-    /// Returns text layout. This function always succeeds. If compiler is not active,
-    /// then empty layout is returned.
-    /// \param compiler Text layout compiler
+    /// Sets maximal number of cached text layouts (at least one
+    /// text layout is always cached).
+    /// \param capacity Capacity
+    void setCapacity(size_t capacity);
+
+    /// Returns true, if text layout of the page is cached
+    /// \param pageIndex Page index
+    bool contains(PDFInteger pageIndex) const;
+
+    /// Inserts already created text layout into the cache
+    /// \param pageIndex Page index
+    /// \param layout Text layout
+    void insert(PDFInteger pageIndex, PDFTextLayout layout);
+
+    /// Returns text layout. This function always succeeds. If text layout
+    /// is not cached, it is created using text layout getter. If text layout
+    /// getter doesn't provide a layout, then empty layout is returned (and it
+    /// is not cached).
     /// \param pageIndex Page index
-    const PDFTextLayout& getTextLayout(PDFInteger pageIndex);
+    TextLayoutPointer getTextLayout(PDFInteger pageIndex);
 
 private:
-    std::function<PDFTextLayout(PDFInteger)> m_textLayoutGetter;
-    PDFInteger m_pageIndex;
-    PDFTextLayout m_layout;
+    using Entry = std::pair<PDFInteger, TextLayoutPointer>;
+    using Entries = std::list<Entry>;
+
+    /// Inserts text layout as most recently used one and evicts
+    /// text layouts over capacity. Mutex must be locked.
+    TextLayoutPointer insertImpl(PDFInteger pageIndex, TextLayoutPointer layout);
+
+    /// Removes least recently used text layouts over the capacity.
+    /// Mutex must be locked.
+    void shrink();
+
+    std::function<std::optional<PDFTextLayout>(PDFInteger)> m_textLayoutGetter;
+    size_t m_capacity;
+    mutable QMutex m_mutex;
+
+    /// Most recently used text layouts are at the front
+    Entries m_entries;
+    std::map<PDFInteger, Entries::iterator> m_pageToEntry;
 };
 
 class PDF4QTLIBCORESHARED_EXPORT PDFTextLayoutGetter
@@ -471,12 +538,18 @@ public:
     /// Cast operator, casts to constant reference to PDFTextLayout
     operator const PDFTextLayout&()
     {
-        return m_cache->getTextLayout(m_pageIndex);
+        if (!m_layout)
+        {
+            m_layout = m_cache->getTextLayout(m_pageIndex);
+        }
+
+        return *m_layout;
     }
 
 private:
     PDFTextLayoutCache* m_cache;
     PDFInteger m_pageIndex;
+    PDFTextLayoutCache::TextLayoutPointer m_layout;
 };
 
 /// Lazy getter for text layouts from storage. This is used, when we do not want to
@@ -3863,7 +3863,8 @@ PDFInkCoverageCalculator::PDFInkCoverageCalculator(const PDFDocument* document,
     m_optionalContentActivity(optionalContentActivity),
     m_inkMapper(inkMapper),
     m_progress(progress),
-    m_settings(settings)
+    m_settings(settings),
+    m_tileMemoryLimit(0)
 {
     Q_ASSERT(m_document);
     Q_ASSERT(m_fontCache);
@@ -3872,125 +3873,272 @@ PDFInkCoverageCalculator::PDFInkCoverageCalculator(const PDFDocument* document,
     Q_ASSERT(m_inkMapper);
 }
 
-void PDFInkCoverageCalculator::perform(QSize size, const std::vector<PDFInteger>& pages)
+QSize PDFInkCoverageCalculator::getImageSize(const PDFPage* page, QSize size)
 {
-    if (pages.empty())
+    QRectF pageRect = page->getRotatedMediaBox();
+    QSizeF pageSize = pageRect.size();
+    pageSize.scale(size.width(), size.height(), Qt::KeepAspectRatio);
+    return pageSize.toSize();
+}
+
+PDFInkCoverageCalculator::PageCoverage PDFInkCoverageCalculator::calculatePageCoverage(const PDFPage* page, QSize size, int firstRow, int lastRow) const
+{
+    PageCoverage result;
+
+    QSize imageSize = getImageSize(page, size);
+
+    if (!imageSize.isValid() || imageSize.isEmpty())
     {
-        // Nothing to do
-        return;
+        return result;
     }
 
-    if (m_progress)
+    firstRow = qMax(firstRow, 0);
+    lastRow = qMin(lastRow, imageSize.height());
+    if (firstRow >= lastRow)
     {
-        m_progress->start(pages.size(), ProgressStartupInfo());
+        return result;
     }
 
-    auto calculatePageCoverage = [this, size](PDFInteger pageIndex)
-    {
-        if (pageIndex >= PDFInteger(m_document->getCatalog()->getPageCount()))
-        {
-            return;
-        }
+    pdf::PDFTransparencyRendererSettings settings;
+    settings.flags.setFlag(PDFTransparencyRendererSettings::SaveOriginalProcessImage, true);
 
-        const PDFPage* page = m_document->getCatalog()->getPage(pageIndex);
-        if (!page)
-        {
-            return;
-        }
+    // Jakub Melka: debug is very slow, use multithreading
+#ifdef QT_DEBUG
+    settings.flags.setFlag(PDFTransparencyRendererSettings::MultithreadedPathSampler, true);
+#endif
 
-        QRectF pageRect = page->getRotatedMediaBox();
-        QSizeF pageSize = pageRect.size();
-        pageSize.scale(size.width(), size.height(), Qt::KeepAspectRatio);
-        QSize imageSize = pageSize.toSize();
+    settings.flags.setFlag(PDFTransparencyRendererSettings::ActiveColorMask, false);
+    settings.flags.setFlag(PDFTransparencyRendererSettings::SeparationSimulation, true);
+    settings.activeColorMask = PDFPixelFormat::getAllColorsMask();
 
-        if (!imageSize.isValid())
-        {
-            return;
-        }
+    // Determine tile height. Renderer holds several bitmaps of the tile size
+    // (backdrops, soft mask, original process image), each of them having
+    // process colors, spot colors, shape and opacity channels.
+    int tileHeight = imageSize.height();
+    if (m_tileMemoryLimit > 0)
+    {
+        const size_t channelCount = 4 + m_inkMapper->getActiveSpotColorCount() + 2;
+        const size_t bytesPerRow = size_t(imageSize.width()) * channelCount * sizeof(PDFColorComponent) * 4;
+        tileHeight = qBound(1, int(m_tileMemoryLimit / qMax(bytesPerRow, size_t(1))), imageSize.height());
+    }
 
-        pdf::PDFTransparencyRendererSettings settings;
-        settings.flags.setFlag(PDFTransparencyRendererSettings::SaveOriginalProcessImage, true);
+    QTransform pagePointToDevicePoint = pdf::PDFRenderer::createPagePointToDevicePointMatrix(page, QRect(QPoint(0, 0), imageSize));
+    pdf::PDFCMSPointer cms = m_cmsManager->getCurrentCMS();
 
-        // Jakub Melka: debug is very slow, use multithreading
-#ifdef QT_DEBUG
-        settings.flags.setFlag(PDFTransparencyRendererSettings::MultithreadedPathSampler, true);
-#endif
+    std::vector<PDFColorComponent> pageCoverage;
+    uint8_t colorChannelCount = 0;
+    result.rowMaximalTotalAreaCoverage.resize(imageSize.height(), 0.0f);
 
-        settings.flags.setFlag(PDFTransparencyRendererSettings::ActiveColorMask, false);
-        settings.flags.setFlag(PDFTransparencyRendererSettings::SeparationSimulation, true);
-        settings.activeColorMask = PDFPixelFormat::getAllColorsMask();
+    for (int tileTop = firstRow; tileTop < lastRow; tileTop += tileHeight)
+    {
+        const int currentTileHeight = qMin(tileHeight, lastRow - tileTop);
+        QTransform tileTransform = pagePointToDevicePoint * QTransform::fromTranslate(0, -tileTop);
 
-        QTransform pagePointToDevicePoint = pdf::PDFRenderer::createPagePointToDevicePointMatrix(page, QRect(QPoint(0, 0), imageSize));
-        pdf::PDFCMSPointer cms = m_cmsManager->getCurrentCMS();
         pdf::PDFTransparencyRenderer renderer(page, m_document, m_fontCache, cms.data(), m_optionalContentActivity,
-                                              m_inkMapper, settings, pagePointToDevicePoint);
+                                              m_inkMapper, settings, tileTransform);
 
-        renderer.beginPaint(imageSize);
+        renderer.beginPaint(QSize(imageSize.width(), currentTileHeight));
         renderer.processContents();
         renderer.endPaint();
 
         PDFFloatBitmapWithColorSpace originalProcessImage = renderer.getOriginalProcessBitmap();
-        QSizeF pageSizeMM = page->getRotatedMediaBoxMM().size();
-
         pdf::PDFPixelFormat pixelFormat = originalProcessImage.getPixelFormat();
-        pdf::PDFColorComponent totalArea = pageSizeMM.width() * pageSizeMM.height();
-        pdf::PDFColorComponent pixelArea = totalArea / pdf::PDFColorComponent(originalProcessImage.getWidth() * originalProcessImage.getHeight());
 
-        std::vector<PDFColorComponent> pageCoverage;
-        const uint8_t colorChannelCount = pixelFormat.getColorChannelCount();
-        pageCoverage.resize(colorChannelCount, 0.0f);
+        if (pageCoverage.empty())
+        {
+            colorChannelCount = pixelFormat.getColorChannelCount();
+            result.processColorChannelCount = pixelFormat.getProcessColorChannelCount();
+            pageCoverage.resize(colorChannelCount, 0.0f);
+        }
+
+        Q_ASSERT(colorChannelCount == pixelFormat.getColorChannelCount());
 
         for (size_t y = 0; y < originalProcessImage.getHeight(); ++y)
         {
+            PDFColorComponent& rowMaximalTotalAreaCoverage = result.rowMaximalTotalAreaCoverage[tileTop + y];
+
             for (size_t x = 0; x < originalProcessImage.getWidth(); ++x)
             {
                 const pdf::PDFColorBuffer buffer = originalProcessImage.getPixel(x, y);
                 const pdf::PDFColorComponent alpha = pixelFormat.hasOpacityChannel() ? buffer[pixelFormat.getOpacityChannelIndex()] : 1.0f;
 
+                pdf::PDFColorComponent totalAreaCoverage = 0.0f;
                 for (uint8_t i = 0; i < colorChannelCount; ++i)
                 {
-                    pageCoverage[i] += buffer[i] * alpha;
+                    const pdf::PDFColorComponent value = buffer[i] * alpha;
+                    pageCoverage[i] += value;
+                    totalAreaCoverage += value;
                 }
+
+                rowMaximalTotalAreaCoverage = qMax(rowMaximalTotalAreaCoverage, totalAreaCoverage);
             }
+
+            result.maximalTotalAreaCoverage = qMax(result.maximalTotalAreaCoverage, rowMaximalTotalAreaCoverage);
         }
+    }
+
+    QSizeF pageSizeMM = page->getRotatedMediaBoxMM().size();
+    pdf::PDFColorComponent totalArea = pageSizeMM.width() * pageSizeMM.height();
+    pdf::PDFColorComponent pixelArea = totalArea / (pdf::PDFColorComponent(imageSize.width()) * pdf::PDFColorComponent(imageSize.height()));
+
+    result.ratioCoverage = pageCoverage;
+    for (uint8_t i = 0; i < colorChannelCount; ++i)
+    {
+        pageCoverage[i] *= pixelArea;
+        result.ratioCoverage[i] *= pixelArea / totalArea;
+    }
+
+    result.coverage = qMove(pageCoverage);
+    result.isValid = true;
+    return result;
+}
+
+bool PDFInkCoverageCalculator::calculatePage(PDFInteger pageIndex,
+                                             QSize size,
+                                             std::vector<InkCoverageChannelInfo>& results,
+                                             PageCoverageInfo& coverageInfo) const
+{
+    if (pageIndex < 0 || pageIndex >= PDFInteger(m_document->getCatalog()->getPageCount()))
+    {
+        return false;
+    }
 
-        std::vector<PDFColorComponent> pageRatioCoverage = pageCoverage;
-        for (uint8_t i = 0; i < colorChannelCount; ++i)
+    const PDFPage* page = m_document->getCatalog()->getPage(pageIndex);
+    if (!page)
+    {
+        return false;
+    }
+
+    PageCoverage coverage;
+
+    if (m_coarseToFineSettings.enabled && m_coarseToFineSettings.previewSize.isValid())
+    {
+        // Pixels of the preview are averages of the pixels in full resolution, so
+        // maximal total area coverage of the preview can't be greater than in full
+        // resolution. If the preview exceeds the limit, the page exceeds it too.
+        // Otherwise, small areas exceeding the limit can be averaged out in the
+        // preview, so bands close to the limit are rendered in full resolution.
+        const QSize previewSize = m_coarseToFineSettings.previewSize.boundedTo(size);
+        const QSize imageSize = getImageSize(page, size);
+        const QSize previewImageSize = getImageSize(page, previewSize);
+        if (previewImageSize != imageSize)
         {
-            pageCoverage[i] *= pixelArea;
-            pageRatioCoverage[i] *= pixelArea / totalArea;
+            coverage = calculatePageCoverage(page, previewSize, 0, previewImageSize.height());
+            coverageInfo.isPreview = coverage.isValid;
         }
 
-        std::vector<PDFInkMapper::ColorInfo> separations = m_inkMapper->getSeparations(pixelFormat.getProcessColorChannelCount());
-        Q_ASSERT(pixelFormat.getColorChannelCount() == separations.size());
+        if (coverage.isValid && coverage.maximalTotalAreaCoverage <= m_coarseToFineSettings.totalAreaCoverageLimit)
+        {
+            const PDFColorComponent refineThreshold = m_coarseToFineSettings.totalAreaCoverageLimit - m_coarseToFineSettings.totalAreaCoverageMargin;
+            const int previewHeight = previewImageSize.height();
+            const int height = imageSize.height();
+
+            int previewRow = 0;
+            while (previewRow < previewHeight)
+            {
+                if (coverage.rowMaximalTotalAreaCoverage[previewRow] < refineThreshold)
+                {
+                    ++previewRow;
+                    continue;
+                }
 
-        std::vector<InkCoverageChannelInfo> results;
-        results.reserve(separations.size());
+                // Consecutive preview rows close to the limit are rendered as single band
+                int previewEndRow = previewRow + 1;
+                while (previewEndRow < previewHeight && coverage.rowMaximalTotalAreaCoverage[previewEndRow] >= refineThreshold)
+                {
+                    ++previewEndRow;
+                }
 
-        for (size_t i = 0; i < separations.size(); ++i)
-        {
-            const PDFInkMapper::ColorInfo& colorInfo = separations[i];
+                const int firstRow = int(std::floor(PDFReal(previewRow) * height / previewHeight));
+                const int lastRow = qMin(int(std::ceil(PDFReal(previewEndRow) * height / previewHeight)), height);
+                PageCoverage band = calculatePageCoverage(page, size, firstRow, lastRow);
+                if (band.isValid)
+                {
+                    coverage.maximalTotalAreaCoverage = qMax(coverage.maximalTotalAreaCoverage, band.maximalTotalAreaCoverage);
+                    coverageInfo.fullResolutionRowCount += lastRow - firstRow;
+                }
 
-            InkCoverageChannelInfo info;
-            info.color = colorInfo.color;
-            info.name = colorInfo.name;
-            info.textName = colorInfo.textName;
-            info.isSpot = colorInfo.isSpot;
-            info.coveredArea = pageCoverage[i];
-            info.ratio = pageRatioCoverage[i];
-            results.emplace_back(qMove(info));
+                previewRow = previewEndRow;
+            }
         }
+    }
+
+    if (!coverage.isValid)
+    {
+        coverage = calculatePageCoverage(page, size, 0, std::numeric_limits<int>::max());
+        coverageInfo.isPreview = false;
+        coverageInfo.fullResolutionRowCount = coverage.isValid ? getImageSize(page, size).height() : 0;
+    }
+
+    if (!coverage.isValid)
+    {
+        return false;
+    }
+
+    coverageInfo.maximalTotalAreaCoverage = coverage.maximalTotalAreaCoverage;
+
+    std::vector<PDFInkMapper::ColorInfo> separations = m_inkMapper->getSeparations(coverage.processColorChannelCount);
+    Q_ASSERT(coverage.coverage.size() == separations.size());
+
+    results.reserve(separations.size());
+
+    for (size_t i = 0; i < separations.size(); ++i)
+    {
+        const PDFInkMapper::ColorInfo& colorInfo = separations[i];
+
+        InkCoverageChannelInfo info;
+        info.color = colorInfo.color;
+        info.name = colorInfo.name;
+        info.textName = colorInfo.textName;
+        info.isSpot = colorInfo.isSpot;
+        info.coveredArea = coverage.coverage[i];
+        info.ratio = coverage.ratioCoverage[i];
+        results.emplace_back(qMove(info));
+    }
+
+    return true;
+}
+
+void PDFInkCoverageCalculator::perform(QSize size, const std::vector<PDFInteger>& pages)
+{
+    if (pages.empty())
+    {
+        // Nothing to do
+        return;
+    }
+
+    if (m_progress)
+    {
+        m_progress->start(pages.size(), ProgressStartupInfo());
+    }
+
+    auto processPage = [this, size](PDFInteger pageIndex)
+    {
+        std::vector<InkCoverageChannelInfo> results;
+        PageCoverageInfo coverageInfo;
+        const bool isValid = calculatePage(pageIndex, size, results, coverageInfo);
 
         if (m_progress)
         {
             m_progress->step();
         }
 
+        // Callback is always called, so the caller can rely on
+        // that it is notified about each page.
         QMutexLocker lock(&m_mutex);
-        m_inkCoverageResults[pageIndex] = qMove(results);
+        if (m_pageCoverageCallback)
+        {
+            m_pageCoverageCallback(pageIndex, results, coverageInfo);
+        }
+
+        if (isValid)
+        {
+            m_inkCoverageResults[pageIndex] = qMove(results);
+            m_pageCoverageInfos[pageIndex] = coverageInfo;
+        }
     };
 
-    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, pages.begin(), pages.end(), calculatePageCoverage);
+    PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, pages.begin(), pages.end(), processPage);
 
     if (m_progress)
     {
@@ -4002,6 +4150,7 @@ void PDFInkCoverageCalculator::clear()
 {
     QMutexLocker lock(&m_mutex);
     m_inkCoverageResults.clear();
+    m_pageCoverageInfos.clear();
 }
 
 const std::vector<PDFInkCoverageCalculator::InkCoverageChannelInfo>* PDFInkCoverageCalculator::getInkCoverage(PDFInteger pageIndex) const
@@ -4028,6 +4177,17 @@ const PDFInkCoverageCalculator::InkCoverageChannelInfo* PDFInkCoverageCalculator
     return nullptr;
 }
 
+PDFInkCoverageCalculator::PageCoverageInfo PDFInkCoverageCalculator::getPageCoverageInfo(PDFInteger pageIndex) const
+{
+    auto it = m_pageCoverageInfos.find(pageIndex);
+    if (it != m_pageCoverageInfos.end())
+    {
+        return it->second;
+    }
+
+    return PageCoverageInfo();
+}
+
 PDFInkCoverageCalculator::InkCoverageChannelInfo* PDFInkCoverageCalculator::findCoverageInfoByName(std::vector<PDFInkCoverageCalculator::InkCoverageChannelInfo>& infos, const QByteArray& name)
 {
     auto it = std::find_if(infos.begin(), infos.end(), [&name](const auto& info) { return info.name == name; });
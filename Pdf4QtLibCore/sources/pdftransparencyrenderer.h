@@ -27,6 +27,8 @@
 
 #include <QImage>
 
+#include <functional>
+
 namespace pdf
 {
 
@@ -948,6 +950,46 @@ public:
         PDFColorComponent ratio = 0.0f;
     };
 
+    /// Summary of the page coverage, which is not bound to a particular
+    /// colorant (maximal total area coverage and accuracy of the result).
+    struct PageCoverageInfo
+    {
+        /// Maximal total area coverage (sum of all colorants) of a single pixel, 1.0 is 100 %
+        PDFColorComponent maximalTotalAreaCoverage = 0.0f;
+
+        /// Result was calculated from the reduced resolution preview. Coverage values
+        /// are then only approximate, and maximal total area coverage is a lower bound.
+        bool isPreview = false;
+
+        /// Number of pixel rows of the page rendered in full resolution. In coarse-to-fine
+        /// mode, only bands close to the total area coverage limit are rendered.
+        int fullResolutionRowCount = 0;
+    };
+
+    /// Settings of the coarse-to-fine mode. In this mode, page is first rendered
+    /// in reduced resolution. Preview pixels are averages of full resolution pixels,
+    /// so maximal total area coverage of the preview is never greater than in full
+    /// resolution. If it already exceeds the limit, the page is reported as exceeding
+    /// the limit from the preview. Otherwise, only bands of the page, whose maximal
+    /// total area coverage in the preview is within the margin below the limit, are
+    /// rendered in full resolution, to refine maximal total area coverage. Other bands
+    /// are decided from the preview, so tiny areas exceeding the limit can be missed,
+    /// if they are averaged out below the margin. Coverage values are always taken
+    /// from the preview.
+    struct CoarseToFineSettings
+    {
+        bool enabled = false;
+        QSize previewSize = QSize(256, 256);
+        PDFColorComponent totalAreaCoverageLimit = 3.0f;
+        PDFColorComponent totalAreaCoverageMargin = 0.5f;
+    };
+
+    /// Callback, which is called when coverage of a page is calculated. Callback
+    /// can be called from multiple threads, but calls are serialized. Callback
+    /// is called for each page, if coverage of the page can't be calculated
+    /// (for example, page is invalid), then coverage is empty.
+    using PageCoverageCallback = std::function<void(PDFInteger, const std::vector<InkCoverageChannelInfo>&, const PageCoverageInfo&)>;
+
     /// Perform ink coverage calculations on given pages. Results are stored
     /// in this object. Page images are rendered using \p size resolution,
     /// and in this resolution, ink coverage is calculated.
@@ -958,6 +1000,16 @@ public:
     /// Clear all calculated ink coverage results
     void clear();
 
+    /// Sets coarse-to-fine mode settings
+    void setCoarseToFineSettings(const CoarseToFineSettings& settings) { m_coarseToFineSettings = settings; }
+
+    /// Sets memory limit (in bytes) of the rendered bitmap. If page bitmap
+    /// exceeds the limit, page is rendered in horizontal tiles. Zero means no limit.
+    void setTileMemoryLimit(size_t tileMemoryLimit) { m_tileMemoryLimit = tileMemoryLimit; }
+
+    /// Sets callback, which is called, when page coverage is calculated
+    void setPageCoverageCallback(PageCoverageCallback callback) { m_pageCoverageCallback = qMove(callback); }
+
     /// Clears calculated ink coverage for all pages. If ink coverage is not
     /// calculated for given page index, empty vector is returned.
     /// \param pageIndex Page index
@@ -977,7 +1029,46 @@ public:
     /// \returns Info for a given colorant name, or nullptr, if it is not found
     static InkCoverageChannelInfo* findCoverageInfoByName(std::vector<InkCoverageChannelInfo>& infos, const QByteArray& name);
 
+    /// Returns coverage summary for a given page. If ink coverage is not
+    /// calculated for given page index, default info is returned.
+    /// \param pageIndex Page index
+    PageCoverageInfo getPageCoverageInfo(PDFInteger pageIndex) const;
+
 private:
+    struct PageCoverage
+    {
+        std::vector<PDFColorComponent> coverage;
+        std::vector<PDFColorComponent> ratioCoverage;
+        std::vector<PDFColorComponent> rowMaximalTotalAreaCoverage;
+        PDFColorComponent maximalTotalAreaCoverage = 0.0f;
+        uint32_t processColorChannelCount = 0;
+        bool isValid = false;
+    };
+
+    /// Returns size of the page image in given resolution
+    static QSize getImageSize(const PDFPage* page, QSize size);
+
+    /// Calculates ink coverage of the page in given resolution. Only rows of the
+    /// page image in range [firstRow, lastRow) are rendered, coverage values are then
+    /// calculated only from this range. If bitmap exceeds the memory limit, rows
+    /// are rendered in horizontal tiles.
+    /// \param page Page
+    /// \param size Resolution size
+    /// \param firstRow First rendered row
+    /// \param lastRow Row after the last rendered row
+    PageCoverage calculatePageCoverage(const PDFPage* page, QSize size, int firstRow, int lastRow) const;
+
+    /// Calculates ink coverage of the page (in coarse-to-fine mode, if it
+    /// is enabled). Returns false, if coverage can't be calculated.
+    /// \param pageIndex Page index
+    /// \param size Resolution size
+    /// \param results Ink coverage of the channels
+    /// \param coverageInfo Coverage summary of the page
+    bool calculatePage(PDFInteger pageIndex,
+                       QSize size,
+                       std::vector<InkCoverageChannelInfo>& results,
+                       PageCoverageInfo& coverageInfo) const;
+
     const PDFDocument* m_document;
     const PDFFontCache* m_fontCache;
     const PDFCMSManager* m_cmsManager;
@@ -985,9 +1076,13 @@ private:
     const PDFInkMapper* m_inkMapper;
     PDFProgress* m_progress;
     PDFTransparencyRendererSettings m_settings;
+    CoarseToFineSettings m_coarseToFineSettings;
+    size_t m_tileMemoryLimit;
+    PageCoverageCallback m_pageCoverageCallback;
 
     QMutex m_mutex;
     std::map<pdf::PDFInteger, std::vector<InkCoverageChannelInfo>> m_inkCoverageResults;
+    std::map<pdf::PDFInteger, PageCoverageInfo> m_pageCoverageInfos;
 };
 
 }   // namespace pdf
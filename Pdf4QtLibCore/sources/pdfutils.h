@@ -26,6 +26,7 @@
 #include <QDataStream>
 
 #include <set>
+#include <memory>
 #include <vector>
 #include <iterator>
 #include <functional>
@@ -574,6 +575,232 @@ private:
     value_ptr m_end;
 };
 
+/// Vector with structural sharing. Items are stored in chunks of fixed size, and chunks
+/// are shared between copies of the vector. Copy of the vector is cheap (only chunk
+/// pointers are copied), and modification of an item copies only the chunk containing
+/// the item (copy-on-write). Constant functions are thread safe. Modifying functions
+/// are not thread safe, with one exception - different items can be modified from
+/// multiple threads using operator[] or iterators, if vector is detached (call \p detach
+/// before such access, non-constant \p begin does it automatically). Iterator obtained from
+/// non-constant \p begin is invalidated, when vector is copied.
+template<typename T, size_t ChunkSizeLog2 = 10>
+class PDFCopyOnWriteVector
+{
+public:
+    static constexpr size_t CHUNK_SIZE = size_t(1) << ChunkSizeLog2;
+    static constexpr size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+    using value_type = T;
+    using size_type = size_t;
+
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using Container = std::conditional_t<IsConst, const PDFCopyOnWriteVector, PDFCopyOnWriteVector>;
+
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = std::conditional_t<IsConst, const T*, T*>;
+        using reference         = std::conditional_t<IsConst, const T&, T&>;
+
+        inline IteratorBase() = default;
+        inline IteratorBase(Container* container, size_t index) : m_container(container), m_index(index) { }
+
+        inline bool operator==(const IteratorBase& other) const { return m_index == other.m_index; }
+        inline bool operator!=(const IteratorBase& other) const { return m_index != other.m_index; }
+        inline bool operator<(const IteratorBase& other) const { return m_index < other.m_index; }
+        inline bool operator>(const IteratorBase& other) const { return m_index > other.m_index; }
+        inline bool operator<=(const IteratorBase& other) const { return m_index <= other.m_index; }
+        inline bool operator>=(const IteratorBase& other) const { return m_index >= other.m_index; }
+
+        inline reference operator*() const { return m_container->getItem(m_index); }
+        inline pointer operator->() const { return &m_container->getItem(m_index); }
+        inline reference operator[](ptrdiff_t movement) const { return m_container->getItem(m_index + movement); }
+
+        inline IteratorBase& operator+=(ptrdiff_t movement) { m_index += movement; return *this; }
+        inline IteratorBase& operator-=(ptrdiff_t movement) { m_index -= movement; return *this; }
+        inline IteratorBase operator+(ptrdiff_t movement) const { return IteratorBase(m_container, m_index + movement); }
+        inline IteratorBase operator-(ptrdiff_t movement) const { return IteratorBase(m_container, m_index - movement); }
+        inline ptrdiff_t operator-(const IteratorBase& other) const { return ptrdiff_t(m_index) - ptrdiff_t(other.m_index); }
+        friend inline IteratorBase operator+(ptrdiff_t movement, const IteratorBase& iterator) { return iterator + movement; }
+
+        inline IteratorBase& operator++() { ++m_index; return *this; }
+        inline IteratorBase operator++(int) { IteratorBase copy(*this); ++m_index; return copy; }
+        inline IteratorBase& operator--() { --m_index; return *this; }
+        inline IteratorBase operator--(int) { IteratorBase copy(*this); --m_index; return copy; }
+
+    private:
+        Container* m_container = nullptr;
+        size_t m_index = 0;
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    inline PDFCopyOnWriteVector() = default;
+
+    bool operator==(const PDFCopyOnWriteVector& other) const
+    {
+        if (m_size != other.m_size)
+        {
+            return false;
+        }
+
+        for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+        {
+            // Shared chunks are always equal
+            if (m_chunks[chunkIndex] != other.m_chunks[chunkIndex] && !(*m_chunks[chunkIndex] == *other.m_chunks[chunkIndex]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool operator!=(const PDFCopyOnWriteVector& other) const { return !(*this == other); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    const T& operator[](size_t index) const { Q_ASSERT(index < m_size); return getItem(index); }
+    T& operator[](size_t index) { Q_ASSERT(index < m_size); return detachChunk(index >> ChunkSizeLog2)[index & CHUNK_MASK]; }
+
+    const T& back() const { return (*this)[m_size - 1]; }
+    T& back() { return (*this)[m_size - 1]; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_size); }
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    const_iterator cend() const { return const_iterator(this, m_size); }
+
+    iterator begin() { detach(); return iterator(this, 0); }
+    iterator end() { return iterator(this, m_size); }
+
+    void reserve(size_t size) { m_chunks.reserve((size + CHUNK_MASK) >> ChunkSizeLog2); }
+
+    void clear()
+    {
+        m_chunks.clear();
+        m_size = 0;
+    }
+
+    void resize(size_t size)
+    {
+        if (size < m_size)
+        {
+            m_chunks.resize((size + CHUNK_MASK) >> ChunkSizeLog2);
+            if (!m_chunks.empty())
+            {
+                detachChunk(m_chunks.size() - 1).resize(size - ((m_chunks.size() - 1) << ChunkSizeLog2));
+            }
+        }
+        else if (size > m_size)
+        {
+            if (!m_chunks.empty())
+            {
+                detachChunk(m_chunks.size() - 1).resize(qMin(CHUNK_SIZE, size - ((m_chunks.size() - 1) << ChunkSizeLog2)));
+            }
+
+            while ((m_chunks.size() << ChunkSizeLog2) < size)
+            {
+                m_chunks.push_back(std::make_shared<Chunk>(qMin(CHUNK_SIZE, size - (m_chunks.size() << ChunkSizeLog2))));
+            }
+        }
+
+        m_size = size;
+    }
+
+    template<typename... Arguments>
+    T& emplace_back(Arguments&&... arguments)
+    {
+        if ((m_size & CHUNK_MASK) == 0)
+        {
+            m_chunks.push_back(std::make_shared<Chunk>());
+            m_chunks.back()->reserve(CHUNK_SIZE);
+        }
+
+        ++m_size;
+        return detachChunk(m_chunks.size() - 1).emplace_back(std::forward<Arguments>(arguments)...);
+    }
+
+    void push_back(T value) { emplace_back(std::move(value)); }
+
+    /// Makes all chunks unique for this vector (no chunk is shared)
+    void detach()
+    {
+        for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+        {
+            detachChunk(chunkIndex);
+        }
+    }
+
+    /// Returns sorted indices of items, which are different in this vector and \p other
+    /// vector. Items present only in one of the vectors are also considered different.
+    /// Shared chunks are skipped, so if one vector was created by modification of
+    /// the other, complexity is proportional to the number of modified chunks.
+    /// \param other Other vector
+    std::vector<size_t> getDifferentIndices(const PDFCopyOnWriteVector& other) const
+    {
+        std::vector<size_t> result;
+
+        const size_t commonSize = qMin(m_size, other.m_size);
+        const size_t commonChunks = (commonSize + CHUNK_MASK) >> ChunkSizeLog2;
+        for (size_t chunkIndex = 0; chunkIndex < commonChunks; ++chunkIndex)
+        {
+            if (m_chunks[chunkIndex] == other.m_chunks[chunkIndex])
+            {
+                continue;
+            }
+
+            const size_t first = chunkIndex << ChunkSizeLog2;
+            const size_t last = qMin(first + CHUNK_SIZE, commonSize);
+            for (size_t i = first; i < last; ++i)
+            {
+                if (!(getItem(i) == other.getItem(i)))
+                {
+                    result.push_back(i);
+                }
+            }
+        }
+
+        for (size_t i = commonSize; i < qMax(m_size, other.m_size); ++i)
+        {
+            result.push_back(i);
+        }
+
+        return result;
+    }
+
+private:
+    using Chunk = std::vector<T>;
+    using ChunkPointer = std::shared_ptr<Chunk>;
+
+    const T& getItem(size_t index) const { return (*m_chunks[index >> ChunkSizeLog2])[index & CHUNK_MASK]; }
+
+    /// Access to the item without detaching, used by iterators
+    T& getItem(size_t index) { return (*m_chunks[index >> ChunkSizeLog2])[index & CHUNK_MASK]; }
+
+    Chunk& detachChunk(size_t chunkIndex)
+    {
+        ChunkPointer& chunk = m_chunks[chunkIndex];
+        if (chunk.use_count() > 1)
+        {
+            ChunkPointer copy = std::make_shared<Chunk>();
+            copy->reserve(chunkIndex + 1 == m_chunks.size() ? CHUNK_SIZE : chunk->size());
+            copy->insert(copy->end(), chunk->cbegin(), chunk->cend());
+            chunk = std::move(copy);
+        }
+
+        return *chunk;
+    }
+
+    std::vector<ChunkPointer> m_chunks;
+    size_t m_size = 0;
+};
+
 /// Storage for result of some operation. Stores, if operation was successful, or not and
 /// also error message, why operation has failed. Can be converted explicitly to bool.
 class PDFOperationResult
@@ -40,7 +40,8 @@ PDFAdvancedFindWidget::PDFAdvancedFindWidget(pdf::PDFDrawWidgetProxy* proxy, QWi
     ui->resultsTableWidget->setHorizontalHeaderLabels({ tr("Page No."), tr("Phrase"), tr("Context") });
 
     connect(ui->regularExpressionsCheckbox, &QCheckBox::clicked, this, &PDFAdvancedFindWidget::updateUI);
-    connect(m_proxy, &pdf::PDFDrawWidgetProxy::textLayoutChanged, this, &PDFAdvancedFindWidget::performSearch);
+    connect(m_proxy->getTextLayoutCompiler(), &pdf::PDFAsynchronousTextLayoutCompiler::textLayoutPageCreated, this, &PDFAdvancedFindWidget::onTextLayoutPageCreated);
+    connect(m_proxy, &pdf::PDFDrawWidgetProxy::textLayoutChanged, this, &PDFAdvancedFindWidget::onTextLayoutChanged);
     connect(ui->resultsTableWidget, &QTableWidget::cellDoubleClicked, this, &PDFAdvancedFindWidget::onResultItemDoubleClicked);
     connect(ui->resultsTableWidget, &QTableWidget::itemSelectionChanged, this, &PDFAdvancedFindWidget::onSelectionChanged);
     updateUI();
@@ -61,6 +62,7 @@ void PDFAdvancedFindWidget::setDocument(const pdf::PDFModifiedDocument& document
         // so, there is no need to clear the results.
         if (document.hasReset() || document.hasPageContentsChanged())
         {
+            m_searchedPages.clear();
             m_findResults.clear();
             updateUI();
             updateResultsUI();
@@ -124,24 +126,19 @@ void PDFAdvancedFindWidget::on_searchButton_clicked()
         }
     }
 
+    m_searchedPages.clear();
     m_findResults.clear();
     m_textSelection.dirty();
     updateResultsUI();
 
-    pdf::PDFAsynchronousTextLayoutCompiler* compiler = m_proxy->getTextLayoutCompiler();
-    if (compiler->isTextLayoutReady())
-    {
-        performSearch();
-    }
-    else
-    {
-        compiler->makeTextLayout();
-    }
+    // Text layouts of the pages are searched as they are created
+    m_proxy->getTextLayoutCompiler()->makeTextLayout();
 }
 
 void PDFAdvancedFindWidget::on_clearButton_clicked()
 {
     m_parameters = SearchParameters();
+    m_searchedPages.clear();
     m_findResults.clear();
     updateResultsUI();
 }
@@ -206,19 +203,16 @@ void PDFAdvancedFindWidget::drawPage(QPainter* painter,
     textSelectionPainter.draw(painter, pageIndex, layoutGetter, pagePointToDevicePointMatrix);
 }
 
-void PDFAdvancedFindWidget::performSearch()
+void PDFAdvancedFindWidget::onTextLayoutPageCreated(pdf::PDFInteger pageIndex, const pdf::PDFTextLayout& textLayout)
 {
     if (m_parameters.isSearchFinished || m_parameters.phrase.isEmpty())
     {
         return;
     }
 
-    m_parameters.isSearchFinished = true;
-
-    pdf::PDFAsynchronousTextLayoutCompiler* compiler = m_proxy->getTextLayoutCompiler();
-    if (!compiler->isTextLayoutReady())
+    if (!m_searchedPages.insert(pageIndex).second)
     {
-        // Text layout is not ready yet
+        // Page was already searched
         return;
     }
 
@@ -249,12 +243,12 @@ void PDFAdvancedFindWidget::performSearch()
         flowFlags |= pdf::PDFTextFlow::AddLineBreaks;
     }
 
-    const pdf::PDFTextLayoutStorage* textLayoutStorage = compiler->getTextLayoutStorage();
+    pdf::PDFFindResults pageFindResults;
     if (!useRegularExpression)
     {
         // Use simple text search
         Qt::CaseSensitivity caseSensitivity = m_parameters.isCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
-        m_findResults = textLayoutStorage->find(expression, caseSensitivity, flowFlags);
+        pageFindResults = textLayout.find(expression, caseSensitivity, flowFlags, pageIndex);
     }
     else
     {
@@ -274,15 +268,31 @@ void PDFAdvancedFindWidget::performSearch()
         }
 
         QRegularExpression regularExpression(expression, patternOptions);
-        m_findResults = textLayoutStorage->find(regularExpression, flowFlags);
+        pageFindResults = textLayout.find(regularExpression, flowFlags, pageIndex);
+    }
+
+    if (pageFindResults.empty())
+    {
+        return;
     }
 
+    // Keep results sorted, pages are not created in order
+    std::sort(pageFindResults.begin(), pageFindResults.end());
+    auto it = std::upper_bound(m_findResults.begin(), m_findResults.end(), pageFindResults.front());
+    m_findResults.insert(it, std::make_move_iterator(pageFindResults.begin()), std::make_move_iterator(pageFindResults.end()));
+
     m_textSelection.dirty();
     m_proxy->repaintNeeded();
 
     updateResultsUI();
 }
 
+void PDFAdvancedFindWidget::onTextLayoutChanged()
+{
+    // All pages were searched
+    m_parameters.isSearchFinished = true;
+}
+
 pdf::PDFTextSelection PDFAdvancedFindWidget::getTextSelectionImpl() const
 {
     pdf::PDFTextSelection result;
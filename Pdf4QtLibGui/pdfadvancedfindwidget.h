@@ -76,7 +76,8 @@ private slots:
 private:
     void updateUI();
     void updateResultsUI();
-    void performSearch();
+    void onTextLayoutPageCreated(pdf::PDFInteger pageIndex, const pdf::PDFTextLayout& textLayout);
+    void onTextLayoutChanged();
 
     pdf::PDFTextSelection getTextSelection() const { return m_textSelection.get(this, &PDFAdvancedFindWidget::getTextSelectionImpl); }
     pdf::PDFTextSelection getTextSelectionImpl() const;
@@ -98,6 +99,7 @@ private:
     pdf::PDFDrawWidgetProxy* m_proxy;
     const pdf::PDFDocument* m_document;
     SearchParameters m_parameters;
+    std::set<pdf::PDFInteger> m_searchedPages;
     pdf::PDFFindResults m_findResults;
     mutable pdf::PDFCachedItem<pdf::PDFTextSelection> m_textSelection;
 };
@@ -1739,8 +1739,8 @@ void PDFProgramController::onFileChanged(const QString& fileName)
         QByteArray data = file.readAll();
         file.close();
 
-        QByteArray hash = pdf::PDFDocumentReader::hash(data);
-        if (m_pdfDocument && m_pdfDocument->getSourceDataHash() != hash)
+        const pdf::PDFDocumentIdentity identity = pdf::PDFDocumentIdentity::createFromHash(pdf::PDFDocumentReader::hash(data));
+        if (m_pdfDocument && m_pdfDocument->getIdentity() != identity)
         {
             auto queryPassword = [this](bool* ok)
             {
@@ -1936,6 +1936,11 @@ void PDFProgramController::onDocumentModified(pdf::PDFModifiedDocument document)
     pdf::PDFBoolGuard guard(m_isDocumentSetInProgress);
     Q_ASSERT(m_pdfDocument);
 
+    if (!document.hasChangedReferences())
+    {
+        document.setOldDocument(m_pdfDocument);
+    }
+
     if (m_undoRedoManager)
     {
         m_undoRedoManager->createUndo(document, m_pdfDocument);
@@ -155,8 +155,6 @@ void PDFTextToSpeech::setSettings(const PDFViewerSettings* viewerSettings)
 void PDFTextToSpeech::setProxy(pdf::PDFDrawWidgetProxy* proxy)
 {
     m_proxy = proxy;
-    pdf::PDFAsynchronousTextLayoutCompiler* compiler = m_proxy->getTextLayoutCompiler();
-    connect(compiler, &pdf::PDFAsynchronousTextLayoutCompiler::textLayoutChanged, this, &PDFTextToSpeech::updatePlay);
 }
 
 void PDFTextToSpeech::initializeUI(QComboBox* speechLocaleComboBox,
@@ -462,15 +460,8 @@ void PDFTextToSpeech::updatePlay()
     Q_ASSERT(m_proxy);
     Q_ASSERT(m_document);
 
-    // Jakub Melka: Check, if we have text layout. If not, then create it and return immediately.
-    // Otherwise, check, if we have something to say.
-    pdf::PDFAsynchronousTextLayoutCompiler* compiler = m_proxy->getTextLayoutCompiler();
-    if (!compiler->isTextLayoutReady())
-    {
-        compiler->makeTextLayout();
-        return;
-    }
-
+    // Check, if we have something to say. Text layouts of the pages
+    // are created on demand, when page is being read.
     QTextToSpeech::State state = m_textToSpeech->state();
     if (state == QTextToSpeech::Ready)
     {
@@ -520,7 +511,6 @@ void PDFTextToSpeech::updateToNextPage(pdf::PDFInteger pageIndex)
     const pdf::PDFInteger pageCount = m_document->getCatalog()->getPageCount();
 
     pdf::PDFAsynchronousTextLayoutCompiler* compiler = m_proxy->getTextLayoutCompiler();
-    Q_ASSERT(compiler->isTextLayoutReady());
 
     m_currentTextLayout = pdf::PDFTextLayout();
     m_textFlows.clear();
@@ -529,7 +519,7 @@ void PDFTextToSpeech::updateToNextPage(pdf::PDFInteger pageIndex)
     // Find first nonempty page
     while (m_currentPage < pageCount)
     {
-        m_currentTextLayout = compiler->getTextLayout(m_currentPage);
+        m_currentTextLayout = compiler->getTextLayoutLazy(m_currentPage);
         m_textFlows = pdf::PDFTextFlow::createTextFlows(m_currentTextLayout, pdf::PDFTextFlow::SeparateBlocks | pdf::PDFTextFlow::RemoveSoftHyphen, m_currentPage);
 
         if (!m_textFlows.empty())
@@ -540,6 +530,9 @@ void PDFTextToSpeech::updateToNextPage(pdf::PDFInteger pageIndex)
         ++m_currentPage;
     }
 
+    // Next page is prepared while the current page is being read
+    compiler->prefetchTextLayout(m_currentPage + 1);
+
     if (m_currentPage < pageCount && m_speechSynchronizeButton->isChecked())
     {
         m_proxy->goToPage(m_currentPage);
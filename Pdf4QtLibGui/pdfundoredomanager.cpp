@@ -46,8 +46,11 @@ void PDFUndoRedoManager::doUndo()
     m_redoSteps.insert(m_redoSteps.begin(), item);
     clampUndoRedoSteps();
 
+    pdf::PDFModifiedDocument modifiedDocument(item.oldDocument, nullptr, item.flags);
+    modifiedDocument.setOldDocument(item.newDocument);
+
     Q_EMIT undoRedoStateChanged();
-    Q_EMIT documentChangeRequest(pdf::PDFModifiedDocument(item.oldDocument, nullptr, item.flags));
+    Q_EMIT documentChangeRequest(qMove(modifiedDocument));
 }
 
 void PDFUndoRedoManager::doRedo()
@@ -64,8 +67,11 @@ void PDFUndoRedoManager::doRedo()
     m_undoSteps.push_back(item);
     clampUndoRedoSteps();
 
+    pdf::PDFModifiedDocument modifiedDocument(item.newDocument, nullptr, item.flags);
+    modifiedDocument.setOldDocument(item.oldDocument);
+
     Q_EMIT undoRedoStateChanged();
-    Q_EMIT documentChangeRequest(pdf::PDFModifiedDocument(item.newDocument, nullptr, item.flags));
+    Q_EMIT documentChangeRequest(qMove(modifiedDocument));
 }
 
 void PDFUndoRedoManager::clear()
@@ -334,7 +334,7 @@ PDFAsynchronousTextLayoutCompiler::PDFAsynchronousTextLayoutCompiler(PDFDrawWidg
     m_isRunning(false),
     m_cache(std::bind(&PDFAsynchronousTextLayoutCompiler::createTextLayout, this, std::placeholders::_1))
 {
-    connect(&m_textLayoutCompileFutureWatcher, &QFutureWatcher<PDFTextLayoutStorage>::finished, this, &PDFAsynchronousTextLayoutCompiler::onTextLayoutCreated);
+    connect(&m_textLayoutCompileFutureWatcher, &QFutureWatcher<void>::finished, this, &PDFAsynchronousTextLayoutCompiler::onTextLayoutCreated);
 }
 
 void PDFAsynchronousTextLayoutCompiler::start()
@@ -343,6 +343,9 @@ void PDFAsynchronousTextLayoutCompiler::start()
     {
         case State::Inactive:
         {
+            // Text layouts could be requested while engine was inactive,
+            // or document could be changed, so cached layouts can be invalid.
+            m_cache.clear();
             m_state = State::Active;
             break;
         }
@@ -368,16 +371,30 @@ void PDFAsynchronousTextLayoutCompiler::stop(bool clearCache)
 
         case State::Active:
         {
+            // Prefetched text layouts are created using the state of the
+            // engine, so we must wait for them before state is changed.
+            for (QFuture<void>& future : m_prefetchFutures)
+            {
+                future.waitForFinished();
+            }
+            m_prefetchFutures.clear();
+
             // Stop the engine
             m_state = State::Stopping;
+            m_isCancelled = true;
+            m_isRestartRequested = false;
             m_textLayoutCompileFutureWatcher.waitForFinished();
 
             if (clearCache)
             {
-                m_textLayouts = std::nullopt;
                 m_cache.clear();
             }
 
+            {
+                QMutexLocker lock(&m_createdTextLayoutsMutex);
+                m_createdTextLayouts.clear();
+            }
+
             m_state = State::Inactive;
             break;
         }
@@ -397,64 +414,41 @@ void PDFAsynchronousTextLayoutCompiler::reset()
     start();
 }
 
-PDFTextLayout PDFAsynchronousTextLayoutCompiler::createTextLayout(PDFInteger pageIndex)
+std::optional<PDFTextLayout> PDFAsynchronousTextLayoutCompiler::createTextLayout(PDFInteger pageIndex)
 {
-    PDFTextLayout result;
-
-    if (isTextLayoutReady())
-    {
-        result = getTextLayout(pageIndex);
-    }
-    else
+    if (m_state != State::Active || !m_proxy->getDocument())
     {
-        if (m_state != State::Active || !m_proxy->getDocument())
-        {
-            // Engine is not active, do not calculate layout
-            return result;
-        }
-
-        const PDFCatalog* catalog = m_proxy->getDocument()->getCatalog();
-        if (pageIndex < 0 || pageIndex >= PDFInteger(catalog->getPageCount()))
-        {
-            return result;
-        }
-
-        if (!catalog->getPage(pageIndex))
-        {
-            // Invalid page index
-            return result;
-        }
-
-        const PDFPage* page = catalog->getPage(pageIndex);
-        Q_ASSERT(page);
-
-        bool guard = false;
-        m_proxy->getFontCache()->setCacheShrinkEnabled(&guard, false);
-
-        PDFCMSPointer cms = m_proxy->getCMSManager()->getCurrentCMS();
-        PDFTextLayoutGenerator generator(m_proxy->getFeatures(), page, m_proxy->getDocument(), m_proxy->getFontCache(), cms.data(), m_proxy->getOptionalContentActivity(), QTransform(), m_proxy->getMeshQualitySettings());
-        generator.processContents();
-        result = generator.createTextLayout();
-        m_proxy->getFontCache()->setCacheShrinkEnabled(&guard, true);
+        // Engine is not active, do not calculate layout
+        return std::nullopt;
     }
 
-    return result;
-}
+    PDFTextLayout result;
 
-PDFTextLayout PDFAsynchronousTextLayoutCompiler::getTextLayout(PDFInteger pageIndex)
-{
-    if (m_state != State::Active || !m_proxy->getDocument())
+    const PDFCatalog* catalog = m_proxy->getDocument()->getCatalog();
+    if (pageIndex < 0 || pageIndex >= PDFInteger(catalog->getPageCount()))
     {
-        // Engine is not active, always return empty layout
-        return PDFTextLayout();
+        return result;
     }
 
-    if (m_textLayouts)
+    if (!catalog->getPage(pageIndex))
     {
-        return m_textLayouts->getTextLayout(pageIndex);
+        // Invalid page index
+        return result;
     }
 
-    return PDFTextLayout();
+    const PDFPage* page = catalog->getPage(pageIndex);
+    Q_ASSERT(page);
+
+    bool guard = false;
+    m_proxy->getFontCache()->setCacheShrinkEnabled(&guard, false);
+
+    PDFCMSPointer cms = m_proxy->getCMSManager()->getCurrentCMS();
+    PDFTextLayoutGenerator generator(m_proxy->getFeatures(), page, m_proxy->getDocument(), m_proxy->getFontCache(), cms.data(), m_proxy->getOptionalContentActivity(), QTransform(), m_proxy->getMeshQualitySettings());
+    generator.processContents();
+    result = generator.createTextLayout();
+    m_proxy->getFontCache()->setCacheShrinkEnabled(&guard, true);
+
+    return result;
 }
 
 PDFTextLayoutGetter PDFAsynchronousTextLayoutCompiler::getTextLayoutLazy(PDFInteger pageIndex)
@@ -462,56 +456,27 @@ PDFTextLayoutGetter PDFAsynchronousTextLayoutCompiler::getTextLayoutLazy(PDFInte
     return PDFTextLayoutGetter(&m_cache, pageIndex);
 }
 
-PDFTextSelection PDFAsynchronousTextLayoutCompiler::getTextSelectionAll(QColor color) const
+void PDFAsynchronousTextLayoutCompiler::prefetchTextLayout(PDFInteger pageIndex)
 {
-    PDFTextSelection result;
-
-    if (m_textLayouts)
+    if (m_state != State::Active || !m_proxy->getDocument())
     {
-        const PDFTextLayoutStorage& textLayouts = *m_textLayouts;
-
-        QMutex mutex;
-        PDFIntegerRange<size_t> pageRange(0, textLayouts.getCount());
-        auto selectPageText = [&mutex, &textLayouts, &result, color](PDFInteger pageIndex)
-        {
-            PDFTextLayout textLayout = textLayouts.getTextLayout(pageIndex);
-            PDFTextSelectionItems items;
-
-            const PDFTextBlocks& blocks = textLayout.getTextBlocks();
-            for (size_t blockId = 0, blockCount = blocks.size(); blockId < blockCount; ++blockId)
-            {
-                const PDFTextBlock& block = blocks[blockId];
-                const PDFTextLines& lines = block.getLines();
-
-                if (!lines.empty())
-                {
-                    const PDFTextLine& lastLine = lines.back();
-                    Q_ASSERT(!lastLine.getCharacters().empty());
-
-                    PDFCharacterPointer ptrStart;
-                    ptrStart.pageIndex = pageIndex;
-                    ptrStart.blockIndex = blockId;
-                    ptrStart.lineIndex = 0;
-                    ptrStart.characterIndex = 0;
-
-                    PDFCharacterPointer ptrEnd;
-                    ptrEnd.pageIndex = pageIndex;
-                    ptrEnd.blockIndex = blockId;
-                    ptrEnd.lineIndex = lines.size() - 1;
-                    ptrEnd.characterIndex = lastLine.getCharacters().size() - 1;
-
-                    items.emplace_back(ptrStart, ptrEnd);
-                }
-            }
+        // Engine is not active, do not calculate layout
+        return;
+    }
 
-            QMutexLocker lock(&mutex);
-            result.addItems(qMove(items), color);
-        };
-        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, pageRange.begin(), pageRange.end(), selectPageText);
+    if (pageIndex < 0 || pageIndex >= PDFInteger(m_proxy->getDocument()->getCatalog()->getPageCount()) || m_cache.contains(pageIndex))
+    {
+        return;
     }
 
-    result.build();
-    return result;
+    auto isFinished = [](const QFuture<void>& future) { return future.isFinished(); };
+    m_prefetchFutures.erase(std::remove_if(m_prefetchFutures.begin(), m_prefetchFutures.end(), isFinished), m_prefetchFutures.end());
+
+    auto prefetch = [this, pageIndex]()
+    {
+        m_cache.getTextLayout(pageIndex);
+    };
+    m_prefetchFutures.push_back(QtConcurrent::run(prefetch));
 }
 
 void PDFAsynchronousTextLayoutCompiler::makeTextLayout()
@@ -522,21 +487,21 @@ void PDFAsynchronousTextLayoutCompiler::makeTextLayout()
         return;
     }
 
-    if (m_textLayouts.has_value())
-    {
-        // Value is computed already
-        return;
-    }
-
     if (m_isRunning)
     {
-        // Text layout is already being processed
+        // Text layouts are already being created, some pages were
+        // already emitted, so we must start again, after current
+        // run is cancelled.
+        m_isCancelled = true;
+        m_isRestartRequested = true;
         return;
     }
 
     // Jakub Melka: Mark, that we are running (test for future is not enough,
     // because future can finish before this function exits, for example)
     m_isRunning = true;
+    m_isCancelled = false;
+    m_isRestartRequested = false;
 
     ProgressStartupInfo info;
     info.showDialog = false;
@@ -548,31 +513,53 @@ void PDFAsynchronousTextLayoutCompiler::makeTextLayout()
 
     PDFCMSPointer cms = m_proxy->getCMSManager()->getCurrentCMS();
 
-    auto createTextLayout = [this, cms, catalog]() -> PDFTextLayoutStorage
+    // Pages, which are currently displayed, are processed first and their
+    // text layouts are also stored in the cache. Other pages are processed
+    // after all active pages are finished.
+    std::vector<PDFInteger> activePages = m_proxy->getActivePages();
+    std::vector<PDFInteger> otherPages;
+    otherPages.reserve(catalog->getPageCount());
+    for (PDFInteger pageIndex = 0; pageIndex < PDFInteger(catalog->getPageCount()); ++pageIndex)
     {
-        PDFTextLayoutStorage result(catalog->getPageCount());
-        QMutex mutex;
-        auto generateTextLayout = [this, &result, &mutex, cms, catalog](PDFInteger pageIndex)
+        if (!std::binary_search(activePages.cbegin(), activePages.cend(), pageIndex))
         {
-            if (!catalog->getPage(pageIndex))
+            otherPages.push_back(pageIndex);
+        }
+    }
+
+    auto createTextLayout = [this, cms, catalog, activePages = qMove(activePages), otherPages = qMove(otherPages)]()
+    {
+        auto generateTextLayout = [this, &activePages, cms, catalog](PDFInteger pageIndex)
+        {
+            if (m_isCancelled)
             {
-                // Invalid page index
-                result.setTextLayout(pageIndex, PDFTextLayout(), &mutex);
                 return;
             }
 
-            const PDFPage* page = catalog->getPage(pageIndex);
-            Q_ASSERT(page);
+            PDFTextLayout textLayout;
+            if (const PDFPage* page = catalog->getPage(pageIndex))
+            {
+                PDFTextLayoutGenerator generator(m_proxy->getFeatures(), page, m_proxy->getDocument(), m_proxy->getFontCache(), cms.data(), m_proxy->getOptionalContentActivity(), QTransform(), m_proxy->getMeshQualitySettings());
+                generator.processContents();
+                textLayout = generator.createTextLayout();
+            }
 
-            PDFTextLayoutGenerator generator(m_proxy->getFeatures(), page, m_proxy->getDocument(), m_proxy->getFontCache(), cms.data(), m_proxy->getOptionalContentActivity(), QTransform(), m_proxy->getMeshQualitySettings());
-            generator.processContents();
-            result.setTextLayout(pageIndex, generator.createTextLayout(), &mutex);
+            if (std::binary_search(activePages.cbegin(), activePages.cend(), pageIndex))
+            {
+                m_cache.insert(pageIndex, textLayout);
+            }
+
+            {
+                QMutexLocker lock(&m_createdTextLayoutsMutex);
+                m_createdTextLayouts.emplace_back(pageIndex, qMove(textLayout));
+            }
+
+            QMetaObject::invokeMethod(this, &PDFAsynchronousTextLayoutCompiler::onTextLayoutPageCreated, Qt::QueuedConnection);
             m_proxy->getProgress()->step();
         };
 
-        auto pageRange = PDFIntegerRange<PDFInteger>(0, catalog->getPageCount());
-        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, pageRange.begin(), pageRange.end(), generateTextLayout);
-        return result;
+        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, activePages.cbegin(), activePages.cend(), generateTextLayout);
+        PDFExecutionPolicy::execute(PDFExecutionPolicy::Scope::Page, otherPages.cbegin(), otherPages.cend(), generateTextLayout);
     };
 
     Q_ASSERT(!m_textLayoutCompileFuture.isRunning());
@@ -580,15 +567,42 @@ void PDFAsynchronousTextLayoutCompiler::makeTextLayout()
     m_textLayoutCompileFutureWatcher.setFuture(m_textLayoutCompileFuture);
 }
 
+void PDFAsynchronousTextLayoutCompiler::onTextLayoutPageCreated()
+{
+    std::deque<std::pair<PDFInteger, PDFTextLayout>> createdTextLayouts;
+
+    {
+        QMutexLocker lock(&m_createdTextLayoutsMutex);
+        createdTextLayouts.swap(m_createdTextLayouts);
+    }
+
+    for (const auto& createdTextLayout : createdTextLayouts)
+    {
+        Q_EMIT textLayoutPageCreated(createdTextLayout.first, createdTextLayout.second);
+    }
+}
+
 void PDFAsynchronousTextLayoutCompiler::onTextLayoutCreated()
 {
     m_proxy->getFontCache()->setCacheShrinkEnabled(this, true);
     m_proxy->getProgress()->finish();
-    m_cache.clear();
-
-    m_textLayouts = m_textLayoutCompileFuture.result();
     m_isRunning = false;
-    Q_EMIT textLayoutChanged();
+
+    if (m_isRestartRequested)
+    {
+        // Emit remaining pages of the cancelled run (so no page is lost),
+        // and start over again.
+        onTextLayoutPageCreated();
+        makeTextLayout();
+        return;
+    }
+
+    if (!m_isCancelled)
+    {
+        // Emit all remaining pages before whole text layout is reported as finished
+        onTextLayoutPageCreated();
+        Q_EMIT textLayoutChanged();
+    }
 }
 
 }   // namespace pdf
@@ -28,6 +28,9 @@
 #include <QFutureWatcher>
 #include <QWaitCondition>
 
+#include <deque>
+#include <atomic>
+
 template <class Key, class T>
 class QCache;
 
@@ -186,47 +189,59 @@ public:
 
     /// Creates text layout of the page synchronously. If page index is invalid,
     /// then empty text layout is returned. Compiler must be active to get
-    /// valid text layout.
-    /// \param pageIndex Page index
-    PDFTextLayout createTextLayout(PDFInteger pageIndex);
-
-    /// Returns text layout of the page. If page index is invalid,
-    /// then empty text layout is returned.
+    /// valid text layout, if it is not, no layout is returned.
     /// \param pageIndex Page index
-    PDFTextLayout getTextLayout(PDFInteger pageIndex);
+    std::optional<PDFTextLayout> createTextLayout(PDFInteger pageIndex);
 
     /// Returns getter for text layout of the page. If page index is invalid,
-    /// then empty text layout getter is returned.
+    /// then empty text layout getter is returned. Text layout of the page
+    /// is created on demand and stored in the cache of recently used text layouts.
     /// \param pageIndex Page index
     PDFTextLayoutGetter getTextLayoutLazy(PDFInteger pageIndex);
 
-    /// Select all texts on all pages using \p color color.
-    /// \param color Color to be used for text selection
-    PDFTextSelection getTextSelectionAll(QColor color) const;
-
-    /// Create text layout for the document. Function is asynchronous,
-    /// it returns immediately. After text layout is created, signal
-    /// \p textLayoutChanged is emitted.
+    /// Creates text layout of the page asynchronously and stores it in the cache
+    /// of recently used text layouts, so it will be available without delay,
+    /// when it is needed (for example, next page to be read). If text layout
+    /// is already cached, or page index is invalid, nothing happens.
+    /// \param pageIndex Page index
+    void prefetchTextLayout(PDFInteger pageIndex);
+
+    /// Sets maximal number of text layouts of pages kept in the cache
+    /// \param capacity Cache capacity
+    void setTextLayoutCacheCapacity(size_t capacity) { m_cache.setCapacity(capacity); }
+
+    /// Creates text layouts of all pages of the document. Function is asynchronous,
+    /// it returns immediately. Active pages are processed first. Text layouts are
+    /// not stored (only layouts of active pages are put into the cache), instead,
+    /// signal \p textLayoutPageCreated is emitted for each page, as soon as its
+    /// text layout is created. After all pages are processed, signal \p textLayoutChanged
+    /// is emitted. If text layouts are being created, then creation is restarted,
+    /// so all pages are emitted again.
     void makeTextLayout();
 
-    /// Returns true, if text layout is ready
-    bool isTextLayoutReady() const { return m_textLayouts.has_value(); }
-
-    /// Returns text layout storage (if it is ready), or nullptr
-    const PDFTextLayoutStorage* getTextLayoutStorage() const { return isTextLayoutReady() ? &m_textLayouts.value() : nullptr; }
-
 signals:
+    void textLayoutPageCreated(PDFInteger pageIndex, const PDFTextLayout& textLayout);
     void textLayoutChanged();
 
 private:
+    void onTextLayoutPageCreated();
     void onTextLayoutCreated();
 
     PDFDrawWidgetProxy* m_proxy;
     State m_state = State::Inactive;
     bool m_isRunning;
-    std::optional<PDFTextLayoutStorage> m_textLayouts;
-    QFuture<PDFTextLayoutStorage> m_textLayoutCompileFuture;
-    QFutureWatcher<PDFTextLayoutStorage> m_textLayoutCompileFutureWatcher;
+    bool m_isRestartRequested = false;
+    std::atomic_bool m_isCancelled = false;
+    QFuture<void> m_textLayoutCompileFuture;
+    QFutureWatcher<void> m_textLayoutCompileFutureWatcher;
+
+    /// Text layouts being created by prefetch
+    std::vector<QFuture<void>> m_prefetchFutures;
+
+    /// Text layouts created by worker threads, which were not yet emitted
+    QMutex m_createdTextLayoutsMutex;
+    std::deque<std::pair<PDFInteger, PDFTextLayout>> m_createdTextLayouts;
+
     PDFTextLayoutCache m_cache;
 };
 
@@ -32,6 +32,8 @@
 #include <QScreen>
 #include <QGuiApplication>
 
+#include <numeric>
+
 #include "pdfdbgheap.h"
 
 namespace pdf
@@ -115,17 +117,12 @@ PDFDrawSpaceController::LayoutItem PDFDrawSpaceController::getLayoutItemForPage(
 {
     LayoutItem result;
 
-    if (pageIndex >= 0 && pageIndex < static_cast<PDFInteger>(m_layoutItems.size()) && m_layoutItems[pageIndex].pageIndex == pageIndex)
-    {
-        result = m_layoutItems[pageIndex];
-    }
-
-    if (!result.isValid())
+    if (pageIndex >= 0 && pageIndex < static_cast<PDFInteger>(m_pageToLayoutItem.size()))
     {
-        auto it = std::find_if(m_layoutItems.cbegin(), m_layoutItems.cend(), [pageIndex](const LayoutItem& item) { return item.pageIndex == pageIndex; });
-        if (it != m_layoutItems.cend())
+        const size_t layoutItemIndex = m_pageToLayoutItem[pageIndex];
+        if (layoutItemIndex != INVALID_LAYOUT_ITEM)
         {
-            result = *it;
+            result = m_layoutItems[layoutItemIndex];
         }
     }
 
@@ -436,13 +433,38 @@ void PDFDrawSpaceController::recalculate()
         }
     }
 
+    buildPageIndex();
     Q_EMIT drawSpaceChanged();
 }
 
+void PDFDrawSpaceController::buildPageIndex()
+{
+    m_pageToLayoutItem.clear();
+
+    PDFInteger maxPageIndex = -1;
+    for (const LayoutItem& item : m_layoutItems)
+    {
+        maxPageIndex = qMax(maxPageIndex, item.pageIndex);
+    }
+
+    m_pageToLayoutItem.resize(maxPageIndex + 1, INVALID_LAYOUT_ITEM);
+
+    // Iterate backwards, so the first layout item of the page wins
+    for (size_t i = m_layoutItems.size(); i > 0; --i)
+    {
+        const LayoutItem& item = m_layoutItems[i - 1];
+        if (item.pageIndex >= 0)
+        {
+            m_pageToLayoutItem[item.pageIndex] = i - 1;
+        }
+    }
+}
+
 void PDFDrawSpaceController::clear(bool emitSignal)
 {
     m_layoutItems.clear();
     m_blockItems.clear();
+    m_pageToLayoutItem.clear();
 
     if (emitSignal)
     {
@@ -597,6 +619,7 @@ void PDFDrawWidgetProxy::update()
         }
 
         m_layout.blockRect = fromDeviceSpace(rectangle).toRect();
+        m_layout.buildIndex();
     }
 
     QSize blockSize = m_layout.blockRect.size();
@@ -785,8 +808,10 @@ void PDFDrawWidgetProxy::drawPages(QPainter* painter, QRect rect, PDFRenderer::F
     QColor paperColor = getPaperColor();
 
     // Iterate trough pages and display them on the painter device
-    for (const LayoutItem& item : m_layout.items)
+    for (size_t itemIndex : getLayoutItemCandidates(rect))
     {
+        const LayoutItem& item = m_layout.items[itemIndex];
+
         // The offsets m_horizontalOffset and m_verticalOffset are offsets to the
         // topleft point of the block. But block maybe doesn't start at (0, 0),
         // so we must also use translation from the block beginning.
@@ -815,7 +840,6 @@ void PDFDrawWidgetProxy::drawPages(QPainter* painter, QRect rect, PDFRenderer::F
                 // Draw text blocks/text lines, if it is enabled
                 if (features.testFlag(PDFRenderer::DebugTextBlocks))
                 {
-                    m_textLayoutCompiler->makeTextLayout();
                     const PDFTextLayout& layout = layoutGetter;
                     const PDFTextBlocks& textBlocks = layout.getTextBlocks();
 
@@ -838,7 +862,6 @@ void PDFDrawWidgetProxy::drawPages(QPainter* painter, QRect rect, PDFRenderer::F
                 }
                 if (features.testFlag(PDFRenderer::DebugTextLines))
                 {
-                    m_textLayoutCompiler->makeTextLayout();
                     const PDFTextLayout& layout = layoutGetter;
                     const PDFTextBlocks& textBlocks = layout.getTextBlocks();
 
@@ -957,6 +980,63 @@ QImage PDFDrawWidgetProxy::drawThumbnailImage(PDFInteger pageIndex, int pixelSiz
     return image;
 }
 
+void PDFDrawWidgetProxy::Layout::buildIndex()
+{
+    itemsByTop.resize(items.size());
+    std::iota(itemsByTop.begin(), itemsByTop.end(), static_cast<size_t>(0));
+
+    auto comparator = [this](size_t l, size_t r)
+    {
+        return items[l].pageRect.top() < items[r].pageRect.top();
+    };
+    std::stable_sort(itemsByTop.begin(), itemsByTop.end(), comparator);
+
+    maxBottom.clear();
+    maxBottom.reserve(itemsByTop.size());
+
+    int currentMaxBottom = std::numeric_limits<int>::min();
+    for (size_t itemIndex : itemsByTop)
+    {
+        currentMaxBottom = qMax(currentMaxBottom, items[itemIndex].pageRect.bottom());
+        maxBottom.push_back(currentMaxBottom);
+    }
+}
+
+std::vector<size_t> PDFDrawWidgetProxy::Layout::getItemCandidates(int top, int bottom) const
+{
+    std::vector<size_t> result;
+
+    Q_ASSERT(itemsByTop.size() == items.size());
+    Q_ASSERT(maxBottom.size() == items.size());
+
+    // Items with top above the bottom of the interval are in the range [0, last). Because
+    // maxBottom is nondecreasing, all items before first have bottom above the interval.
+    auto itBegin = itemsByTop.cbegin();
+    auto itLast = std::upper_bound(itBegin, itemsByTop.cend(), bottom, [this](int value, size_t itemIndex) { return value < items[itemIndex].pageRect.top(); });
+    auto itFirst = std::next(itBegin, std::distance(maxBottom.cbegin(), std::lower_bound(maxBottom.cbegin(), maxBottom.cend(), top)));
+
+    for (auto it = itFirst; it < itLast; ++it)
+    {
+        if (items[*it].pageRect.bottom() >= top)
+        {
+            result.push_back(*it);
+        }
+    }
+
+    // Preserve the layout order (pages are painted in this order)
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<size_t> PDFDrawWidgetProxy::getLayoutItemCandidates(QRect rect) const
+{
+    // Transform rectangle from widget coordinates to the block coordinates
+    const int offset = static_cast<int>(m_verticalOffset) - m_layout.blockRect.top();
+    const int top = rect.top() - offset;
+    const int bottom = rect.bottom() - offset;
+    return m_layout.getItemCandidates(top, bottom);
+}
+
 std::vector<PDFInteger> PDFDrawWidgetProxy::getPagesIntersectingRect(QRect rect) const
 {
     std::vector<PDFInteger> pages;
@@ -965,8 +1045,10 @@ std::vector<PDFInteger> PDFDrawWidgetProxy::getPagesIntersectingRect(QRect rect)
     pages.reserve(32);
 
     // Iterate trough pages, place them and test, if they intersects with rectangle
-    for (const LayoutItem& item : m_layout.items)
+    for (size_t itemIndex : getLayoutItemCandidates(rect))
     {
+        const LayoutItem& item = m_layout.items[itemIndex];
+
         // The offsets m_horizontalOffset and m_verticalOffset are offsets to the
         // topleft point of the block. But block maybe doesn't start at (0, 0),
         // so we must also use translation from the block beginning.
@@ -1007,8 +1089,10 @@ std::vector<PDFInteger> PDFDrawWidgetProxy::getActivePages() const
 PDFInteger PDFDrawWidgetProxy::getPageUnderPoint(QPoint point, QPointF* pagePoint) const
 {
     // Iterate trough pages, place them and test, if they intersects with rectangle
-    for (const LayoutItem& item : m_layout.items)
+    for (size_t itemIndex : getLayoutItemCandidates(QRect(point - QPoint(1, 1), QSize(2, 2))))
     {
+        const LayoutItem& item = m_layout.items[itemIndex];
+
         // The offsets m_horizontalOffset and m_verticalOffset are offsets to the
         // topleft point of the block. But block maybe doesn't start at (0, 0),
         // so we must also use translation from the block beginning.
@@ -1038,8 +1122,10 @@ PDFWidgetSnapshot PDFDrawWidgetProxy::getSnapshot() const
     QRect viewport = getWidget()->rect();
 
     // Iterate trough pages, place them and test, if they intersects with rectangle
-    for (const LayoutItem& item : m_layout.items)
+    for (size_t itemIndex : getLayoutItemCandidates(viewport))
     {
+        const LayoutItem& item = m_layout.items[itemIndex];
+
         // The offsets m_horizontalOffset and m_verticalOffset are offsets to the
         // topleft point of the block. But block maybe doesn't start at (0, 0),
         // so we must also use translation from the block beginning.
@@ -1081,8 +1167,10 @@ QRect PDFDrawWidgetProxy::getPagesIntersectingRectBoundingBox(QRect rect) const
     QRect resultRect;
 
     // Iterate trough pages, place them and test, if they intersects with rectangle
-    for (const LayoutItem& item : m_layout.items)
+    for (size_t itemIndex : getLayoutItemCandidates(rect))
     {
+        const LayoutItem& item = m_layout.items[itemIndex];
+
         // The offsets m_horizontalOffset and m_verticalOffset are offsets to the
         // topleft point of the block. But block maybe doesn't start at (0, 0),
         // so we must also use translation from the block beginning.
@@ -150,6 +150,9 @@ private:
     /// Clears the draw space. Emits signal if desired.
     void clear(bool emitSignal);
 
+    /// Builds page index to layout item index lookup table
+    void buildPageIndex();
+
     /// Represents data for the single block. Contains block size in milimeters.
     struct LayoutBlock
     {
@@ -172,6 +175,11 @@ private:
     PageRotation m_pageRotation;
     LayoutItems m_customLayoutItems;
 
+    static constexpr size_t INVALID_LAYOUT_ITEM = std::numeric_limits<size_t>::max();
+
+    /// Maps page index to index of its first layout item (or INVALID_LAYOUT_ITEM)
+    std::vector<size_t> m_pageToLayoutItem;
+
     /// Font cache
     PDFFontCache m_fontCache;
 };
@@ -395,18 +403,40 @@ private:
         QRect pageRect;
     };
 
+    /// Layout of the current block in pixel space. Page rectangles are indexed
+    /// by their vertical span, so hit testing and painting of visible pages
+    /// does not depend on the total page count.
     struct Layout
     {
         inline void clear()
         {
             items.clear();
+            itemsByTop.clear();
+            maxBottom.clear();
             blockRect = QRect();
         }
 
+        /// Builds vertical span index of the layout items
+        void buildIndex();
+
+        /// Returns ascending indices of items, whose vertical span intersects
+        /// interval [top, bottom] (in block coordinates). Returned items are only
+        /// candidates, caller must perform exact test.
+        /// \param top Top of the interval
+        /// \param bottom Bottom of the interval (inclusive)
+        std::vector<size_t> getItemCandidates(int top, int bottom) const;
+
         std::vector<LayoutItem> items;
+        std::vector<size_t> itemsByTop; ///< Item indices sorted by top of page rectangle
+        std::vector<int> maxBottom;     ///< Prefix maximum of page bottoms in itemsByTop order
         QRect blockRect;
     };
 
+    /// Returns indices of layout items, which can intersect given rectangle
+    /// (in widget coordinates), in ascending order.
+    /// \param rect Rectangle in widget coordinates
+    std::vector<size_t> getLayoutItemCandidates(QRect rect) const;
+
     struct GroupInfo
     {
         bool operator==(const GroupInfo&) const = default;
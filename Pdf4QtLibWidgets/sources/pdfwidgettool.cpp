@@ -334,7 +334,8 @@ PDFFindTextTool::PDFFindTextTool(PDFDrawWidgetProxy* proxy, QAction* prevAction,
     m_selectedResultIndex(0)
 {
     PDFAsynchronousTextLayoutCompiler* compiler = getProxy()->getTextLayoutCompiler();
-    connect(compiler, &PDFAsynchronousTextLayoutCompiler::textLayoutChanged, this, &PDFFindTextTool::performSearch);
+    connect(compiler, &PDFAsynchronousTextLayoutCompiler::textLayoutPageCreated, this, &PDFFindTextTool::onTextLayoutPageCreated);
+    connect(compiler, &PDFAsynchronousTextLayoutCompiler::textLayoutChanged, this, &PDFFindTextTool::onTextLayoutChanged);
     connect(m_prevAction, &QAction::triggered, this, &PDFFindTextTool::onActionPrevious);
     connect(m_nextAction, &QAction::triggered, this, &PDFFindTextTool::onActionNext);
 
@@ -358,6 +359,7 @@ void PDFFindTextTool::drawPage(QPainter* painter,
 
 void PDFFindTextTool::clearResults()
 {
+    m_searchedPages.clear();
     m_findResults.clear();
     m_selectedResultIndex = 0;
     m_textSelection.dirty();
@@ -381,6 +383,21 @@ void PDFFindTextTool::goToCurrentResult()
 
         }
     }
+
+    // Text layouts of the pages of neighbouring results are prepared in advance,
+    // so moving to the next or previous result doesn't have to wait for them.
+    if (!m_findResults.empty())
+    {
+        PDFAsynchronousTextLayoutCompiler* compiler = getProxy()->getTextLayoutCompiler();
+        for (const size_t index : { (m_selectedResultIndex + 1) % m_findResults.size(), (m_selectedResultIndex + m_findResults.size() - 1) % m_findResults.size() })
+        {
+            const PDFTextSelectionItems& items = m_findResults[index].textSelectionItems;
+            if (!items.empty())
+            {
+                compiler->prefetchTextLayout(items.front().first.pageIndex);
+            }
+        }
+    }
 }
 
 void PDFFindTextTool::setActiveImpl(bool active)
@@ -391,9 +408,6 @@ void PDFFindTextTool::setActiveImpl(bool active)
     {
         Q_ASSERT(!m_dialog);
 
-        // For find, we will need text layout
-        getProxy()->getTextLayoutCompiler()->makeTextLayout();
-
         // Create dialog
         m_dialog = new PDFFindTextToolDialog(getProxy(), m_parentDialog, Qt::Popup);
         m_dialog->setWindowTitle(tr("Find"));
@@ -497,15 +511,8 @@ void PDFFindTextTool::onSearchText()
         return;
     }
 
-    pdf::PDFAsynchronousTextLayoutCompiler* compiler = getProxy()->getTextLayoutCompiler();
-    if (compiler->isTextLayoutReady())
-    {
-        performSearch();
-    }
-    else
-    {
-        compiler->makeTextLayout();
-    }
+    // Text layouts of the pages are searched as they are created
+    getProxy()->getTextLayoutCompiler()->makeTextLayout();
 }
 
 void PDFFindTextTool::onActionFirst()
@@ -557,25 +564,16 @@ void PDFFindTextTool::onDialogRejected()
     setActive(false);
 }
 
-void PDFFindTextTool::performSearch()
+void PDFFindTextTool::onTextLayoutPageCreated(PDFInteger pageIndex, const PDFTextLayout& textLayout)
 {
-    if (m_parameters.isSearchFinished)
+    if (m_parameters.isSearchFinished || m_parameters.phrase.isEmpty())
     {
         return;
     }
 
-    clearResults();
-    m_parameters.isSearchFinished = true;
-
-    if (m_parameters.phrase.isEmpty())
+    if (!m_searchedPages.insert(pageIndex).second)
     {
-        return;
-    }
-
-    PDFAsynchronousTextLayoutCompiler* compiler = getProxy()->getTextLayoutCompiler();
-    if (!compiler->isTextLayoutReady())
-    {
-        // Text layout is not ready yet
+        // Page was already searched
         return;
     }
 
@@ -591,12 +589,12 @@ void PDFFindTextTool::performSearch()
 
     pdf::PDFTextFlow::FlowFlags flowFlags = pdf::PDFTextFlow::SeparateBlocks;
 
-    const pdf::PDFTextLayoutStorage* textLayoutStorage = compiler->getTextLayoutStorage();
+    pdf::PDFFindResults pageFindResults;
     if (!useRegularExpression)
     {
         // Use simple text search
         Qt::CaseSensitivity caseSensitivity = m_parameters.isCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
-        m_findResults = textLayoutStorage->find(expression, caseSensitivity, flowFlags);
+        pageFindResults = textLayout.find(expression, caseSensitivity, flowFlags, pageIndex);
     }
     else
     {
@@ -608,17 +606,37 @@ void PDFFindTextTool::performSearch()
         }
 
         QRegularExpression regularExpression(expression, patternOptions);
-        m_findResults = textLayoutStorage->find(regularExpression, flowFlags);
+        pageFindResults = textLayout.find(regularExpression, flowFlags, pageIndex);
     }
 
-    std::sort(m_findResults.begin(), m_findResults.end());
-    m_selectedResultIndex = 0;
+    if (pageFindResults.empty())
+    {
+        return;
+    }
+
+    // Results of the page are placed between results of other pages,
+    // current result must remain selected.
+    std::sort(pageFindResults.begin(), pageFindResults.end());
+    auto it = std::upper_bound(m_findResults.begin(), m_findResults.end(), pageFindResults.front());
+    const size_t insertIndex = std::distance(m_findResults.begin(), it);
+    if (!m_findResults.empty() && insertIndex <= m_selectedResultIndex)
+    {
+        m_selectedResultIndex += pageFindResults.size();
+    }
+    m_findResults.insert(it, std::make_move_iterator(pageFindResults.begin()), std::make_move_iterator(pageFindResults.end()));
+
     m_textSelection.dirty();
     getProxy()->repaintNeeded();
 
     updateResultsUI();
 }
 
+void PDFFindTextTool::onTextLayoutChanged()
+{
+    // All pages were searched
+    m_parameters.isSearchFinished = true;
+}
+
 void PDFFindTextTool::updateActions()
 {
     BaseClass::updateActions();
@@ -704,6 +722,7 @@ PDFSelectTextTool::PDFSelectTextTool(PDFDrawWidgetProxy* proxy, QAction* action,
     connect(copyTextAction, &QAction::triggered, this, &PDFSelectTextTool::onActionCopyText);
     connect(selectAllAction, &QAction::triggered, this, &PDFSelectTextTool::onActionSelectAll);
     connect(deselectAction, &QAction::triggered, this, &PDFSelectTextTool::onActionDeselect);
+    connect(proxy->getTextLayoutCompiler(), &PDFAsynchronousTextLayoutCompiler::textLayoutPageCreated, this, &PDFSelectTextTool::onTextLayoutPageCreated);
 
     updateActions();
 }
@@ -779,11 +798,8 @@ void PDFSelectTextTool::mouseMoveEvent(QWidget* widget, QMouseEvent* event)
 {
     Q_UNUSED(widget);
 
-    // We must make text layout. This is fast, because text layout is being
-    // created only, if it doesn't exist. This function is also called only,
-    // if tool is active.
-    getProxy()->getTextLayoutCompiler()->makeTextLayout();
-
+    // Text layout of the page under cursor is created on demand
+    // and it is kept in the cache of recently used text layouts.
     QPointF pagePoint;
     const PDFInteger pageIndex = getProxy()->getPageUnderPoint(event->pos(), &pagePoint);
     PDFTextLayout textLayout = getProxy()->getTextLayoutCompiler()->getTextLayoutLazy(pageIndex);
@@ -811,15 +827,7 @@ void PDFSelectTextTool::setActiveImpl(bool active)
 {
     BaseClass::setActiveImpl(active);
 
-    if (active)
-    {
-        pdf::PDFAsynchronousTextLayoutCompiler* compiler = getProxy()->getTextLayoutCompiler();
-        if (!compiler->isTextLayoutReady())
-        {
-            compiler->makeTextLayout();
-        }
-    }
-    else
+    if (!active)
     {
         // Just clear the text selection
         setSelection(PDFTextSelection());
@@ -866,8 +874,18 @@ void PDFSelectTextTool::onActionCopyText()
             while (it != m_textSelection.end())
             {
                 const PDFInteger pageIndex = it->start.pageIndex;
-                PDFTextLayout textLayout = getProxy()->getTextLayoutCompiler()->getTextLayoutLazy(pageIndex);
-                result << textLayout.getTextFromSelection(it, itEnd, pageIndex);
+                auto textIt = m_selectAllTexts.find(pageIndex);
+                if (textIt != m_selectAllTexts.cend())
+                {
+                    result << textIt->second;
+                }
+                else
+                {
+                    // Selection created by the mouse, it is on single page, whose
+                    // text layout was used to create the selection, so it is cached.
+                    PDFTextLayout textLayout = getProxy()->getTextLayoutCompiler()->getTextLayoutLazy(pageIndex);
+                    result << textLayout.getTextFromSelection(it, itEnd, pageIndex);
+                }
 
                 it = itEnd;
                 itEnd = m_textSelection.nextPageRange(it);
@@ -884,9 +902,43 @@ void PDFSelectTextTool::onActionCopyText()
 
 void PDFSelectTextTool::onActionSelectAll()
 {
-    if (isActive())
+    if (isActive() && getDocument())
     {
-        setSelection(getProxy()->getTextLayoutCompiler()->getTextSelectionAll(Qt::yellow));
+        setSelection(pdf::PDFTextSelection());
+
+        // Pages are selected as soon as their text layouts are created,
+        // selection is displayed after all pages are selected.
+        const PDFInteger pageCount = getDocument()->getCatalog()->getPageCount();
+        for (PDFInteger pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+        {
+            m_selectAllPendingPages.insert(m_selectAllPendingPages.end(), pageIndex);
+        }
+
+        getProxy()->getTextLayoutCompiler()->makeTextLayout();
+    }
+}
+
+void PDFSelectTextTool::onTextLayoutPageCreated(PDFInteger pageIndex, const PDFTextLayout& textLayout)
+{
+    if (m_selectAllPendingPages.erase(pageIndex) > 0)
+    {
+        PDFTextSelectionItems items = textLayout.selectAll(pageIndex);
+
+        PDFTextSelection pageSelection;
+        pageSelection.addItems(items, Qt::yellow);
+        pageSelection.build();
+        m_selectAllTexts[pageIndex] = textLayout.getTextFromSelection(pageSelection, pageIndex);
+        m_selectAllSelection.addItems(items, Qt::yellow);
+
+        if (m_selectAllPendingPages.empty())
+        {
+            // All pages are selected, build the selection only once
+            m_selectAllSelection.build();
+            m_textSelection = qMove(m_selectAllSelection);
+            m_selectAllSelection = PDFTextSelection();
+            getProxy()->repaintNeeded();
+            updateActions();
+        }
     }
 }
 
@@ -900,6 +952,10 @@ void PDFSelectTextTool::onActionDeselect()
 
 void PDFSelectTextTool::setSelection(PDFTextSelection&& textSelection)
 {
+    m_selectAllPendingPages.clear();
+    m_selectAllSelection = PDFTextSelection();
+    m_selectAllTexts.clear();
+
     if (m_textSelection != textSelection)
     {
         m_textSelection = qMove(textSelection);
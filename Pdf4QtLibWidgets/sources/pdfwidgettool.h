@@ -203,7 +203,8 @@ private:
     void onDialogRejected();
 
     void setCurrentResultIndex(size_t index);
-    void performSearch();
+    void onTextLayoutPageCreated(PDFInteger pageIndex, const PDFTextLayout& textLayout);
+    void onTextLayoutChanged();
     void updateResultsUI();
     void updateTitle();
     void clearResults();
@@ -237,6 +238,7 @@ private:
     };
 
     SearchParameters m_parameters;
+    std::set<PDFInteger> m_searchedPages;
     pdf::PDFFindResults m_findResults;
     size_t m_selectedResultIndex;
     mutable pdf::PDFCachedItem<pdf::PDFTextSelection> m_textSelection;
@@ -280,6 +282,7 @@ private:
     void onActionCopyText();
     void onActionSelectAll();
     void onActionDeselect();
+    void onTextLayoutPageCreated(PDFInteger pageIndex, const PDFTextLayout& textLayout);
     void setSelection(pdf::PDFTextSelection&& textSelection);
 
     struct SelectionInfo
@@ -294,6 +297,19 @@ private:
     pdf::PDFTextSelection m_textSelection;
     SelectionInfo m_selectionInfo;
     bool m_isCursorOverText;
+
+    /// Pages, which are not yet selected by select all action
+    /// (text layouts of them were not yet created)
+    std::set<PDFInteger> m_selectAllPendingPages;
+
+    /// Selection created by select all action. It is built and
+    /// it becomes current selection after all pages are selected.
+    pdf::PDFTextSelection m_selectAllSelection;
+
+    /// Texts of the pages selected by select all action. Text layouts
+    /// of the pages are not kept, so texts are extracted as soon as
+    /// layouts are created and copying don't have to create them again.
+    std::map<PDFInteger, QString> m_selectAllTexts;
 };
 
 /// Tool to magnify specific area in the drawing widget
@@ -179,7 +179,9 @@ void PDFToolAbstractApplication::initializeCommandLineParser(QCommandLineParser*
     if (optionFlags.testFlag(Diff))
     {
         parser->addPositionalArgument("left", "Left (old) document to be compared.");
-        parser->addPositionalArgument("right", "Right (new) document to be compared.");
+        parser->addPositionalArgument("right", "Right (new) document(s) to be compared.", "right.pdf [right2.pdf, ...]");
+        parser->addOption(QCommandLineOption("diff-fast-hash", "Use fast non-cryptographic hash for page fingerprints."));
+        parser->addOption(QCommandLineOption("diff-fingerprints", "Load page fingerprints from files next to documents (if they exist) and save newly calculated fingerprints."));
     }
 
     if (optionFlags.testFlag(SignatureVerification))
@@ -213,6 +215,20 @@ void PDFToolAbstractApplication::initializeCommandLineParser(QCommandLineParser*
         parser->addOption(QCommandLineOption("compute-hashes", "Compute hashes (MD5, SHA1, SHA256...) of document."));
     }
 
+    if (optionFlags.testFlag(InkCoverage))
+    {
+        parser->addOption(QCommandLineOption("ink-resolution", "Resolution (in pixels) of the longer side of the page used for ink coverage calculation.", "pixels", "1920"));
+        parser->addOption(QCommandLineOption("ink-preview", "Use coarse-to-fine mode. Coverage is estimated from low resolution preview. Only bands of the page, whose total area coverage in the preview is close to the limit (within 50 %), are rendered in full resolution, page exceeding the limit in the preview is not rendered in full resolution at all."));
+        parser->addOption(QCommandLineOption("ink-tac-limit", "Total area coverage limit in percents (used in coarse-to-fine mode).", "percent", "300"));
+        parser->addOption(QCommandLineOption("ink-tile-memory", "Memory limit of the rendered page bitmap in megabytes. If exceeded, page is rendered in tiles (0 means no limit).", "MB", "0"));
+        parser->addOption(QCommandLineOption("ink-stream", "Print coverage of each page as soon as it is calculated (each page is written as a separate document in the selected output format)."));
+    }
+
+    if (optionFlags.testFlag(Serve))
+    {
+        parser->addOption(QCommandLineOption("serve-cache-size", "Maximal number of documents kept opened between requests.", "count", "4"));
+    }
+
     if (optionFlags.testFlag(PageSelector))
     {
         parser->addOption(QCommandLineOption("page-first", "First page of page range.", "number"));
@@ -445,6 +461,57 @@ PDFToolOptions PDFToolAbstractApplication::getOptions(QCommandLineParser* parser
         options.computeHashes = parser->isSet("compute-hashes");
     }
 
+    if (optionFlags.testFlag(InkCoverage))
+    {
+        bool ok = false;
+        int resolution = parser->value("ink-resolution").toInt(&ok);
+        if (ok && resolution > 0)
+        {
+            options.inkCoverageResolution = resolution;
+        }
+        else
+        {
+            PDFConsole::writeError(PDFToolTranslationContext::tr("Invalid ink coverage resolution '%1'.").arg(parser->value("ink-resolution")), options.outputCodec);
+        }
+
+        double totalAreaCoverageLimit = parser->value("ink-tac-limit").toDouble(&ok);
+        if (ok && totalAreaCoverageLimit > 0.0)
+        {
+            options.inkCoverageTotalAreaCoverageLimit = totalAreaCoverageLimit;
+        }
+        else
+        {
+            PDFConsole::writeError(PDFToolTranslationContext::tr("Invalid total area coverage limit '%1'.").arg(parser->value("ink-tac-limit")), options.outputCodec);
+        }
+
+        int tileMemoryLimit = parser->value("ink-tile-memory").toInt(&ok);
+        if (ok && tileMemoryLimit >= 0)
+        {
+            options.inkCoverageTileMemoryLimit = tileMemoryLimit;
+        }
+        else
+        {
+            PDFConsole::writeError(PDFToolTranslationContext::tr("Invalid tile memory limit '%1'.").arg(parser->value("ink-tile-memory")), options.outputCodec);
+        }
+
+        options.inkCoveragePreview = parser->isSet("ink-preview");
+        options.inkCoverageStream = parser->isSet("ink-stream");
+    }
+
+    if (optionFlags.testFlag(Serve))
+    {
+        bool ok = false;
+        int cacheSize = parser->value("serve-cache-size").toInt(&ok);
+        if (ok && cacheSize > 0)
+        {
+            options.serveDocumentCacheSize = cacheSize;
+        }
+        else
+        {
+            PDFConsole::writeError(PDFToolTranslationContext::tr("Invalid document cache size '%1'.").arg(parser->value("serve-cache-size")), options.outputCodec);
+        }
+    }
+
     if (optionFlags.testFlag(PageSelector))
     {
         options.pageSelectorFirstPage = parser->isSet("page-first") ? parser->value("page-first") : QString();
@@ -892,6 +959,8 @@ PDFToolOptions PDFToolAbstractApplication::getOptions(QCommandLineParser* parser
     if (optionFlags.testFlag(Diff))
     {
         options.diffFiles = positionalArguments;
+        options.diffFastHash = parser->isSet("diff-fast-hash");
+        options.diffUseFingerprints = parser->isSet("diff-fingerprints");
     }
 
     if (optionFlags.testFlag(Optimize))
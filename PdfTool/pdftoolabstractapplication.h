@@ -148,10 +148,22 @@ struct PDFToolOptions
 
     // For option 'Diff'
     QStringList diffFiles;
+    bool diffFastHash = false;
+    bool diffUseFingerprints = false;
 
     // For option 'Optimize'
     pdf::PDFOptimizer::OptimizationFlags optimizeFlags = pdf::PDFOptimizer::None;
 
+    // For option 'InkCoverage'
+    int inkCoverageResolution = 1920;
+    bool inkCoveragePreview = false;
+    double inkCoverageTotalAreaCoverageLimit = 300.0;
+    int inkCoverageTileMemoryLimit = 0;
+    bool inkCoverageStream = false;
+
+    // For option 'Serve'
+    int serveDocumentCacheSize = 4;
+
     // For option 'CertStore'
     bool certStoreEnumerateSystemCertificates = false;
     bool certStoreEnumerateUserCertificates = true;
@@ -252,6 +264,8 @@ public:
         CertStoreInstall                = 0x00400000,       ///< Settings for certificate store install certificate tool
         Encrypt                         = 0x00800000,       ///< Encryption settings
         Diff                            = 0x01000000,       ///< Diff settings (compare documents)
+        InkCoverage                     = 0x02000000,       ///< Settings for ink coverage tool
+        Serve                           = 0x04000000,       ///< Settings for render service
     };
     Q_DECLARE_FLAGS(Options, Option)
 
@@ -19,6 +19,7 @@
 #include "pdfexception.h"
 
 #include <QFile>
+#include <QSaveFile>
 #include <QMimeDatabase>
 
 namespace pdftool
@@ -178,13 +179,33 @@ int PDFToolAttachmentsApplication::execute(const PDFToolOptions& options)
 
             try
             {
-                QByteArray data = document.getDecodedStream(info.specification->getPlatformFile()->getStream());
+                // Attachment is decoded in chunks, so large attachments are not held in the memory
+                pdf::PDFStreamFilterDevice device(document.createStreamDecoder(info.specification->getPlatformFile()->getStream()));
 
-                QFile file(outputFile);
+                // Attachment is written to the temporary file first, so no partially
+                // written file is left, if decoding fails
+                QSaveFile file(outputFile);
                 if (file.open(QFile::WriteOnly | QFile::Truncate))
                 {
-                    file.write(data);
-                    file.close();
+                    QByteArray buffer(64 * 1024, 0);
+                    qint64 bytesRead = 0;
+                    while ((bytesRead = device.read(buffer.data(), buffer.size())) > 0)
+                    {
+                        file.write(buffer.constData(), bytesRead);
+                    }
+
+                    if (bytesRead < 0)
+                    {
+                        file.cancelWriting();
+                        PDFConsole::writeError(PDFToolTranslationContext::tr("Failed to save attachment to file. %1").arg(device.errorString()), options.outputCodec);
+                        return ErrorFailedWriteToFile;
+                    }
+
+                    if (!file.commit())
+                    {
+                        PDFConsole::writeError(PDFToolTranslationContext::tr("Failed to save attachment to file. %1").arg(file.errorString()), options.outputCodec);
+                        return ErrorFailedWriteToFile;
+                    }
                 }
                 else
                 {
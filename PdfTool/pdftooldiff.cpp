@@ -46,102 +46,165 @@ QString PDFToolDiff::getStandardString(PDFToolAbstractApplication::StandardStrin
     return QString();
 }
 
+static void writeDiffResult(const pdf::PDFDiffResult& result, const QString& title, const PDFToolOptions& options)
+{
+    QLocale locale;
+
+    PDFOutputFormatter formatter(options.outputStyle);
+    formatter.beginDocument("diff", title);
+    formatter.endl();
+
+    formatter.beginTable("differences", PDFToolTranslationContext::tr("Differences"));
+
+    formatter.beginTableHeaderRow("header");
+    formatter.writeTableHeaderColumn("no", PDFToolTranslationContext::tr("No."), Qt::AlignLeft);
+    formatter.writeTableHeaderColumn("type", PDFToolTranslationContext::tr("Type"), Qt::AlignLeft);
+    formatter.writeTableHeaderColumn("left-page-number", PDFToolTranslationContext::tr("Left Page"), Qt::AlignLeft);
+    formatter.writeTableHeaderColumn("right-page-number", PDFToolTranslationContext::tr("Right Page"), Qt::AlignLeft);
+    formatter.writeTableHeaderColumn("description", PDFToolTranslationContext::tr("Description"), Qt::AlignLeft);
+    formatter.endTableHeaderRow();
+
+    const size_t size = result.getDifferencesCount();
+    for (size_t i = 0; i < size; ++i)
+    {
+        pdf::PDFInteger leftPageIndex = result.getLeftPage(i);
+        pdf::PDFInteger rightPageIndex = result.getRightPage(i);
+
+        QString leftPageDescription = leftPageIndex != -1 ? locale.toString(leftPageIndex + 1) : QString();
+        QString rightPageDescription = rightPageIndex != -1 ? locale.toString(rightPageIndex + 1) : QString();
+
+        formatter.beginTableRow("difference", int(i));
+        formatter.writeTableColumn("no", locale.toString(i + 1), Qt::AlignRight);
+        formatter.writeTableColumn("type", result.getTypeDescription(i), Qt::AlignLeft);
+        formatter.writeTableColumn("left-page-number", leftPageDescription, Qt::AlignRight);
+        formatter.writeTableColumn("right-page-number", rightPageDescription, Qt::AlignRight);
+        formatter.writeTableColumn("description", result.getMessage(i), Qt::AlignLeft);
+        formatter.endTableRow();
+    }
+
+    formatter.endTable();
+    formatter.endDocument();
+
+    if (options.outputStyle == PDFOutputFormatter::Style::Xml)
+    {
+        QString xml;
+        result.saveToXML(&xml);
+        PDFConsole::writeText(xml, options.outputCodec);
+    }
+    else
+    {
+        PDFConsole::writeText(formatter.getString(), options.outputCodec);
+    }
+}
+
 int PDFToolDiff::execute(const PDFToolOptions& options)
 {
-    if (options.diffFiles.size() != 2)
+    if (options.diffFiles.size() < 2)
     {
-        PDFConsole::writeError(PDFToolTranslationContext::tr("Exactly two documents must be specified."), options.outputCodec);
+        PDFConsole::writeError(PDFToolTranslationContext::tr("At least two documents must be specified."), options.outputCodec);
         return ErrorInvalidArguments;
     }
 
     pdf::PDFDocumentReader reader(nullptr, [](bool* ok) { *ok = false; return QString(); }, options.permissiveReading, false);
 
-    pdf::PDFDocument leftDocument = reader.readFromFile(options.diffFiles.front());
-    if (reader.getReadingResult() != pdf::PDFDocumentReader::Result::OK)
+    std::vector<pdf::PDFDocument> documents;
+    documents.reserve(options.diffFiles.size());
+    for (const QString& fileName : options.diffFiles)
     {
-        PDFConsole::writeError(PDFToolTranslationContext::tr("Cannot open document '%1'.").arg(options.diffFiles.front()), options.outputCodec);
-        return ErrorDocumentReading;
+        pdf::PDFDocument document = reader.readFromFile(fileName);
+        if (reader.getReadingResult() != pdf::PDFDocumentReader::Result::OK)
+        {
+            PDFConsole::writeError(PDFToolTranslationContext::tr("Cannot open document '%1'.").arg(fileName), options.outputCodec);
+            return ErrorDocumentReading;
+        }
+        documents.emplace_back(std::move(document));
     }
 
-    pdf::PDFDocument rightDocument = reader.readFromFile(options.diffFiles.back());
-    if (reader.getReadingResult() != pdf::PDFDocumentReader::Result::OK)
+    // Load fingerprint stores, if they exist. Stores, which do not
+    // match the document, are recalculated during comparation.
+    std::vector<pdf::PDFDiffFingerprintStore> fingerprintStores(documents.size());
+    if (options.diffUseFingerprints)
     {
-        PDFConsole::writeError(PDFToolTranslationContext::tr("Cannot open document '%1'.").arg(options.diffFiles.back()), options.outputCodec);
-        return ErrorDocumentReading;
+        for (size_t i = 0; i < documents.size(); ++i)
+        {
+            fingerprintStores[i].loadFromFile(pdf::PDFDiffFingerprintStore::getDefaultFileName(options.diffFiles[int(i)]));
+        }
     }
 
+    const pdf::PDFDocument& leftDocument = documents.front();
+
     pdf::PDFClosedIntervalSet leftPages;
     leftPages.addInterval(0, leftDocument.getCatalog()->getPageCount() - 1);
 
-    pdf::PDFClosedIntervalSet rightPages;
-    rightPages.addInterval(0, rightDocument.getCatalog()->getPageCount() - 1);
-
     pdf::PDFDiff diff(nullptr);
     diff.setOption(pdf::PDFDiff::Asynchronous, false);
+    diff.setHashAlgorithm(options.diffFastHash ? pdf::PDFPrecompiledPage::HashAlgorithm::Fast : pdf::PDFPrecompiledPage::HashAlgorithm::Sha512);
     diff.setLeftDocument(&leftDocument);
-    diff.setRightDocument(&rightDocument);
     diff.setPagesForLeftDocument(std::move(leftPages));
-    diff.setPagesForRightDocument(std::move(rightPages));
-    diff.start();
+    diff.setLeftFingerprintStore(options.diffUseFingerprints ? &fingerprintStores.front() : nullptr);
 
-    QLocale locale;
+    std::vector<pdf::PDFDiffResult> results;
+    if (documents.size() == 2)
+    {
+        const pdf::PDFDocument& rightDocument = documents.back();
 
-    const pdf::PDFDiffResult& result = diff.getResult();
-    if (result.getResult())
+        pdf::PDFClosedIntervalSet rightPages;
+        rightPages.addInterval(0, rightDocument.getCatalog()->getPageCount() - 1);
+
+        diff.setRightDocument(&rightDocument);
+        diff.setPagesForRightDocument(std::move(rightPages));
+        diff.setRightFingerprintStore(options.diffUseFingerprints ? &fingerprintStores.back() : nullptr);
+        diff.start();
+
+        results.push_back(diff.getResult());
+    }
+    else
     {
-        PDFOutputFormatter formatter(options.outputStyle);
-        formatter.beginDocument("diff", PDFToolTranslationContext::tr("Difference Report").arg(options.document));
-        formatter.endl();
-
-        formatter.beginTable("differences", PDFToolTranslationContext::tr("Differences"));
-
-        formatter.beginTableHeaderRow("header");
-        formatter.writeTableHeaderColumn("no", PDFToolTranslationContext::tr("No."), Qt::AlignLeft);
-        formatter.writeTableHeaderColumn("type", PDFToolTranslationContext::tr("Type"), Qt::AlignLeft);
-        formatter.writeTableHeaderColumn("left-page-number", PDFToolTranslationContext::tr("Left Page"), Qt::AlignLeft);
-        formatter.writeTableHeaderColumn("right-page-number", PDFToolTranslationContext::tr("Right Page"), Qt::AlignLeft);
-        formatter.writeTableHeaderColumn("description", PDFToolTranslationContext::tr("Description"), Qt::AlignLeft);
-        formatter.endTableHeaderRow();
-
-        const size_t size = result.getDifferencesCount();
-        for (size_t i = 0; i < size; ++i)
+        // Compare baseline (left document) with all other documents
+        std::vector<const pdf::PDFDocument*> rightDocuments;
+        for (auto it = std::next(documents.cbegin()); it != documents.cend(); ++it)
         {
-            pdf::PDFInteger leftPageIndex = result.getLeftPage(i);
-            pdf::PDFInteger rightPageIndex = result.getRightPage(i);
-
-            QString leftPageDescription = leftPageIndex != -1 ? locale.toString(leftPageIndex + 1) : QString();
-            QString rightPageDescription = rightPageIndex != -1 ? locale.toString(rightPageIndex + 1) : QString();
-
-            formatter.beginTableRow("difference", int(i));
-            formatter.writeTableColumn("no", locale.toString(i + 1), Qt::AlignRight);
-            formatter.writeTableColumn("type", result.getTypeDescription(i), Qt::AlignLeft);
-            formatter.writeTableColumn("left-page-number", leftPageDescription, Qt::AlignRight);
-            formatter.writeTableColumn("right-page-number", rightPageDescription, Qt::AlignRight);
-            formatter.writeTableColumn("description", result.getMessage(i), Qt::AlignLeft);
-            formatter.endTableRow();
+            rightDocuments.push_back(&*it);
         }
 
-        formatter.endTable();
-        formatter.endDocument();
+        results = diff.compareMany(rightDocuments);
+    }
+
+    if (options.diffUseFingerprints)
+    {
+        for (size_t i = 0; i < fingerprintStores.size(); ++i)
+        {
+            const pdf::PDFDiffFingerprintStore& store = fingerprintStores[i];
+            const QString fileName = pdf::PDFDiffFingerprintStore::getDefaultFileName(options.diffFiles[int(i)]);
+            if (!store.isEmpty() && !store.saveToFile(fileName))
+            {
+                PDFConsole::writeError(PDFToolTranslationContext::tr("Cannot save page fingerprints to file '%1'.").arg(fileName), options.outputCodec);
+            }
+        }
+    }
 
-        if (options.outputStyle == PDFOutputFormatter::Style::Xml)
+    int exitCode = ExitSuccess;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const pdf::PDFDiffResult& result = results[i];
+        if (result.getResult())
         {
-            QString xml;
-            result.saveToXML(&xml);
-            PDFConsole::writeText(xml, options.outputCodec);
+            QString title = PDFToolTranslationContext::tr("Difference Report");
+            if (results.size() > 1)
+            {
+                title = PDFToolTranslationContext::tr("Difference Report (%1)").arg(options.diffFiles[int(i + 1)]);
+            }
+
+            writeDiffResult(result, title, options);
         }
         else
         {
-            PDFConsole::writeText(formatter.getString(), options.outputCodec);
+            PDFConsole::writeError(result.getResult().getErrorMessage(), options.outputCodec);
+            exitCode = ErrorUnknown;
         }
     }
-    else
-    {
-        PDFConsole::writeError(result.getResult().getErrorMessage(), options.outputCodec);
-        return ErrorUnknown;
-    }
 
-    return ExitSuccess;
+    return exitCode;
 }
 
 PDFToolAbstractApplication::Options PDFToolDiff::getOptionsFlags() const
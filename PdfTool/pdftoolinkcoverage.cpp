@@ -83,7 +83,88 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
                                              &inkMapper,
                                              nullptr,
                                              pdf::PDFTransparencyRendererSettings());
-    calculator.perform(QSize(1920, 1920), pageIndices);
+
+    if (options.inkCoveragePreview)
+    {
+        pdf::PDFInkCoverageCalculator::CoarseToFineSettings coarseToFineSettings;
+        coarseToFineSettings.enabled = true;
+        coarseToFineSettings.totalAreaCoverageLimit = options.inkCoverageTotalAreaCoverageLimit / 100.0;
+        calculator.setCoarseToFineSettings(coarseToFineSettings);
+    }
+
+    calculator.setTileMemoryLimit(size_t(options.inkCoverageTileMemoryLimit) * 1024 * 1024);
+
+    QLocale locale;
+
+    // Pages are calculated in parallel, but streamed output is written in page order,
+    // so pages finished sooner than their predecessors are held back. Calculator
+    // calls the callback for each page, so no page is held back forever.
+    std::map<pdf::PDFInteger, QString> pendingPageLines;
+    size_t nextStreamedPage = 0;
+
+    if (options.inkCoverageStream)
+    {
+        calculator.setPageCoverageCallback([&](pdf::PDFInteger pageIndex,
+                                               const std::vector<pdf::PDFInkCoverageCalculator::InkCoverageChannelInfo>& coverage,
+                                               const pdf::PDFInkCoverageCalculator::PageCoverageInfo& coverageInfo)
+        {
+            // Each page is written as a separate document in the selected output style
+            PDFOutputFormatter pageFormatter(options.outputStyle);
+            pageFormatter.beginDocument("ink-coverage-page", PDFToolTranslationContext::tr("Ink Coverage of Page %1").arg(locale.toString(pageIndex + 1)));
+            pageFormatter.beginTable("ink-coverage-page", PDFToolTranslationContext::tr("Ink Coverage of Page %1").arg(locale.toString(pageIndex + 1)));
+
+            pageFormatter.beginTableHeaderRow("header");
+            pageFormatter.writeTableHeaderColumn("page-no", PDFToolTranslationContext::tr("Page No."), Qt::AlignLeft);
+            for (const auto& info : coverage)
+            {
+                pageFormatter.writeTableHeaderColumn(QString("%1-ratio").arg(QString::fromLatin1(info.name)), PDFToolTranslationContext::tr("%1 Ratio [%]").arg(info.textName), Qt::AlignLeft);
+            }
+            pageFormatter.writeTableHeaderColumn("max-tac", PDFToolTranslationContext::tr("Max. TAC [%]"), Qt::AlignLeft);
+            pageFormatter.writeTableHeaderColumn("preview", PDFToolTranslationContext::tr("Preview"), Qt::AlignLeft);
+            pageFormatter.endTableHeaderRow();
+
+            pageFormatter.beginTableRow("page-coverage", pageIndex + 1);
+            pageFormatter.writeTableColumn("page-no", locale.toString(pageIndex + 1), Qt::AlignRight);
+            for (const auto& info : coverage)
+            {
+                pageFormatter.writeTableColumn(QString("%1-ratio").arg(QString::fromLatin1(info.name)), locale.toString(info.ratio * 100.0, 'f', 2), Qt::AlignRight);
+            }
+
+            if (!coverage.empty())
+            {
+                pageFormatter.writeTableColumn("max-tac", locale.toString(coverageInfo.maximalTotalAreaCoverage * 100.0, 'f', 2), Qt::AlignRight);
+                pageFormatter.writeTableColumn("preview", coverageInfo.isPreview ? PDFToolTranslationContext::tr("Yes") : PDFToolTranslationContext::tr("No"), Qt::AlignRight);
+            }
+            else
+            {
+                // Coverage of the page can't be calculated
+                pageFormatter.writeTableColumn("max-tac", QString(), Qt::AlignRight);
+                pageFormatter.writeTableColumn("preview", QString(), Qt::AlignRight);
+            }
+            pageFormatter.endTableRow();
+
+            pageFormatter.endTable();
+            pageFormatter.endDocument();
+
+            pendingPageLines[pageIndex] = pageFormatter.getString();
+
+            while (nextStreamedPage < pageIndices.size())
+            {
+                auto it = pendingPageLines.find(pageIndices[nextStreamedPage]);
+                if (it == pendingPageLines.end())
+                {
+                    break;
+                }
+
+                PDFConsole::writeText(it->second, options.outputCodec);
+                pendingPageLines.erase(it);
+                ++nextStreamedPage;
+            }
+        });
+    }
+
+    calculator.perform(QSize(options.inkCoverageResolution, options.inkCoverageResolution), pageIndices);
+    calculator.setPageCoverageCallback(nullptr);
 
     fontCache.setCacheShrinkEnabled(nullptr, true);
 
@@ -93,7 +174,6 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
 
     formatter.beginTable("ink-coverage-by-page", PDFToolTranslationContext::tr("Ink Coverage by Page"));
 
-    QLocale locale;
     std::vector<pdf::PDFInkCoverageCalculator::InkCoverageChannelInfo> headerCoverage;
 
     for (const pdf::PDFInteger pageIndex : pageIndices)
@@ -122,6 +202,11 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
         formatter.writeTableHeaderColumn(QString("%1-ratio").arg(QString::fromLatin1(info.name)), PDFToolTranslationContext::tr("%1 Ratio [%]").arg(info.textName), Qt::AlignLeft);
         formatter.writeTableHeaderColumn(QString("%1-area").arg(QString::fromLatin1(info.name)), PDFToolTranslationContext::tr("%1 Covered [mm^2]").arg(info.textName), Qt::AlignLeft);
     }
+    formatter.writeTableHeaderColumn("max-tac", PDFToolTranslationContext::tr("Max. TAC [%]"), Qt::AlignLeft);
+    if (options.inkCoveragePreview)
+    {
+        formatter.writeTableHeaderColumn("preview", PDFToolTranslationContext::tr("Preview"), Qt::AlignLeft);
+    }
     formatter.endTableHeaderRow();
 
     for (const pdf::PDFInteger pageIndex : pageIndices)
@@ -155,6 +240,13 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
             }
         }
 
+        const pdf::PDFInkCoverageCalculator::PageCoverageInfo coverageInfo = calculator.getPageCoverageInfo(pageIndex);
+        formatter.writeTableColumn("max-tac", locale.toString(coverageInfo.maximalTotalAreaCoverage * 100.0, 'f', 2), Qt::AlignRight);
+        if (options.inkCoveragePreview)
+        {
+            formatter.writeTableColumn("preview", coverageInfo.isPreview ? PDFToolTranslationContext::tr("Yes") : PDFToolTranslationContext::tr("No"), Qt::AlignRight);
+        }
+
         formatter.endTableRow();
     }
 
@@ -169,6 +261,12 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
         formatter.writeTableColumn(QString("%1-area").arg(QString::fromLatin1(info.name)), locale.toString(channelInfo->coveredArea, 'f', 2), Qt::AlignRight);
     }
 
+    formatter.writeTableColumn("max-tac", QString(), Qt::AlignRight);
+    if (options.inkCoveragePreview)
+    {
+        formatter.writeTableColumn("preview", QString(), Qt::AlignRight);
+    }
+
     formatter.endTableRow();
 
     formatter.endTable();
@@ -181,7 +279,7 @@ int PDFToolInkCoverageApplication::execute(const PDFToolOptions& options)
 
 PDFToolAbstractApplication::Options PDFToolInkCoverageApplication::getOptionsFlags() const
 {
-    return ConsoleFormat | OpenDocument | PageSelector | ColorManagementSystem;
+    return ConsoleFormat | OpenDocument | PageSelector | ColorManagementSystem | InkCoverage;
 }
 
 }   // namespace pdftool
@@ -21,6 +21,7 @@
 
 #include <QColorSpace>
 #include <QElapsedTimer>
+#include <QThread>
 
 namespace pdftool
 {
@@ -74,24 +75,33 @@ void PDFToolRender::finish(const PDFToolOptions& options)
 void PDFToolRender::onPageRendered(const PDFToolOptions& options, pdf::PDFRenderedPageImage& renderedPageImage)
 {
     writePageInfoStatistics(renderedPageImage);
-    QString fileName = options.imageExportSettings.getOutputFileName(renderedPageImage.pageIndex, options.imageWriterSettings.getCurrentFormat());
 
-    QElapsedTimer imageWriterTimer;
-    imageWriterTimer.start();
+    const pdf::PDFInteger pageIndex = renderedPageImage.pageIndex;
+    QImage pageImage = qMove(renderedPageImage.pageImage);
 
-    QImageWriter imageWriter(fileName, options.imageWriterSettings.getCurrentFormat());
-    imageWriter.setSubType(options.imageWriterSettings.getCurrentSubtype());
-    imageWriter.setCompression(options.imageWriterSettings.getCompression());
-    imageWriter.setQuality(options.imageWriterSettings.getQuality());
-    imageWriter.setOptimizedWrite(options.imageWriterSettings.hasOptimizedWrite());
-    imageWriter.setProgressiveScanWrite(options.imageWriterSettings.hasProgressiveScanWrite());
-
-    if (!imageWriter.write(renderedPageImage.pageImage))
+    auto encodeImage = [this, &options, pageIndex, pageImage]()
     {
-        m_pageInfo[renderedPageImage.pageIndex].errors.emplace_back(pdf::PDFRenderError(pdf::RenderErrorType::Error, PDFToolTranslationContext::tr("Cannot write page image to file '%1', because: %2.").arg(fileName).arg(imageWriter.errorString())));
-    }
+        QString fileName = options.imageExportSettings.getOutputFileName(pageIndex, options.imageWriterSettings.getCurrentFormat());
+
+        QElapsedTimer imageWriterTimer;
+        imageWriterTimer.start();
+
+        QImageWriter imageWriter(fileName, options.imageWriterSettings.getCurrentFormat());
+        imageWriter.setSubType(options.imageWriterSettings.getCurrentSubtype());
+        imageWriter.setCompression(options.imageWriterSettings.getCompression());
+        imageWriter.setQuality(options.imageWriterSettings.getQuality());
+        imageWriter.setOptimizedWrite(options.imageWriterSettings.hasOptimizedWrite());
+        imageWriter.setProgressiveScanWrite(options.imageWriterSettings.hasProgressiveScanWrite());
 
-    m_pageInfo[renderedPageImage.pageIndex].pageWriteTime = imageWriterTimer.elapsed();
+        if (!imageWriter.write(pageImage))
+        {
+            m_pageInfo[pageIndex].errors.emplace_back(pdf::PDFRenderError(pdf::RenderErrorType::Error, PDFToolTranslationContext::tr("Cannot write page image to file '%1', because: %2.").arg(fileName).arg(imageWriter.errorString())));
+        }
+
+        m_pageInfo[pageIndex].pageWriteTime = imageWriterTimer.elapsed();
+    };
+
+    enqueueEncodeTask(pageIndex, encodeImage);
 }
 
 QString PDFToolBenchmark::getStandardString(PDFToolAbstractApplication::StandardString standardString) const
@@ -225,12 +235,21 @@ int PDFToolRenderBase::execute(const PDFToolOptions& options)
         return QSize();
     };
 
+    // Encoder threads are shared with rasterizers, so we use only
+    // half of the threads. Number of images waiting for encoding is limited.
+    const int encoderThreadCount = qMax(QThread::idealThreadCount() / 2, 1);
+    const int encoderSlotCount = 2 * encoderThreadCount;
+    m_encoderPool.setMaxThreadCount(encoderThreadCount);
+    m_encoderSlots.release(encoderSlotCount);
+
     QElapsedTimer timer;
     timer.start();
 
-    rasterizerPool.render(pageIndices, imageSizeGetter, std::bind(&PDFToolRenderBase::onPageRendered, this, options, std::placeholders::_1), nullptr);
+    rasterizerPool.render(pageIndices, imageSizeGetter, std::bind(&PDFToolRenderBase::onPageRendered, this, std::cref(options), std::placeholders::_1), nullptr);
+    m_encoderPool.waitForDone();
 
     m_wallTime = timer.elapsed();
+    m_encoderSlots.acquire(encoderSlotCount);
 
     fontCache.setCacheShrinkEnabled(nullptr, true);
 
@@ -238,6 +257,20 @@ int PDFToolRenderBase::execute(const PDFToolOptions& options)
     return ExitSuccess;
 }
 
+void PDFToolRenderBase::enqueueEncodeTask(pdf::PDFInteger pageIndex, std::function<void()> task)
+{
+    QElapsedTimer waitTimer;
+    waitTimer.start();
+    m_encoderSlots.acquire();
+    m_pageInfo[pageIndex].pageEncodeWaitTime = waitTimer.elapsed();
+
+    m_encoderPool.start([this, task = qMove(task)]()
+    {
+        task();
+        m_encoderSlots.release();
+    });
+}
+
 void PDFToolRenderBase::writePageInfoStatistics(const pdf::PDFRenderedPageImage& renderedPageImage)
 {
     PageInfo& info = m_pageInfo[renderedPageImage.pageIndex];
@@ -258,6 +291,7 @@ void PDFToolRenderBase::writeStatistics(PDFOutputFormatter& formatter)
     qint64 pageRenderTime = 0;
     qint64 pageTotalTime = 0;
     qint64 pageWriteTime = 0;
+    qint64 pageEncodeWaitTime = 0;
 
     for (const PageInfo& info : m_pageInfo)
     {
@@ -272,6 +306,7 @@ void PDFToolRenderBase::writeStatistics(PDFOutputFormatter& formatter)
         pageRenderTime += info.pageRenderTime;
         pageTotalTime += info.pageTotalTime + info.pageWriteTime;
         pageWriteTime += info.pageWriteTime;
+        pageEncodeWaitTime += info.pageEncodeWaitTime;
     }
 
     if (pagesRendered > 0 && pageTotalTime > 0 && m_wallTime > 0)
@@ -308,6 +343,7 @@ void PDFToolRenderBase::writeStatistics(PDFOutputFormatter& formatter)
         writeValue("render-time", PDFToolTranslationContext::tr("Total render time"), locale.toString(pageRenderTime), PDFToolTranslationContext::tr("msec"));
         writeValue("wait-time", PDFToolTranslationContext::tr("Total wait time"), locale.toString(pageWaitTime), PDFToolTranslationContext::tr("msec"));
         writeValue("write-time", PDFToolTranslationContext::tr("Total write time"), locale.toString(pageWriteTime), PDFToolTranslationContext::tr("msec"));
+        writeValue("encode-wait-time", PDFToolTranslationContext::tr("Total encoder queue wait time"), locale.toString(pageEncodeWaitTime), PDFToolTranslationContext::tr("msec"));
         writeValue("total-time", PDFToolTranslationContext::tr("Total time"), locale.toString(pageTotalTime), PDFToolTranslationContext::tr("msec"));
         writeValue("wall-time", PDFToolTranslationContext::tr("Wall time"), locale.toString(m_wallTime), PDFToolTranslationContext::tr("msec"));
         writeValue("pages-per-second-core", PDFToolTranslationContext::tr("Rendering speed (per core)"), locale.toString(renderingSpeedPerCore, 'f', 3), PDFToolTranslationContext::tr("pages / sec (one core)"));
@@ -332,6 +368,7 @@ void PDFToolRenderBase::writePageStatistics(PDFOutputFormatter& formatter)
     formatter.writeTableHeaderColumn("render-time", PDFToolTranslationContext::tr("Render Time [msec]"), Qt::AlignLeft);
     formatter.writeTableHeaderColumn("wait-time", PDFToolTranslationContext::tr("Wait Time [msec]"), Qt::AlignLeft);
     formatter.writeTableHeaderColumn("write-time", PDFToolTranslationContext::tr("Write Time [msec]"), Qt::AlignLeft);
+    formatter.writeTableHeaderColumn("encode-wait-time", PDFToolTranslationContext::tr("Encoder Wait Time [msec]"), Qt::AlignLeft);
     formatter.writeTableHeaderColumn("total-time", PDFToolTranslationContext::tr("Total Time [msec]"), Qt::AlignLeft);
     formatter.endTableHeaderRow();
 
@@ -350,6 +387,7 @@ void PDFToolRenderBase::writePageStatistics(PDFOutputFormatter& formatter)
         formatter.writeTableColumn("render-time", locale.toString(info.pageRenderTime), Qt::AlignRight);
         formatter.writeTableColumn("wait-time", locale.toString(info.pageWaitTime), Qt::AlignRight);
         formatter.writeTableColumn("write-time", locale.toString(info.pageWriteTime), Qt::AlignRight);
+        formatter.writeTableColumn("encode-wait-time", locale.toString(info.pageEncodeWaitTime), Qt::AlignRight);
         formatter.writeTableColumn("total-time", locale.toString(info.pageTotalTime), Qt::AlignRight);
         formatter.endTableRow();
     }
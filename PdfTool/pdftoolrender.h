@@ -21,6 +21,11 @@
 #include "pdftoolabstractapplication.h"
 #include "pdfexception.h"
 
+#include <QSemaphore>
+#include <QThreadPool>
+
+#include <functional>
+
 namespace pdftool
 {
 
@@ -39,6 +44,14 @@ protected:
     void writePageStatistics(PDFOutputFormatter& formatter);
     void writeErrors(PDFOutputFormatter& formatter);
 
+    /// Enqueues image encoding task into the encoder thread pool, so encoding
+    /// doesn't compete with rasterization. If too many images are waiting
+    /// for encoding, calling thread is blocked until a slot is freed, which
+    /// bounds memory held by rendered images.
+    /// \param pageIndex Page index
+    /// \param task Encoding task
+    void enqueueEncodeTask(pdf::PDFInteger pageIndex, std::function<void()> task);
+
     struct PageInfo
     {
         bool isRendered = false;
@@ -48,11 +61,15 @@ protected:
         qint64 pageRenderTime = 0;
         qint64 pageTotalTime = 0;
         qint64 pageWriteTime = 0;
+        qint64 pageEncodeWaitTime = 0;
         std::vector<pdf::PDFRenderError> errors;
     };
 
     std::vector<PageInfo> m_pageInfo;
     qint64 m_wallTime = 0;
+
+    QThreadPool m_encoderPool;
+    QSemaphore m_encoderSlots;
 };
 
 class PDFToolRender : public PDFToolRenderBase
@@ -18,11 +18,14 @@
 #include "pdftoolseparate.h"
 #include "pdfdocumentbuilder.h"
 #include "pdfexception.h"
-#include "pdfoptimizer.h"
 #include "pdfdocumentwriter.h"
+#include "pdfobjectutils.h"
+#include "pdfexecutionpolicy.h"
 
 #include <QFileInfo>
 
+#include <algorithm>
+
 namespace pdftool
 {
 
@@ -73,6 +76,10 @@ int PDFToolSeparate::execute(const PDFToolOptions& options)
         return ErrorInvalidArguments;
     }
 
+    // Each page is extracted only once, even if it is in the page range multiple times
+    std::set<pdf::PDFInteger> uniquePageIndices;
+    pageIndices.erase(std::remove_if(pageIndices.begin(), pageIndices.end(), [&uniquePageIndices](pdf::PDFInteger pageIndex) { return !uniquePageIndices.insert(pageIndex).second; }), pageIndices.end());
+
     if (options.separatePagePattern.isEmpty())
     {
         PDFConsole::writeError(PDFToolTranslationContext::tr("File template is empty."), options.outputCodec);
@@ -85,48 +92,195 @@ int PDFToolSeparate::execute(const PDFToolOptions& options)
         return ErrorInvalidArguments;
     }
 
-    for (pdf::PDFInteger pageIndex : pageIndices)
+    // Prepare the document for splitting. Page tree is flattened and emptied, so page
+    // tree root doesn't refer to other pages and each page refers only to objects
+    // it really uses. Document level items referring to other pages are removed.
+    pdf::PDFDocument baseDocument;
+    std::vector<pdf::PDFObjectReference> pageReferences;
+    try
+    {
+        pdf::PDFDocumentBuilder documentBuilder(&document);
+        documentBuilder.flattenPageTree();
+        pageReferences = documentBuilder.getPages();
+        documentBuilder.setPages({ });
+        documentBuilder.removeOutline();
+        documentBuilder.removeThreads();
+        documentBuilder.removeDocumentActions();
+        documentBuilder.removeStructureTree();
+        baseDocument = documentBuilder.build();
+    }
+    catch (const pdf::PDFException &exception)
+    {
+        PDFConsole::writeError(exception.getMessage(), options.outputCodec);
+        return ErrorDocumentReading;
+    }
+
+    const pdf::PDFObjectStorage& storage = baseDocument.getStorage();
+    const pdf::PDFObject& trailerDictionary = storage.getTrailerDictionary();
+    const pdf::PDFObject& pageTreeRootObject = storage.getDictionaryFromObject(baseDocument.getTrailerDictionary()->get("Root"))->get("Pages");
+    const pdf::PDFObjectReference pageTreeRoot = pageTreeRootObject.isReference() ? pageTreeRootObject.getReference() : pdf::PDFObjectReference();
+
+    // Objects reachable from the trailer are shared by all single page documents. They
+    // get the same object numbers in each document, so they are renumbered (and serialized,
+    // if document is not encrypted) only once.
+    std::set<pdf::PDFObjectReference> sharedReferenceSet = pdf::PDFObjectUtils::getReferences({ trailerDictionary }, storage);
+    std::vector<pdf::PDFObjectReference> sharedReferences(sharedReferenceSet.cbegin(), sharedReferenceSet.cend());
+    std::map<pdf::PDFObjectReference, pdf::PDFObjectReference> sharedReferenceMapping;
+    for (size_t i = 0; i < sharedReferences.size(); ++i)
+    {
+        sharedReferenceMapping[sharedReferences[i]] = pdf::PDFObjectReference(pdf::PDFInteger(i + 1), 0);
+    }
+
+    const bool isEncrypted = storage.getSecurityHandler()->getMode() != pdf::EncryptionMode::None;
+    std::vector<pdf::PDFObject> sharedObjects(sharedReferences.size() + 1);
+    std::vector<QByteArray> serializedObjects(isEncrypted ? 0 : sharedObjects.size());
+    pdf::PDFIntegerRange<size_t> sharedRange(0, sharedReferences.size());
+    auto renumberSharedObject = [&](size_t i)
+    {
+        sharedObjects[i + 1] = pdf::PDFObjectUtils::replaceReferences(storage.getObject(sharedReferences[i]), sharedReferenceMapping);
+
+        // Page tree root is different in each document
+        if (!isEncrypted && sharedReferences[i] != pageTreeRoot)
+        {
+            serializedObjects[i + 1] = pdf::PDFDocumentWriter::getSerializedObject(sharedObjects[i + 1]);
+        }
+    };
+    pdf::PDFExecutionPolicy::execute(pdf::PDFExecutionPolicy::Scope::Page, sharedRange.begin(), sharedRange.end(), renumberSharedObject);
+    pdf::PDFObject sharedTrailerDictionary = pdf::PDFObjectUtils::replaceReferences(trailerDictionary, sharedReferenceMapping);
+
+    // Returns objects referenced from the page (including the page itself),
+    // which are not shared by all documents.
+    auto getPageObjects = [&storage, &sharedReferenceSet](pdf::PDFObjectReference pageReference)
+    {
+        std::set<pdf::PDFObjectReference> references;
+        std::vector<pdf::PDFObjectReference> stack = { pageReference };
+
+        while (!stack.empty())
+        {
+            pdf::PDFObjectReference reference = stack.back();
+            stack.pop_back();
+
+            if (sharedReferenceSet.count(reference) || !references.insert(reference).second)
+            {
+                continue;
+            }
+
+            for (const pdf::PDFObjectReference& directReference : pdf::PDFObjectUtils::getDirectReferences(storage.getObject(reference)))
+            {
+                stack.push_back(directReference);
+            }
+        }
+
+        return std::vector<pdf::PDFObjectReference>(references.cbegin(), references.cend());
+    };
+
+    std::vector<QString> errors(pageIndices.size());
+    pdf::PDFIntegerRange<size_t> pageRange(0, pageIndices.size());
+    auto separatePage = [&](size_t i)
     {
+        const pdf::PDFInteger pageIndex = pageIndices[i];
+
+        QString fileName = options.separatePagePattern;
+        fileName.replace('%', QString::number(pageIndex + 1));
+
+        if (QFileInfo::exists(fileName))
+        {
+            errors[i] = PDFToolTranslationContext::tr("File '%1' already exists. Page %2 was not extracted.").arg(fileName).arg(pageIndex + 1);
+            return;
+        }
+
         try
         {
-            pdf::PDFDocumentBuilder documentBuilder(&document);
-            documentBuilder.flattenPageTree();
-            std::vector<pdf::PDFObjectReference> pageReferences = documentBuilder.getPages();
-            std::vector<pdf::PDFObjectReference> singlePageRef = { pageReferences[pageIndex] };
-            documentBuilder.setPages(singlePageRef);
-            documentBuilder.removeOutline();
-            documentBuilder.removeThreads();
-            documentBuilder.removeDocumentActions();
-            documentBuilder.removeStructureTree();
-
-            pdf::PDFDocument singlePageDocument = documentBuilder.build();
-
-            // Optimize document - remove unused objects and shrink object storage
-            pdf::PDFOptimizer optimizer(pdf::PDFOptimizer::RemoveUnusedObjects | pdf::PDFOptimizer::ShrinkObjectStorage, nullptr);
-            optimizer.setDocument(&singlePageDocument);
-            optimizer.optimize();
-            singlePageDocument = optimizer.takeOptimizedDocument();
-
-            QString fileName = options.separatePagePattern;
-            fileName.replace('%', QString::number(pageIndex + 1));
-
-            if (QFileInfo::exists(fileName))
+            std::vector<pdf::PDFObjectReference> pageObjectReferences = getPageObjects(pageReferences[pageIndex]);
+
+            // Mapping of page objects, shared objects are mapped using shared mapping
+            std::map<pdf::PDFObjectReference, pdf::PDFObjectReference> referenceMapping;
+            for (size_t j = 0; j < pageObjectReferences.size(); ++j)
             {
-                PDFConsole::writeError(PDFToolTranslationContext::tr("File '%1' already exists. Page %2 was not extracted.").arg(fileName).arg(pageIndex + 1), options.outputCodec);
+                referenceMapping[pageObjectReferences[j]] = pdf::PDFObjectReference(pdf::PDFInteger(sharedObjects.size() + j), 0);
             }
-            else
+
+            auto getMappedReference = [&referenceMapping, &sharedReferenceMapping](pdf::PDFObjectReference reference)
             {
-                pdf::PDFDocumentWriter writer(nullptr);
-                pdf::PDFOperationResult result = writer.write(fileName, &singlePageDocument, false);
-                if (!result)
+                auto it = referenceMapping.find(reference);
+                if (it != referenceMapping.cend())
                 {
-                    PDFConsole::writeError(result.getErrorMessage(), options.outputCodec);
+                    return it->second;
                 }
+
+                auto sharedIt = sharedReferenceMapping.find(reference);
+                if (sharedIt != sharedReferenceMapping.cend())
+                {
+                    return sharedIt->second;
+                }
+
+                return pdf::PDFObjectReference();
+            };
+
+            pdf::PDFObjectStorage::PDFObjects objects;
+            objects.reserve(sharedObjects.size() + pageObjectReferences.size());
+            for (const pdf::PDFObject& object : sharedObjects)
+            {
+                objects.emplace_back(0, object);
+            }
+            for (const pdf::PDFObjectReference& reference : pageObjectReferences)
+            {
+                objects.emplace_back(0, pdf::PDFObjectUtils::replaceReferences(storage.getObject(reference), referenceMapping, sharedReferenceMapping));
+            }
+
+            // Page tree root contains just the single page
+            const pdf::PDFObjectReference mappedPageTreeRoot = getMappedReference(pageTreeRoot);
+            if (mappedPageTreeRoot.isValid())
+            {
+                pdf::PDFObjectFactory factory;
+                factory.beginDictionary();
+                factory.beginDictionaryItem("Kids");
+                factory.beginArray();
+                factory << getMappedReference(pageReferences[pageIndex]);
+                factory.endArray();
+                factory.endDictionaryItem();
+                factory.beginDictionaryItem("Count");
+                factory << pdf::PDFInteger(1);
+                factory.endDictionaryItem();
+                factory.endDictionary();
+
+                pdf::PDFObjectStorage::Entry& entry = objects[mappedPageTreeRoot.objectNumber];
+                entry.object = pdf::PDFObjectManipulator::merge(entry.object, factory.takeObject(), pdf::PDFObjectManipulator::NoFlag);
+            }
+
+            pdf::PDFObjectFactory factory;
+            factory.beginDictionary();
+            factory.beginDictionaryItem("Size");
+            factory << pdf::PDFInteger(objects.size());
+            factory.endDictionaryItem();
+            factory.endDictionary();
+
+            // Storage copy is cheap, it is used to share the security handler
+            pdf::PDFObjectStorage singlePageStorage = storage;
+            singlePageStorage.setObjects(qMove(objects));
+            singlePageStorage.setTrailerDictionary(pdf::PDFObjectManipulator::merge(sharedTrailerDictionary, factory.takeObject(), pdf::PDFObjectManipulator::NoFlag));
+            pdf::PDFDocument singlePageDocument(qMove(singlePageStorage), baseDocument.getInfo()->version, QByteArray());
+
+            pdf::PDFDocumentWriter writer(nullptr);
+            writer.setSerializedObjects(&serializedObjects);
+            pdf::PDFOperationResult result = writer.write(fileName, &singlePageDocument, false);
+            if (!result)
+            {
+                errors[i] = result.getErrorMessage();
             }
         }
         catch (const pdf::PDFException &exception)
         {
-            PDFConsole::writeError(exception.getMessage(), options.outputCodec);
+            errors[i] = exception.getMessage();
+        }
+    };
+    pdf::PDFExecutionPolicy::execute(pdf::PDFExecutionPolicy::Scope::Page, pageRange.begin(), pageRange.end(), separatePage);
+
+    for (const QString& error : errors)
+    {
+        if (!error.isEmpty())
+        {
+            PDFConsole::writeError(error, options.outputCodec);
         }
     }
 
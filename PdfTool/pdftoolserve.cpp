@@ -0,0 +1,355 @@
+//    Copyright (C) 2024 Jakub Melka
+//
+//    This file is part of PDF4QT.
+//
+//    PDF4QT is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU Lesser General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    with the written consent of the copyright owner, any later version.
+//
+//    PDF4QT is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//    You should have received a copy of the GNU Lesser General Public License
+//    along with PDF4QT.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "pdftoolserve.h"
+#include "pdffont.h"
+#include "pdfoptionalcontent.h"
+#include "pdfconstants.h"
+#include "pdfdocumentreader.h"
+
+#include <QFileInfo>
+#include <QTextStream>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+namespace pdftool
+{
+
+static PDFToolServeApplication s_toolServeApplication;
+
+QString PDFToolServeApplication::getStandardString(PDFToolAbstractApplication::StandardString standardString) const
+{
+    switch (standardString)
+    {
+        case Command:
+            return "serve";
+
+        case Name:
+            return PDFToolTranslationContext::tr("Render service");
+
+        case Description:
+            return PDFToolTranslationContext::tr("Render pages on request. Requests are read from standard input, one JSON object per line, "
+                                                 "for example {\"document\": \"in.pdf\", \"pages\": \"1-3\", \"dpi\": 150, \"format\": \"png\", \"output\": \"page-%.png\"}. "
+                                                 "Documents are kept opened between requests.");
+
+        default:
+            Q_ASSERT(false);
+            break;
+    }
+
+    return QString();
+}
+
+int PDFToolServeApplication::execute(const PDFToolOptions& options)
+{
+    QTextStream input(stdin);
+    QString line;
+
+    while (input.readLineInto(&line))
+    {
+        line = line.trimmed();
+        if (line.isEmpty())
+        {
+            continue;
+        }
+
+        if (line == "quit")
+        {
+            break;
+        }
+
+        QJsonParseError parseError;
+        QJsonDocument requestDocument = QJsonDocument::fromJson(line.toUtf8(), &parseError);
+
+        QJsonObject response;
+        if (parseError.error != QJsonParseError::NoError || !requestDocument.isObject())
+        {
+            response["status"] = "error";
+            response["message"] = PDFToolTranslationContext::tr("Invalid request: %1").arg(parseError.errorString());
+        }
+        else
+        {
+            QJsonObject request = requestDocument.object();
+            response = processRequest(options, request);
+
+            if (request.contains("id"))
+            {
+                response["id"] = request["id"];
+            }
+        }
+
+        PDFConsole::writeText(QString::fromUtf8(QJsonDocument(response).toJson(QJsonDocument::Compact)) + "\n", options.outputCodec);
+    }
+
+    m_documents.clear();
+    return ExitSuccess;
+}
+
+PDFToolAbstractApplication::Options PDFToolServeApplication::getOptionsFlags() const
+{
+    return ConsoleFormat | ImageWriterSettings | ColorManagementSystem | RenderFlags | Serve;
+}
+
+PDFToolServeApplication::DocumentEntryPointer PDFToolServeApplication::getDocument(const PDFToolOptions& options,
+                                                                                   const QString& fileName,
+                                                                                   const QString& password,
+                                                                                   QString& errorMessage,
+                                                                                   QStringList& warnings)
+{
+    QFileInfo fileInfo(fileName);
+    QString canonicalFileName = fileInfo.canonicalFilePath();
+    QDateTime lastModified = fileInfo.lastModified();
+
+    if (canonicalFileName.isEmpty())
+    {
+        errorMessage = PDFToolTranslationContext::tr("File '%1' doesn't exist.").arg(fileName);
+        return nullptr;
+    }
+
+    for (auto it = m_documents.begin(); it != m_documents.end(); ++it)
+    {
+        if ((*it)->fileName == canonicalFileName)
+        {
+            DocumentEntryPointer entry = *it;
+
+            if (entry->lastModified != lastModified)
+            {
+                // Document was modified, we must read it again
+                m_documents.erase(it);
+                break;
+            }
+
+            if (entry->isEncrypted && entry->password != password)
+            {
+                // Password differs from the password, which was used to open
+                // the document, we must read the document again to check it.
+                break;
+            }
+
+            // Move entry to the front, it is the most recently used one
+            m_documents.erase(it);
+            m_documents.push_front(entry);
+            return entry;
+        }
+    }
+
+    DocumentEntryPointer entry = std::make_shared<DocumentEntry>();
+    entry->fileName = canonicalFileName;
+    entry->lastModified = lastModified;
+    entry->password = password;
+
+    // We do not use readDocument, because it writes errors to the console,
+    // and standard output is used for responses.
+    bool isFirstPasswordAttempt = true;
+    auto passwordCallback = [&password, &isFirstPasswordAttempt](bool* ok) -> QString
+    {
+        *ok = isFirstPasswordAttempt;
+        isFirstPasswordAttempt = false;
+        return password;
+    };
+    pdf::PDFDocumentReader reader(nullptr, passwordCallback, options.permissiveReading, false);
+    entry->document = std::make_unique<pdf::PDFDocument>();
+    *entry->document = reader.readFromFile(canonicalFileName);
+
+    switch (reader.getReadingResult())
+    {
+        case pdf::PDFDocumentReader::Result::OK:
+        {
+            break;
+        }
+
+        case pdf::PDFDocumentReader::Result::Cancelled:
+        {
+            errorMessage = PDFToolTranslationContext::tr("Cannot read document '%1'. Invalid password provided.").arg(fileName);
+            return nullptr;
+        }
+
+        case pdf::PDFDocumentReader::Result::Failed:
+        {
+            errorMessage = PDFToolTranslationContext::tr("Cannot read document '%1'. %2").arg(fileName, reader.getErrorMessage());
+            return nullptr;
+        }
+
+        default:
+        {
+            Q_ASSERT(false);
+            errorMessage = PDFToolTranslationContext::tr("Cannot read document '%1'.").arg(fileName);
+            return nullptr;
+        }
+    }
+
+    warnings = reader.getWarnings();
+
+    entry->isEncrypted = entry->document->getStorage().getSecurityHandler()->getMode() != pdf::EncryptionMode::None;
+
+    // Replace entry opened with another password
+    m_documents.remove_if([&canonicalFileName](const DocumentEntryPointer& item) { return item->fileName == canonicalFileName; });
+
+    entry->optionalContentActivity = std::make_unique<pdf::PDFOptionalContentActivity>(entry->document.get(), pdf::OCUsage::Export, nullptr);
+    entry->cmsManager = std::make_unique<pdf::PDFCMSManager>(nullptr);
+    entry->cmsManager->setDocument(entry->document.get());
+    entry->cmsManager->setSettings(options.cmsSettings);
+    entry->fontCache = std::make_unique<pdf::PDFFontCache>(pdf::DEFAULT_FONT_CACHE_LIMIT, pdf::DEFAULT_REALIZED_FONT_CACHE_LIMIT);
+    entry->fontCache->setDocument(pdf::PDFModifiedDocument(entry->document.get(), entry->optionalContentActivity.get()));
+    entry->rasterizerPool = std::make_unique<pdf::PDFRasterizerPool>(entry->document.get(), entry->fontCache.get(), entry->cmsManager.get(),
+                                                                     entry->optionalContentActivity.get(), options.renderFeatures, pdf::PDFMeshQualitySettings(),
+                                                                     pdf::PDFRasterizerPool::getCorrectedRasterizerCount(options.renderRasterizerCount),
+                                                                     options.renderUseSoftwareRendering ? pdf::RendererEngine::QPainter : pdf::RendererEngine::Blend2D_SingleThread, nullptr);
+
+    m_documents.push_front(entry);
+    while (m_documents.size() > size_t(qMax(options.serveDocumentCacheSize, 1)))
+    {
+        m_documents.pop_back();
+    }
+
+    return entry;
+}
+
+QJsonObject PDFToolServeApplication::processRequest(const PDFToolOptions& options, const QJsonObject& request)
+{
+    QJsonObject response;
+
+    auto setError = [&response](QString message)
+    {
+        response["status"] = "error";
+        response["message"] = qMove(message);
+        return response;
+    };
+
+    const QString fileName = request["document"].toString();
+    if (fileName.isEmpty())
+    {
+        return setError(PDFToolTranslationContext::tr("Document is not specified."));
+    }
+
+    QString errorMessage;
+    QStringList warnings;
+    DocumentEntryPointer entry = getDocument(options, fileName, request["password"].toString(), errorMessage, warnings);
+    if (!warnings.isEmpty())
+    {
+        response["warnings"] = QJsonArray::fromStringList(warnings);
+    }
+    if (!entry)
+    {
+        return setError(errorMessage);
+    }
+
+    const pdf::PDFInteger pageCount = entry->document->getCatalog()->getPageCount();
+
+    PDFToolOptions pageOptions;
+    pageOptions.pageSelectorSelection = request["pages"].toString();
+    std::vector<pdf::PDFInteger> pageIndices = pageOptions.getPageRange(pageCount, errorMessage, true);
+    if (!errorMessage.isEmpty())
+    {
+        return setError(errorMessage);
+    }
+
+    pdf::PDFImageWriterSettings imageWriterSettings = options.imageWriterSettings;
+    if (request.contains("format"))
+    {
+        QByteArray format = request["format"].toString().toLatin1();
+        if (!imageWriterSettings.getFormats().contains(format))
+        {
+            return setError(PDFToolTranslationContext::tr("Image format '%1' is not supported.").arg(QString::fromLatin1(format)));
+        }
+        imageWriterSettings.selectFormat(format);
+    }
+
+    const QByteArray format = imageWriterSettings.getCurrentFormat();
+    const QString outputTemplate = request["output"].toString();
+    if (outputTemplate.isEmpty())
+    {
+        return setError(PDFToolTranslationContext::tr("Output file name is not specified."));
+    }
+    if (pageIndices.size() > 1 && !outputTemplate.contains('%'))
+    {
+        return setError(PDFToolTranslationContext::tr("Output file name must contain '%' character if multiple pages are selected."));
+    }
+
+    const int dpi = request["dpi"].toInt(0);
+    const int pixels = request["pixels"].toInt(0);
+    if (dpi <= 0 && pixels <= 0)
+    {
+        return setError(PDFToolTranslationContext::tr("Resolution is not specified."));
+    }
+
+    auto imageSizeGetter = [dpi, pixels](const pdf::PDFPage* page) -> QSize
+    {
+        Q_ASSERT(page);
+
+        if (pixels > 0)
+        {
+            return page->getRotatedMediaBox().size().scaled(pixels, pixels, Qt::KeepAspectRatio).toSize();
+        }
+
+        QSizeF size = page->getRotatedMediaBox().size() * pdf::PDF_POINT_TO_INCH * dpi;
+        return size.toSize();
+    };
+
+    QMutex mutex;
+    QJsonArray files;
+    QJsonArray errors;
+
+    auto onRenderError = [&](pdf::PDFInteger pageIndex, pdf::PDFRenderError error)
+    {
+        QMutexLocker lock(&mutex);
+        errors.append(PDFToolTranslationContext::tr("Page %1: %2").arg(pageIndex + 1).arg(error.message));
+    };
+
+    auto processImage = [&](pdf::PDFRenderedPageImage& renderedPageImage)
+    {
+        QString pageFileName = outputTemplate;
+        pageFileName.replace('%', QString::number(renderedPageImage.pageIndex + 1));
+
+        QImageWriter imageWriter(pageFileName, format);
+        imageWriter.setSubType(imageWriterSettings.getCurrentSubtype());
+        imageWriter.setCompression(imageWriterSettings.getCompression());
+        imageWriter.setQuality(imageWriterSettings.getQuality());
+        imageWriter.setOptimizedWrite(imageWriterSettings.hasOptimizedWrite());
+        imageWriter.setProgressiveScanWrite(imageWriterSettings.hasProgressiveScanWrite());
+
+        const bool isWritten = imageWriter.write(renderedPageImage.pageImage);
+
+        QMutexLocker lock(&mutex);
+        if (isWritten)
+        {
+            files.append(pageFileName);
+        }
+        else
+        {
+            errors.append(PDFToolTranslationContext::tr("Cannot write page image to file '%1', because: %2.").arg(pageFileName, imageWriter.errorString()));
+        }
+    };
+
+    QObject holder;
+    QObject::connect(entry->rasterizerPool.get(), &pdf::PDFRasterizerPool::renderError, &holder, onRenderError, Qt::DirectConnection);
+
+    entry->fontCache->setCacheShrinkEnabled(nullptr, false);
+    entry->rasterizerPool->render(pageIndices, imageSizeGetter, processImage, nullptr);
+    entry->fontCache->setCacheShrinkEnabled(nullptr, true);
+
+    response["status"] = "ok";
+    response["files"] = files;
+    if (!errors.isEmpty())
+    {
+        response["errors"] = errors;
+    }
+
+    return response;
+}
+
+}   // namespace pdftool
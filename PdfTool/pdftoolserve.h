@@ -0,0 +1,87 @@
+//    Copyright (C) 2024 Jakub Melka
+//
+//    This file is part of PDF4QT.
+//
+//    PDF4QT is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU Lesser General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    with the written consent of the copyright owner, any later version.
+//
+//    PDF4QT is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//    You should have received a copy of the GNU Lesser General Public License
+//    along with PDF4QT.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PDFTOOLSERVE_H
+#define PDFTOOLSERVE_H
+
+#include "pdftoolabstractapplication.h"
+
+#include <QJsonObject>
+
+#include <list>
+#include <memory>
+
+namespace pdftool
+{
+
+/// Long-running render service. Requests are read from the standard input,
+/// one request per line in JSON format, and responses are written to
+/// the standard output, also one per line. Opened documents, together with their
+/// font caches, color management and rasterizer pools, are kept in a bounded
+/// LRU cache, so rendering pages of the same document repeatedly doesn't
+/// require parsing the document again.
+class PDFToolServeApplication : public PDFToolAbstractApplication
+{
+public:
+    virtual QString getStandardString(StandardString standardString) const override;
+    virtual int execute(const PDFToolOptions& options) override;
+    virtual Options getOptionsFlags() const override;
+
+private:
+    struct DocumentEntry
+    {
+        QString fileName;
+        QDateTime lastModified;
+        QString password;   ///< Password used to open the document
+        bool isEncrypted = false;
+        std::unique_ptr<pdf::PDFDocument> document;
+        std::unique_ptr<pdf::PDFOptionalContentActivity> optionalContentActivity;
+        std::unique_ptr<pdf::PDFCMSManager> cmsManager;
+        std::unique_ptr<pdf::PDFFontCache> fontCache;
+        std::unique_ptr<pdf::PDFRasterizerPool> rasterizerPool;
+    };
+
+    using DocumentEntryPointer = std::shared_ptr<DocumentEntry>;
+
+    /// Returns document entry for a given file. If document is already
+    /// opened and it was not modified, cached entry is returned, otherwise
+    /// document is read and least recently used entry is evicted,
+    /// if cache is full. Cached entry of encrypted document is returned
+    /// only, if the same password is used, otherwise document is read
+    /// again (and the password is checked). Nothing is written to the
+    /// standard output, as it is reserved for responses - errors and
+    /// warnings are returned to the caller.
+    /// \param options Options
+    /// \param fileName Document file name
+    /// \param password Document password
+    /// \param errorMessage Error message, if document can't be read
+    /// \param warnings Warnings, which occured during document reading
+    DocumentEntryPointer getDocument(const PDFToolOptions& options,
+                                     const QString& fileName,
+                                     const QString& password,
+                                     QString& errorMessage,
+                                     QStringList& warnings);
+
+    /// Processes single request and returns the response
+    QJsonObject processRequest(const PDFToolOptions& options, const QJsonObject& request);
+
+    std::list<DocumentEntryPointer> m_documents;
+};
+
+}   // namespace pdftool
+
+#endif // PDFTOOLSERVE_H
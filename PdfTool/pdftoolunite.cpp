@@ -22,6 +22,8 @@
 #include "pdfdocumentwriter.h"
 
 #include <QFileInfo>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrent>
 
 namespace pdftool
 {
@@ -78,78 +80,140 @@ int PDFToolUnite::execute(const PDFToolOptions& options)
         pdf::PDFObjectReference formMerged = documentBuilder.addObject(pdf::PDFObject());
         pdf::PDFObjectReference namesMerged = documentBuilder.addObject(pdf::PDFObject());
 
-        std::vector<pdf::PDFObjectReference> pages;
-        for (const QString& fileName : files)
+        // Next input document is loaded and prepared for merging in the background,
+        // while the previous one is being merged. So at most two input documents are
+        // held in memory together with the merged document. Document is prepared in
+        // the dedicated thread pool, because reading and optimizing use the global
+        // thread pools, and we must not block them.
+        struct PreparedDocument
+        {
+            int errorCode = ExitSuccess;
+            QString errorMessage;
+            pdf::PDFObjectStorage storage;
+            std::vector<pdf::PDFObjectReference> objectsToMerge;
+        };
+
+        const bool permissiveReading = options.permissiveReading;
+        auto prepareDocument = [permissiveReading](const QString& fileName)
         {
-            pdf::PDFDocumentReader reader(nullptr, [](bool* ok) { *ok = false; return QString(); }, options.permissiveReading, false);
+            PreparedDocument preparedDocument;
+
+            pdf::PDFDocumentReader reader(nullptr, [](bool* ok) { *ok = false; return QString(); }, permissiveReading, false);
             pdf::PDFDocument document = reader.readFromFile(fileName);
             if (reader.getReadingResult() != pdf::PDFDocumentReader::Result::OK)
             {
-                PDFConsole::writeError(PDFToolTranslationContext::tr("Cannot open document '%1'.").arg(fileName), options.outputCodec);
-                return ErrorDocumentReading;
+                preparedDocument.errorCode = ErrorDocumentReading;
+                preparedDocument.errorMessage = PDFToolTranslationContext::tr("Cannot open document '%1'.").arg(fileName);
+                return preparedDocument;
             }
 
             if (!document.getStorage().getSecurityHandler()->isAllowed(pdf::PDFSecurityHandler::Permission::Assemble))
             {
-                PDFConsole::writeError(PDFToolTranslationContext::tr("Document doesn't allow to assemble pages."), options.outputCodec);
-                return ErrorPermissions;
+                preparedDocument.errorCode = ErrorPermissions;
+                preparedDocument.errorMessage = PDFToolTranslationContext::tr("Document doesn't allow to assemble pages.");
+                return preparedDocument;
             }
 
-            pdf::PDFDocumentBuilder temporaryBuilder(&document);
-            temporaryBuilder.flattenPageTree();
+            try
+            {
+                pdf::PDFDocumentBuilder temporaryBuilder(&document);
+                temporaryBuilder.flattenPageTree();
 
-            std::vector<pdf::PDFObjectReference> currentPages = temporaryBuilder.getPages();
-            std::vector<pdf::PDFObjectReference> objectsToMerge = currentPages;
+                std::vector<pdf::PDFObjectReference> objectsToMerge = temporaryBuilder.getPages();
 
-            pdf::PDFObjectReference acroFormReference;
-            pdf::PDFObjectReference namesReference;
-            pdf::PDFObjectReference ocPropertiesReference;
+                pdf::PDFObjectReference acroFormReference;
+                pdf::PDFObjectReference namesReference;
+                pdf::PDFObjectReference ocPropertiesReference;
 
-            pdf::PDFObject formObject = document.getCatalog()->getFormObject();
-            if (formObject.isReference())
-            {
-                acroFormReference = formObject.getReference();
-            }
-            else
-            {
-                acroFormReference = temporaryBuilder.addObject(formObject);
-            }
+                pdf::PDFObject formObject = document.getCatalog()->getFormObject();
+                if (formObject.isReference())
+                {
+                    acroFormReference = formObject.getReference();
+                }
+                else
+                {
+                    acroFormReference = temporaryBuilder.addObject(formObject);
+                }
 
-            if (const pdf::PDFDictionary* catalogDictionary = temporaryBuilder.getDictionaryFromObject(temporaryBuilder.getObjectByReference(temporaryBuilder.getCatalogReference())))
-            {
-                pdf::PDFObject namesObject = catalogDictionary->get("Names");
-                if (namesObject.isReference())
+                if (const pdf::PDFDictionary* catalogDictionary = temporaryBuilder.getDictionaryFromObject(temporaryBuilder.getObjectByReference(temporaryBuilder.getCatalogReference())))
                 {
-                    namesReference = namesObject.getReference();
+                    pdf::PDFObject namesObject = catalogDictionary->get("Names");
+                    if (namesObject.isReference())
+                    {
+                        namesReference = namesObject.getReference();
+                    }
+
+                    pdf::PDFObject ocPropertiesObject = catalogDictionary->get("OCProperties");
+                    if (ocPropertiesObject.isReference())
+                    {
+                        ocPropertiesReference = ocPropertiesObject.getReference();
+                    }
                 }
 
-                pdf::PDFObject ocPropertiesObject = catalogDictionary->get("OCProperties");
-                if (ocPropertiesObject.isReference())
+                if (!namesReference.isValid())
                 {
-                    ocPropertiesReference = ocPropertiesObject.getReference();
+                    namesReference = temporaryBuilder.addObject(pdf::PDFObject());
                 }
-            }
 
-            if (!namesReference.isValid())
+                if (!ocPropertiesReference.isValid())
+                {
+                    ocPropertiesReference = temporaryBuilder.addObject(pdf::PDFObject());
+                }
+
+                objectsToMerge.insert(objectsToMerge.end(), { acroFormReference, namesReference, ocPropertiesReference });
+
+                preparedDocument.storage = *temporaryBuilder.getStorage();
+                preparedDocument.objectsToMerge = qMove(objectsToMerge);
+            }
+            catch (const pdf::PDFException &exception)
             {
-                namesReference = temporaryBuilder.addObject(pdf::PDFObject());
+                preparedDocument.errorCode = ErrorUnknown;
+                preparedDocument.errorMessage = exception.getMessage();
             }
 
-            if (!ocPropertiesReference.isValid())
+            return preparedDocument;
+        };
+
+        QThreadPool prepareThreadPool;
+        prepareThreadPool.setMaxThreadCount(1);
+
+        auto startPrepareDocument = [&prepareDocument, &prepareThreadPool](const QString& fileName)
+        {
+            return QtConcurrent::run(&prepareThreadPool, prepareDocument, fileName);
+        };
+
+        std::vector<pdf::PDFObjectReference> pages;
+        QFuture<PreparedDocument> nextPreparedDocument;
+        if (!files.isEmpty())
+        {
+            nextPreparedDocument = startPrepareDocument(files.front());
+        }
+
+        for (int i = 0; i < files.size(); ++i)
+        {
+            PreparedDocument preparedDocument = nextPreparedDocument.takeResult();
+            if (preparedDocument.errorCode != ExitSuccess)
             {
-                ocPropertiesReference = temporaryBuilder.addObject(pdf::PDFObject());
+                PDFConsole::writeError(preparedDocument.errorMessage, options.outputCodec);
+                return preparedDocument.errorCode;
             }
 
-            objectsToMerge.insert(objectsToMerge.end(), { acroFormReference, namesReference, ocPropertiesReference });
+            if (i + 1 < files.size())
+            {
+                nextPreparedDocument = startPrepareDocument(files[i + 1]);
+            }
 
             // Now, we are ready to merge objects into target document builder
-            std::vector<pdf::PDFObjectReference> references = pdf::PDFDocumentBuilder::createReferencesFromObjects(documentBuilder.copyFrom(pdf::PDFDocumentBuilder::createObjectsFromReferences(objectsToMerge), *temporaryBuilder.getStorage(), true));
+            std::vector<pdf::PDFObjectReference> references = pdf::PDFDocumentBuilder::createReferencesFromObjects(documentBuilder.copyFrom(pdf::PDFDocumentBuilder::createObjectsFromReferences(preparedDocument.objectsToMerge), preparedDocument.storage, true));
+
+            // Release the source document, it is no longer needed
+            preparedDocument = PreparedDocument();
 
-            ocPropertiesReference = references.back();
+            pdf::PDFObjectReference ocPropertiesReference = references.back();
             references.pop_back();
-            namesReference = references.back();
+            pdf::PDFObjectReference namesReference = references.back();
             references.pop_back();
-            acroFormReference = references.back();
+            pdf::PDFObjectReference acroFormReference = references.back();
             references.pop_back();
 
             documentPartPageCounts.push_back(references.size());
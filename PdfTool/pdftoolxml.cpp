@@ -220,7 +220,7 @@ int PDFToolXmlApplication::execute(const PDFToolOptions& options)
     document.getStorage().getTrailerDictionary().accept(&visitor);
     writer.writeEndElement();
 
-    pdf::PDFObjectStorage::PDFObjects entries = document.getStorage().getObjects();
+    const pdf::PDFObjectStorage::PDFObjects& entries = document.getStorage().getObjects();
     for (pdf::PDFInteger i = 0; i < pdf::PDFInteger(entries.size()); ++i)
     {
         const pdf::PDFObjectStorage::Entry& entry = entries[i];
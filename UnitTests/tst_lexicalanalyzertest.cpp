@@ -27,14 +27,51 @@
 #include "pdfdocument.h"
 #include "pdfexception.h"
 #include "pdfjbig2decoder.h"
+#include "pdfdiff.h"
+#include "pdffont.h"
+#include "pdfpainter.h"
+#include "pdfdocumentbuilder.h"
+#include "pdfdocumentreader.h"
+#include "pdftransparencyrenderer.h"
+#include "pdfcms.h"
+#include "pdfoptionalcontent.h"
+#include "pdfform.h"
 
 #include <regex>
+#include <atomic>
+#include <cstdlib>
+#include <algorithm>
 
 #ifdef PDF4QT_COMPILER_MSVC
 #pragma warning(push)
 #pragma warning(disable:4125)
 #endif
 
+/// Count of allocations made by global operator new, used to measure
+/// allocator pressure in the benchmarks. Allocations made by Qt containers
+/// directly by malloc are not counted.
+static std::atomic<qint64> s_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+    ++s_allocationCount;
+    if (void* pointer = std::malloc(size ? size : 1))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
 class LexicalAnalyzerTest : public QObject
 {
     Q_OBJECT
@@ -54,11 +91,33 @@ private slots:
     void test_invalid_input();
     void test_header_regexp();
     void test_flat_map();
+    void test_dictionary_lookup();
+    void test_object_storage_sharing();
+    void test_diff_fingerprint_store();
+    void test_document_identity();
+    void test_precompiled_page_culling();
+    void test_ink_coverage_coarse_to_fine();
+    void test_lazy_page_tree();
+    void test_damaged_document_recovery();
+    void test_document_read_benchmark_data();
+    void test_document_read_benchmark();
     void test_lzw_filter();
+    void test_stream_filter_decoder();
+    void test_stream_predictor();
+    void test_stream_predictor_benchmark_data();
+    void test_stream_predictor_benchmark();
+    void test_flate_length_hint();
+    void test_flate_decode_benchmark_data();
+    void test_flate_decode_benchmark();
     void test_sampled_function();
     void test_exponential_function();
     void test_stitching_function();
     void test_postscript_function();
+    void test_postscript_function_compiled();
+    void test_cmap_lookup();
+    void test_cmap_lookup_benchmark_data();
+    void test_cmap_lookup_benchmark();
+    void test_xfa_template_parse();
     void test_jbig2_arithmetic_decoder();
 
 private:
@@ -66,6 +125,20 @@ private:
     void testTokens(const char* stream, const std::vector<pdf::PDFLexicalAnalyzer::Token>& tokens);
 
     QString getStringFromTokens(const std::vector<pdf::PDFLexicalAnalyzer::Token>& tokens);
+
+    /// Scalar reference implementation of the PNG predictors
+    static QByteArray applyReferencePNGPredictor(const QByteArray& data, int pixelBytes, int stride);
+
+    struct CMapRange
+    {
+        unsigned int from = 0;
+        unsigned int to = 0;
+        unsigned int byteCount = 0;
+        pdf::CID cid = 0;
+    };
+
+    /// Linear scan reference implementation of the CMap lookup
+    static std::vector<pdf::CID> interpretReferenceCMap(const std::vector<CMapRange>& ranges, const QByteArray& byteArray);
 };
 
 LexicalAnalyzerTest::LexicalAnalyzerTest()
@@ -311,6 +384,587 @@ void LexicalAnalyzerTest::test_flat_map()
     }
 }
 
+void LexicalAnalyzerTest::test_dictionary_lookup()
+{
+    for (int count : { 1, 5, 11, 12, 13, 50, 200 })
+    {
+        pdf::PDFDictionary dictionary;
+
+        for (int i = 0; i < count; ++i)
+        {
+            // Mix short (inplace) and long (memory) keys
+            QByteArray key = (i % 3 == 0) ? QByteArray("VeryLongDictionaryKeyName") + QByteArray::number(i) : QByteArray("K") + QByteArray::number(i);
+            dictionary.addEntry(pdf::PDFInplaceOrMemoryString(key), pdf::PDFObject::createInteger(i));
+        }
+
+        // Duplicate key - the first entry must be found
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("K1"), pdf::PDFObject::createInteger(-1));
+
+        for (int optimize = 0; optimize < 2; ++optimize)
+        {
+            if (optimize)
+            {
+                dictionary.optimize();
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                QByteArray key = (i % 3 == 0) ? QByteArray("VeryLongDictionaryKeyName") + QByteArray::number(i) : QByteArray("K") + QByteArray::number(i);
+                QVERIFY(dictionary.hasKey(key));
+                QVERIFY(dictionary.hasKey(key.constData()));
+                QCOMPARE(dictionary.get(key).getInteger(), i);
+                QCOMPARE(dictionary.get(pdf::PDFInplaceOrMemoryString(key)).getInteger(), i);
+            }
+
+            QVERIFY(!dictionary.hasKey("K"));
+            QVERIFY(!dictionary.hasKey(""));
+            QVERIFY(!dictionary.hasKey("Missing"));
+            QVERIFY(dictionary.get("Missing").isNull());
+        }
+
+        // Modification of the optimized dictionary
+        dictionary.setEntry(pdf::PDFInplaceOrMemoryString("NewKey"), pdf::PDFObject::createInteger(1000));
+        QCOMPARE(dictionary.get("NewKey").getInteger(), 1000);
+        dictionary.removeEntry("NewKey");
+        QVERIFY(!dictionary.hasKey("NewKey"));
+    }
+}
+
+void LexicalAnalyzerTest::test_object_storage_sharing()
+{
+    pdf::PDFObjectStorage storage;
+    for (int i = 0; i < 5000; ++i)
+    {
+        storage.addObject(pdf::PDFObject::createInteger(i));
+    }
+
+    // Copy shares all objects, modification must not affect the original
+    pdf::PDFObjectStorage modifiedStorage = storage;
+    QVERIFY(modifiedStorage == storage);
+    QVERIFY(modifiedStorage.getChangedReferences(storage).empty());
+
+    modifiedStorage.setObject(pdf::PDFObjectReference(10, 0), pdf::PDFObject::createInteger(-10));
+    modifiedStorage.setObject(pdf::PDFObjectReference(3000, 0), pdf::PDFObject::createInteger(-3000));
+    pdf::PDFObjectReference addedReference = modifiedStorage.addObject(pdf::PDFObject::createInteger(5000));
+
+    QCOMPARE(storage.getObject(pdf::PDFObjectReference(10, 0)).getInteger(), 10);
+    QCOMPARE(storage.getObject(pdf::PDFObjectReference(3000, 0)).getInteger(), 3000);
+    QCOMPARE(storage.getObjects().size(), size_t(5000));
+    QCOMPARE(modifiedStorage.getObject(pdf::PDFObjectReference(10, 0)).getInteger(), -10);
+    QCOMPARE(modifiedStorage.getObject(pdf::PDFObjectReference(3000, 0)).getInteger(), -3000);
+    QCOMPARE(modifiedStorage.getObject(addedReference).getInteger(), 5000);
+    QVERIFY(modifiedStorage != storage);
+
+    std::vector<pdf::PDFObjectReference> expectedReferences = { pdf::PDFObjectReference(10, 0), pdf::PDFObjectReference(3000, 0), addedReference };
+    QVERIFY(modifiedStorage.getChangedReferences(storage) == expectedReferences);
+    QVERIFY(storage.getChangedReferences(modifiedStorage) == expectedReferences);
+
+    // Resizing and iteration
+    pdf::PDFObjectStorage::PDFObjects objects = modifiedStorage.getObjects();
+    objects.resize(1500);
+    QCOMPARE(objects.size(), size_t(1500));
+    objects.resize(2100);
+    QVERIFY(objects[2099].object.isNull());
+
+    pdf::PDFInteger sum = 0;
+    for (const pdf::PDFObjectStorage::Entry& entry : std::as_const(objects))
+    {
+        sum += entry.object.isInt() ? entry.object.getInteger() : 0;
+    }
+    QCOMPARE(sum, pdf::PDFInteger(1499 * 1500 / 2 - 20));
+    QCOMPARE(modifiedStorage.getObjects().size(), size_t(5001));
+}
+
+void LexicalAnalyzerTest::test_diff_fingerprint_store()
+{
+    using HashAlgorithm = pdf::PDFPrecompiledPage::HashAlgorithm;
+
+    // Fast hash must be deterministic and must distinguish data
+    std::array<uint8_t, 64> hash1 = { };
+    std::array<uint8_t, 64> hash2 = { };
+    std::array<uint8_t, 64> hash3 = { };
+    pdf::PDFPrecompiledPage::calculateHash(QByteArray("Graphic piece data"), HashAlgorithm::Fast, hash1);
+    pdf::PDFPrecompiledPage::calculateHash(QByteArray("Graphic piece data"), HashAlgorithm::Fast, hash2);
+    pdf::PDFPrecompiledPage::calculateHash(QByteArray("Graphic piece date"), HashAlgorithm::Fast, hash3);
+    QVERIFY(hash1 == hash2);
+    QVERIFY(hash1 != hash3);
+
+    pdf::PDFPrecompiledPage::GraphicPieceInfo info;
+    info.type = pdf::PDFPrecompiledPage::GraphicPieceInfo::Type::VectorGraphics;
+    info.boundingRect = QRectF(10, 20, 30, 40);
+    info.hash = hash1;
+    info.pagePath.addRect(info.boundingRect);
+
+    pdf::PDFDiffFingerprintStore store(QByteArray("document"), HashAlgorithm::Fast, 0.001);
+    store.setGraphicPieces(3, { info });
+
+    QByteArray data;
+    {
+        QBuffer buffer(&data);
+        buffer.open(QBuffer::WriteOnly);
+        QVERIFY(store.save(&buffer));
+    }
+
+    pdf::PDFDiffFingerprintStore loadedStore;
+    {
+        QBuffer buffer(&data);
+        buffer.open(QBuffer::ReadOnly);
+        QVERIFY(loadedStore.load(&buffer));
+    }
+
+    QCOMPARE(loadedStore.getDocumentHash(), QByteArray("document"));
+    QVERIFY(loadedStore.getHashAlgorithm() == HashAlgorithm::Fast);
+    QCOMPARE(loadedStore.getPageCount(), size_t(1));
+    QVERIFY(!loadedStore.getGraphicPieces(0));
+
+    const pdf::PDFPrecompiledPage::GraphicPieceInfos* loadedInfos = loadedStore.getGraphicPieces(3);
+    QVERIFY(loadedInfos && loadedInfos->size() == 1);
+    QVERIFY(loadedInfos->front().type == info.type);
+    QCOMPARE(loadedInfos->front().boundingRect, info.boundingRect);
+    QVERIFY(loadedInfos->front().hash == info.hash);
+    QCOMPARE(loadedInfos->front().pagePath, info.pagePath);
+
+    // Corrupted data must not be loaded
+    data[0] = 'X';
+    {
+        QBuffer buffer(&data);
+        buffer.open(QBuffer::ReadOnly);
+        QVERIFY(!loadedStore.load(&buffer));
+        QVERIFY(loadedStore.isEmpty());
+    }
+}
+
+void LexicalAnalyzerTest::test_document_identity()
+{
+    // Data span several chunks of the tree hash, last chunk is incomplete
+    QByteArray data;
+    data.reserve(2 * pdf::PDFDocumentIdentity::HASH_CHUNK_SIZE + 1000);
+    for (qsizetype i = 0; i < 2 * pdf::PDFDocumentIdentity::HASH_CHUNK_SIZE + 1000; ++i)
+    {
+        data.push_back(static_cast<char>((i * 31 + i / 4093) % 251));
+    }
+
+    QByteArray changedData = data;
+    changedData[changedData.size() - 1] = 'X';
+
+    // Equal bytes must give equal identities (regardless of the document ID)
+    pdf::PDFDocumentIdentity identity1 = pdf::PDFDocumentIdentity::create(data, QByteArray("id"));
+    pdf::PDFDocumentIdentity identity2 = pdf::PDFDocumentIdentity::create(QByteArray(data.constData(), data.size()), QByteArray());
+    pdf::PDFDocumentIdentity identity3 = pdf::PDFDocumentIdentity::create(changedData, QByteArray("id"));
+
+    QVERIFY(identity1.isValid());
+    QVERIFY(identity1 == identity2);
+    QVERIFY(identity1 != identity3);
+    QCOMPARE(identity1.getHash(), identity2.getHash());
+    QCOMPARE(identity1.getHash(), pdf::PDFDocumentIdentity::computeHash(data));
+    QVERIFY(pdf::PDFDocumentIdentity::createFromHash(identity1.getHash()) == identity1);
+    QCOMPARE(identity1.getSourceDataSize(), data.size());
+    QVERIFY(!identity1.getFastIdentity().isEmpty());
+    QVERIFY(identity2.getFastIdentity().isEmpty());
+
+    // Invalid identity is not equal to any valid identity
+    QVERIFY(!pdf::PDFDocumentIdentity().isValid());
+    QVERIFY(pdf::PDFDocumentIdentity() != identity1);
+    QVERIFY(pdf::PDFDocumentIdentity::createFromHash(QByteArray()) == pdf::PDFDocumentIdentity());
+}
+
+void LexicalAnalyzerTest::test_precompiled_page_culling()
+{
+    pdf::PDFPrecompiledPage page;
+
+    QImage image(4, 4, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::blue);
+
+    // Grid of stroked and filled rectangles, clipped by the graphic state
+    page.addSaveGraphicState();
+    page.addSetWorldMatrix(QTransform::fromTranslate(5, 5));
+    QPainterPath clipPath;
+    clipPath.addRect(0, 0, 150, 390);
+    page.addClip(clipPath);
+    for (int row = 0; row < 20; ++row)
+    {
+        for (int column = 0; column < 20; ++column)
+        {
+            QPainterPath path;
+            path.addRect(column * 20, row * 20, 12, 12);
+            QPen pen(QColor(row * 10, column * 10, 0), 3.0);
+            page.addPath(pen, QBrush(QColor(0, row * 10, column * 10)), qMove(path), false);
+        }
+    }
+    page.addRestoreGraphicState();
+
+    // Horizontal line and image drawn in other coordinate system
+    page.addSetWorldMatrix(QTransform(2, 0, 0, 2, 0, 0));
+    QPainterPath linePath;
+    linePath.moveTo(10, 60);
+    linePath.lineTo(190, 60);
+    page.addPath(QPen(Qt::red, 2.0), Qt::NoBrush, qMove(linePath), false);
+    page.addSetWorldMatrix(QTransform(60, 0, 0, 60, 120, 120));
+    page.addImage(image);
+    page.finalize(0, { });
+
+    const QRectF cropBox(0, 0, 400, 400);
+    const pdf::PDFRenderer::Features features = pdf::PDFRenderer::Antialiasing | pdf::PDFRenderer::ClipToCropBox;
+
+    QImage fullImage(400, 400, QImage::Format_ARGB32_Premultiplied);
+    fullImage.fill(Qt::white);
+    {
+        QPainter painter(&fullImage);
+        page.draw(&painter, cropBox, QTransform(), features, 1.0);
+    }
+
+    // Painting of the sub-rectangle must give same result as painting of the whole page
+    for (const QRect& clipRect : { QRect(100, 100, 80, 80), QRect(0, 110, 400, 15), QRect(230, 230, 40, 40), QRect(390, 0, 10, 10) })
+    {
+        QImage clippedImage(400, 400, QImage::Format_ARGB32_Premultiplied);
+        clippedImage.fill(Qt::white);
+        {
+            QPainter painter(&clippedImage);
+            painter.setClipRect(clipRect);
+            page.draw(&painter, cropBox, QTransform(), features, 1.0);
+        }
+
+        QCOMPARE(clippedImage.copy(clipRect), fullImage.copy(clipRect));
+    }
+}
+
+void LexicalAnalyzerTest::test_ink_coverage_coarse_to_fine()
+{
+    // Page 1 has total area coverage far below the limit, page 2 above the limit,
+    // page 3 has total area coverage close to the limit in its top fifth.
+    pdf::PDFDocumentBuilder builder;
+    builder.createDocument();
+    for (const QByteArray& content : { QByteArray("0 0 0 0.5 k 0 0 100 100 re f"),
+                                       QByteArray("0.7 0.7 0.7 0.7 k 0 0 100 100 re f"),
+                                       QByteArray("0.45 0.45 0.45 0.45 k 0 80 100 20 re f") })
+    {
+        pdf::PDFObjectReference pageReference = builder.appendPage(QRectF(0, 0, 100, 100));
+
+        pdf::PDFDictionary dictionary;
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Length"), pdf::PDFObject::createInteger(content.size()));
+        pdf::PDFObjectReference contentReference = builder.addObject(pdf::PDFObject::createStream(std::make_shared<pdf::PDFStream>(qMove(dictionary), QByteArray(content))));
+
+        pdf::PDFObjectFactory factory;
+        factory.beginDictionary();
+        factory.beginDictionaryItem("Contents");
+        factory << contentReference;
+        factory.endDictionaryItem();
+        factory.endDictionary();
+        builder.mergeTo(pageReference, factory.takeObject());
+    }
+    pdf::PDFDocument document = builder.build();
+    QCOMPARE(document.getCatalog()->getPageCount(), size_t(3));
+
+    pdf::PDFOptionalContentActivity optionalContentActivity(&document, pdf::OCUsage::Print, nullptr);
+    pdf::PDFCMSManager cmsManager(nullptr);
+    cmsManager.setDocument(&document);
+
+    pdf::PDFFontCache fontCache(pdf::DEFAULT_FONT_CACHE_LIMIT, pdf::DEFAULT_REALIZED_FONT_CACHE_LIMIT);
+    pdf::PDFModifiedDocument md(&document, &optionalContentActivity);
+    fontCache.setDocument(md);
+
+    pdf::PDFInkMapper inkMapper(&cmsManager, &document);
+    inkMapper.createSpotColors(true);
+
+    pdf::PDFInkCoverageCalculator calculator(&document, &fontCache, &cmsManager, &optionalContentActivity, &inkMapper, nullptr, pdf::PDFTransparencyRendererSettings());
+
+    const QSize size(200, 200);
+    calculator.perform(size, { 0, 1, 2 });
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo fullInfo1 = calculator.getPageCoverageInfo(0);
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo fullInfo2 = calculator.getPageCoverageInfo(1);
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo fullInfo3 = calculator.getPageCoverageInfo(2);
+    QVERIFY(!fullInfo1.isPreview && !fullInfo2.isPreview && !fullInfo3.isPreview);
+    QCOMPARE(fullInfo1.fullResolutionRowCount, size.height());
+    QVERIFY(qAbs(fullInfo1.maximalTotalAreaCoverage - 0.5f) < 0.01f);
+    QVERIFY(qAbs(fullInfo2.maximalTotalAreaCoverage - 2.8f) < 0.01f);
+    QVERIFY(qAbs(fullInfo3.maximalTotalAreaCoverage - 1.8f) < 0.01f);
+
+    pdf::PDFInkCoverageCalculator::CoarseToFineSettings settings;
+    settings.enabled = true;
+    settings.previewSize = QSize(50, 50);
+    settings.totalAreaCoverageLimit = 2.0f;
+    calculator.setCoarseToFineSettings(settings);
+    calculator.clear();
+
+    // Callback must be called for each page, even for invalid one
+    std::vector<std::pair<pdf::PDFInteger, bool>> calledPages;
+    calculator.setPageCoverageCallback([&calledPages](pdf::PDFInteger pageIndex,
+                                                      const std::vector<pdf::PDFInkCoverageCalculator::InkCoverageChannelInfo>& coverage,
+                                                      const pdf::PDFInkCoverageCalculator::PageCoverageInfo&)
+    {
+        calledPages.emplace_back(pageIndex, coverage.empty());
+    });
+    calculator.perform(size, { 0, 1, 2, 5 });
+    calculator.setPageCoverageCallback(nullptr);
+
+    std::sort(calledPages.begin(), calledPages.end());
+    QVERIFY(calledPages == std::vector<std::pair<pdf::PDFInteger, bool>>({ { 0, false }, { 1, false }, { 2, false }, { 5, true } }));
+    QVERIFY(calculator.getInkCoverage(5)->empty());
+
+    // Pages far below the limit and above the limit are decided from the preview
+    // only, without rendering in full resolution.
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo info1 = calculator.getPageCoverageInfo(0);
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo info2 = calculator.getPageCoverageInfo(1);
+    QVERIFY(info1.isPreview);
+    QCOMPARE(info1.fullResolutionRowCount, 0);
+    QVERIFY(qAbs(info1.maximalTotalAreaCoverage - fullInfo1.maximalTotalAreaCoverage) < 0.01f);
+    QVERIFY(info2.isPreview);
+    QCOMPARE(info2.fullResolutionRowCount, 0);
+    QVERIFY(info2.maximalTotalAreaCoverage > settings.totalAreaCoverageLimit);
+    QVERIFY(info2.maximalTotalAreaCoverage <= fullInfo2.maximalTotalAreaCoverage + 0.01f);
+
+    // Only the band close to the limit is rendered in full resolution
+    const pdf::PDFInkCoverageCalculator::PageCoverageInfo info3 = calculator.getPageCoverageInfo(2);
+    QVERIFY(info3.isPreview);
+    QVERIFY(info3.fullResolutionRowCount > 0);
+    QVERIFY(info3.fullResolutionRowCount < size.height() / 2);
+    QVERIFY(qAbs(info3.maximalTotalAreaCoverage - fullInfo3.maximalTotalAreaCoverage) < 0.01f);
+}
+
+void LexicalAnalyzerTest::test_lazy_page_tree()
+{
+    constexpr size_t pageCount = pdf::PDFCatalog::LAZY_PAGE_TREE_THRESHOLD;
+
+    // Page tree with two intermediate nodes, each having half of the pages
+    auto createDocument = [](pdf::PDFInteger rootCount, bool brokenKid, bool invalidRotation, std::vector<pdf::PDFObjectReference>& pageReferences)
+    {
+        auto createName = [](const char* name) { return pdf::PDFObject::createName(QByteArray(name)); };
+
+        pdf::PDFDocumentBuilder builder;
+        builder.createDocument();
+
+        pageReferences.clear();
+        std::vector<pdf::PDFObjectReference> nodeReferences;
+        for (size_t nodeIndex = 0; nodeIndex < 2; ++nodeIndex)
+        {
+            pdf::PDFArray kids;
+            for (size_t i = 0; i < pageCount / 2; ++i)
+            {
+                pdf::PDFDictionary page;
+                page.addEntry(pdf::PDFInplaceOrMemoryString("Type"), createName("Page"));
+                if (invalidRotation && nodeIndex == 1 && i == 20)
+                {
+                    page.addEntry(pdf::PDFInplaceOrMemoryString("Rotate"), pdf::PDFObject::createInteger(45));
+                }
+                pdf::PDFObjectReference pageReference = builder.addObject(pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(page))));
+                pageReferences.push_back(pageReference);
+
+                const bool isBroken = brokenKid && nodeIndex == 1 && i == 10;
+                kids.appendItem(isBroken ? pdf::PDFObject::createInteger(0) : pdf::PDFObject::createReference(pageReference));
+            }
+
+            pdf::PDFDictionary node;
+            node.addEntry(pdf::PDFInplaceOrMemoryString("Type"), createName("Pages"));
+            node.addEntry(pdf::PDFInplaceOrMemoryString("Kids"), pdf::PDFObject::createArray(std::make_shared<pdf::PDFArray>(qMove(kids))));
+            node.addEntry(pdf::PDFInplaceOrMemoryString("Count"), pdf::PDFObject::createInteger(pageCount / 2));
+            nodeReferences.push_back(builder.addObject(pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(node)))));
+        }
+
+        pdf::PDFArray rootKids;
+        for (const pdf::PDFObjectReference& reference : nodeReferences)
+        {
+            rootKids.appendItem(pdf::PDFObject::createReference(reference));
+        }
+
+        pdf::PDFDictionary root;
+        root.addEntry(pdf::PDFInplaceOrMemoryString("Type"), createName("Pages"));
+        root.addEntry(pdf::PDFInplaceOrMemoryString("Kids"), pdf::PDFObject::createArray(std::make_shared<pdf::PDFArray>(qMove(rootKids))));
+        root.addEntry(pdf::PDFInplaceOrMemoryString("Count"), pdf::PDFObject::createInteger(rootCount));
+        pdf::PDFObjectReference rootReference = builder.addObject(pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(root))));
+
+        pdf::PDFObjectFactory factory;
+        factory.beginDictionary();
+        factory.beginDictionaryItem("Pages");
+        factory << rootReference;
+        factory.endDictionaryItem();
+        factory.endDictionary();
+        builder.mergeTo(builder.getCatalogReference(), factory.takeObject());
+
+        return builder.build();
+    };
+
+    std::vector<pdf::PDFObjectReference> pageReferences;
+
+    // Valid page tree
+    {
+        pdf::PDFDocument document = createDocument(pageCount, false, false, pageReferences);
+        const pdf::PDFCatalog* catalog = document.getCatalog();
+        QVERIFY(catalog->isPageTreeLazy());
+        QCOMPARE(catalog->getPageCount(), pageCount);
+
+        for (const size_t index : { size_t(0), pageCount / 2 - 1, pageCount / 2, pageCount - 1 })
+        {
+            const pdf::PDFPage* page = catalog->getPage(index);
+            QVERIFY(page);
+            QCOMPARE(page->getPageReference(), pageReferences[index]);
+            QCOMPARE(catalog->getPage(index), page);
+        }
+
+        QVERIFY(!catalog->getPage(pageCount));
+        QCOMPARE(catalog->getPageCount(), pageCount);
+    }
+
+    // Invalid /Count entry of the root, page tree is parsed as a whole,
+    // so page count is the count of the pages really present in the tree.
+    {
+        pdf::PDFDocument document = createDocument(pageCount + 1, false, false, pageReferences);
+        const pdf::PDFCatalog* catalog = document.getCatalog();
+        QVERIFY(!catalog->isPageTreeLazy());
+        QCOMPARE(catalog->getPageCount(), pageCount);
+
+        for (size_t i = 0; i < catalog->getPageCount(); ++i)
+        {
+            QVERIFY(catalog->getPage(i));
+        }
+
+        QCOMPARE(catalog->getPage(pageCount - 1)->getPageReference(), pageReferences[pageCount - 1]);
+        QCOMPARE(catalog->getPageIndexFromPageReference(pageReferences[pageCount / 2]), pageCount / 2);
+    }
+
+    // Broken kid in the second node, document can't be opened, as in non-lazy mode
+    {
+        QVERIFY_THROWS_EXCEPTION(pdf::PDFException, createDocument(pageCount, true, false, pageReferences));
+    }
+
+    // Page with invalid rotation, structure of the page tree is valid, so page tree
+    // is lazy, but the page can't be parsed. It is reported as nonexisting page,
+    // neighbouring pages must be still accessible.
+    {
+        pdf::PDFDocument document = createDocument(pageCount, false, true, pageReferences);
+        const pdf::PDFCatalog* catalog = document.getCatalog();
+        QVERIFY(catalog->isPageTreeLazy());
+        QCOMPARE(catalog->getPageCount(), pageCount);
+
+        const size_t invalidPageIndex = pageCount / 2 + 20;
+        QVERIFY(!catalog->getPage(invalidPageIndex));
+        QVERIFY(!catalog->getPage(invalidPageIndex));
+        QCOMPARE(catalog->getPageIndexFromPageReference(pageReferences[invalidPageIndex]), pdf::PDFCatalog::INVALID_PAGE_INDEX);
+
+        for (const size_t index : { invalidPageIndex - 1, invalidPageIndex + 1, size_t(0), pageCount - 1 })
+        {
+            const pdf::PDFPage* page = catalog->getPage(index);
+            QVERIFY(page);
+            QCOMPARE(page->getPageReference(), pageReferences[index]);
+        }
+    }
+}
+
+void LexicalAnalyzerTest::test_damaged_document_recovery()
+{
+    // Stream data contain markers of the objects, they must be skipped using the /Length entry
+    const QByteArray streamData = "% endstream\nendobj\n9 0 obj\n<< /Fake true >>\nendobj\n0 g";
+
+    QByteArray data;
+    data.append("%PDF-1.7\n");
+    data.append("1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+    data.append("2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n");
+    data.append("3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 100 100] /Contents 4 0 R >>\nendobj\n");
+    data.append(QString("4 0 obj\n<< /Length %1 >>\nstream\r\n").arg(streamData.size()).toLatin1());
+    data.append(streamData);
+    data.append("\nendstream\nendobj\n");
+
+    // Stream truncated in the middle of the file (length is invalid)
+    data.append("5 0 obj\n<< /Length 1000 >>\nstream\nshort data\nendstream\nendobj\n");
+    data.append("6 0 obj\n<< /Type /Test /Value 42 >>\nendobj\n");
+
+    // File is truncated (no cross reference table, nor trailer)
+    data.append("7 0 obj\n<< /Length 50 >>\nstream\nabc");
+
+    pdf::PDFDocumentReader reader(nullptr, [](bool* ok) { *ok = false; return QString(); }, true, false);
+    pdf::PDFDocument document = reader.readFromBuffer(data);
+    QVERIFY(reader.getReadingResult() == pdf::PDFDocumentReader::Result::OK);
+    QCOMPARE(document.getCatalog()->getPageCount(), size_t(1));
+
+    const pdf::PDFObjectStorage& storage = document.getStorage();
+    const pdf::PDFObject& streamObject = storage.getObjectByReference(pdf::PDFObjectReference(4, 0));
+    QVERIFY(streamObject.isStream());
+    QCOMPARE(storage.getDecodedStream(streamObject.getStream()), streamData);
+
+    // Object inside the stream data must not be restored
+    QVERIFY(storage.getObjectByReference(pdf::PDFObjectReference(9, 0)).isNull());
+
+    const pdf::PDFObject& testObject = storage.getObjectByReference(pdf::PDFObjectReference(6, 0));
+    QVERIFY(testObject.isDictionary());
+    const pdf::PDFObject& valueObject = testObject.getDictionary()->get("Value");
+    QVERIFY(valueObject.isInt() && valueObject.getInteger() == 42);
+}
+
+void LexicalAnalyzerTest::test_document_read_benchmark_data()
+{
+    QTest::addColumn<int>("objectCount");
+    QTest::addColumn<bool>("countAllocations");
+
+    for (int objectCount : { 10000, 100000 })
+    {
+        QTest::newRow(qPrintable(QString("%1 objects, time").arg(objectCount))) << objectCount << false;
+        QTest::newRow(qPrintable(QString("%1 objects, allocations").arg(objectCount))) << objectCount << true;
+    }
+}
+
+void LexicalAnalyzerTest::test_document_read_benchmark()
+{
+    QFETCH(int, objectCount);
+    QFETCH(bool, countAllocations);
+
+    // Document with one page and many small objects, each of them is a dictionary
+    // containing an array and nested dictionary, so it has three object contents.
+    QByteArray data;
+    std::vector<int> offsets;
+    offsets.reserve(objectCount + 3);
+    data.append("%PDF-1.7\n");
+
+    auto addObject = [&data, &offsets](const QByteArray& object)
+    {
+        offsets.push_back(data.size());
+        data.append(QString("%1 0 obj\n").arg(offsets.size()).toLatin1());
+        data.append(object);
+        data.append("\nendobj\n");
+    };
+
+    addObject("<< /Type /Catalog /Pages 2 0 R >>");
+    addObject("<< /Type /Pages /Kids [3 0 R] /Count 1 >>");
+    addObject("<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] >>");
+    for (int i = 0; i < objectCount; ++i)
+    {
+        addObject(QString("<< /Type /Test /Index %1 /Array [%1 0.5 /Name (Text %1)] /Nested << /Value %1 /Flag true >> >>").arg(i).toLatin1());
+    }
+
+    const int xrefOffset = data.size();
+    data.append(QString("xref\n0 %1\n0000000000 65535 f\r\n").arg(offsets.size() + 1).toLatin1());
+    for (int offset : offsets)
+    {
+        data.append(QString("%1 00000 n\r\n").arg(offset, 10, 10, QChar('0')).toLatin1());
+    }
+    data.append(QString("trailer\n<< /Size %1 /Root 1 0 R >>\nstartxref\n%2\n%%EOF\n").arg(offsets.size() + 1).arg(xrefOffset).toLatin1());
+
+    auto readDocument = [&data, objectCount]()
+    {
+        pdf::PDFDocumentReader reader(nullptr, [](bool* ok) { *ok = false; return QString(); }, true, false);
+        pdf::PDFDocument document = reader.readFromBuffer(data);
+        QVERIFY(reader.getReadingResult() == pdf::PDFDocumentReader::Result::OK);
+        QCOMPARE(document.getCatalog()->getPageCount(), size_t(1));
+
+        const pdf::PDFObject& lastObject = document.getStorage().getObjectByReference(pdf::PDFObjectReference(objectCount + 3, 0));
+        QVERIFY(lastObject.isDictionary());
+        QVERIFY(lastObject.getDictionary()->get("Array").isArray());
+    };
+
+    if (countAllocations)
+    {
+        // Number of allocations done when document is read
+        const qint64 allocationCount = s_allocationCount;
+        readDocument();
+        QTest::setBenchmarkResult(qreal(s_allocationCount - allocationCount), QTest::Events);
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            readDocument();
+        }
+    }
+}
+
 void LexicalAnalyzerTest::test_lzw_filter()
 {
     // This example is from PDF 1.7 Reference
@@ -322,6 +976,302 @@ void LexicalAnalyzerTest::test_lzw_filter()
     QCOMPARE(decoded, valid);
 }
 
+void LexicalAnalyzerTest::test_stream_filter_decoder()
+{
+    auto objectFetcher = [](const pdf::PDFObject& object) -> const pdf::PDFObject& { return object; };
+
+    auto decode = [&objectFetcher](const pdf::PDFStreamFilter& filter, const QByteArray& data, const pdf::PDFObject& parameters)
+    {
+        return filter.createDecoder(std::make_unique<pdf::PDFBufferFilterDecoder>(data), objectFetcher, parameters, nullptr)->readAll();
+    };
+
+    {
+        // PNG predictor with all predictor types, data are larger than one decoded chunk,
+        // and the last row is incomplete
+        constexpr int columns = 100;
+        constexpr int colors = 3;
+        constexpr int rowSize = columns * colors + 1;
+
+        QByteArray data;
+        for (int i = 0; i < 1000 * rowSize - 17; ++i)
+        {
+            data.push_back(static_cast<char>((i % rowSize == 0) ? (i / rowSize) % 5 : (i * 7 + i / 1000) % 251));
+        }
+
+        pdf::PDFDictionary dictionary;
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Predictor"), pdf::PDFObject::createInteger(15));
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Colors"), pdf::PDFObject::createInteger(colors));
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Columns"), pdf::PDFObject::createInteger(columns));
+        pdf::PDFObject parameters = pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(dictionary)));
+
+        pdf::PDFFlateDecodeFilter filter;
+        QByteArray compressed = pdf::PDFFlateDecodeFilter::compress(data);
+        QCOMPARE(decode(filter, compressed, parameters), filter.apply(compressed, objectFetcher, parameters, nullptr));
+        QCOMPARE(decode(filter, compressed, pdf::PDFObject()), data);
+
+        // Device reads the data in small pieces
+        pdf::PDFStreamFilterDevice device(filter.createDecoder(std::make_unique<pdf::PDFBufferFilterDecoder>(compressed), objectFetcher, pdf::PDFObject(), nullptr));
+        QByteArray deviceData;
+        while (!device.atEnd())
+        {
+            deviceData.append(device.read(1000));
+        }
+        QCOMPARE(deviceData, data);
+
+        // Truncated stream causes an error of the device
+        pdf::PDFStreamFilterDevice truncatedDevice(filter.createDecoder(std::make_unique<pdf::PDFBufferFilterDecoder>(compressed.left(compressed.size() / 2)), objectFetcher, pdf::PDFObject(), nullptr));
+        QVERIFY(truncatedDevice.readAll().size() < data.size());
+        QVERIFY(truncatedDevice.errorString().contains("flate"));
+    }
+
+    {
+        QByteArray data = "9jqo^BlbD-Bl\neB1DJ+*+F(f, z q/0JhKF<GL>Cj@.4Gp$d7F!,L7@<6@)/0JDEF<G%<+EV:2F!,O~>";
+        pdf::PDFAscii85DecodeFilter filter;
+        QCOMPARE(decode(filter, data, pdf::PDFObject()), filter.apply(data, objectFetcher, pdf::PDFObject(), nullptr));
+    }
+
+    {
+        QByteArray data = "4E6F76 656D626572\n2032303234>";
+        pdf::PDFAsciiHexDecodeFilter filter;
+        QCOMPARE(decode(filter, data, pdf::PDFObject()), filter.apply(data, objectFetcher, pdf::PDFObject(), nullptr));
+    }
+
+    {
+        QByteArray data = QByteArray::fromHex("02414243FD44004580");
+        pdf::PDFRunLengthDecodeFilter filter;
+        QCOMPARE(decode(filter, data, pdf::PDFObject()), QByteArray("ABCDDDDE"));
+    }
+}
+
+void LexicalAnalyzerTest::test_stream_predictor()
+{
+    auto objectFetcher = [](const pdf::PDFObject& object) -> const pdf::PDFObject& { return object; };
+
+    auto createParameters = [](int predictor, int colors, int bitsPerComponent, int columns)
+    {
+        pdf::PDFDictionary dictionary;
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Predictor"), pdf::PDFObject::createInteger(predictor));
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Colors"), pdf::PDFObject::createInteger(colors));
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("BitsPerComponent"), pdf::PDFObject::createInteger(bitsPerComponent));
+        dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Columns"), pdf::PDFObject::createInteger(columns));
+        return pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(dictionary)));
+    };
+
+    pdf::PDFFlateDecodeFilter filter;
+    uint32_t seed = 1;
+    auto random = [&seed]() { seed = seed * 1103515245 + 12345; return static_cast<char>(seed >> 16); };
+
+    for (const int colors : { 1, 2, 3, 4, 5 })
+    {
+        for (const int bitsPerComponent : { 1, 4, 8, 16 })
+        {
+            const int columns = 37;
+            const int stride = (columns * colors * bitsPerComponent + 7) / 8;
+            const int pixelBytes = (colors * bitsPerComponent + 7) / 8;
+
+            // PNG predictor, last row is incomplete
+            QByteArray data;
+            for (int row = 0; row < 40; ++row)
+            {
+                data.push_back(static_cast<char>(row % 5));
+                for (int i = 0; i < stride; ++i)
+                {
+                    data.push_back(random());
+                }
+            }
+            data.chop(stride / 2);
+
+            QByteArray compressed = pdf::PDFFlateDecodeFilter::compress(data);
+            pdf::PDFObject parameters = createParameters(15, colors, bitsPerComponent, columns);
+            QCOMPARE(filter.apply(compressed, objectFetcher, parameters, nullptr), applyReferencePNGPredictor(data, pixelBytes, stride));
+
+            if (bitsPerComponent == 8 || bitsPerComponent == 16)
+            {
+                // TIFF predictor - differences of the components of neighbouring pixels
+                QByteArray tiffData;
+                for (int i = 0; i < stride * 20; ++i)
+                {
+                    tiffData.push_back(random());
+                }
+
+                QByteArray expectedData = tiffData;
+                const int valueBytes = bitsPerComponent / 8;
+                for (int offset = 0; offset < expectedData.size(); offset += stride)
+                {
+                    for (int i = valueBytes * colors; i < stride; i += valueBytes)
+                    {
+                        uint8_t* value = reinterpret_cast<uint8_t*>(expectedData.data() + offset + i);
+                        const uint8_t* left = value - valueBytes * colors;
+                        if (valueBytes == 1)
+                        {
+                            value[0] += left[0];
+                        }
+                        else
+                        {
+                            const int sum = ((value[0] << 8) | value[1]) + ((left[0] << 8) | left[1]);
+                            value[0] = static_cast<uint8_t>(sum >> 8);
+                            value[1] = static_cast<uint8_t>(sum);
+                        }
+                    }
+                }
+
+                QByteArray compressedTiffData = pdf::PDFFlateDecodeFilter::compress(tiffData);
+                pdf::PDFObject tiffParameters = createParameters(2, colors, bitsPerComponent, columns);
+                QCOMPARE(filter.apply(compressedTiffData, objectFetcher, tiffParameters, nullptr), expectedData);
+            }
+        }
+    }
+}
+
+void LexicalAnalyzerTest::test_stream_predictor_benchmark_data()
+{
+    QTest::addColumn<bool>("isReference");
+
+    QTest::newRow("scalar reference") << true;
+    QTest::newRow("PDFStreamPredictor") << false;
+}
+
+void LexicalAnalyzerTest::test_stream_predictor_benchmark()
+{
+    QFETCH(bool, isReference);
+
+    auto objectFetcher = [](const pdf::PDFObject& object) -> const pdf::PDFObject& { return object; };
+
+    // RGB image 1000 x 1000 pixels, all PNG predictors are used
+    constexpr int colors = 3;
+    constexpr int columns = 1000;
+    constexpr int stride = colors * columns;
+
+    QByteArray data;
+    data.reserve((stride + 1) * 1000);
+    for (int row = 0; row < 1000; ++row)
+    {
+        data.push_back(static_cast<char>(row % 5));
+        for (int i = 0; i < stride; ++i)
+        {
+            data.push_back(static_cast<char>((i * 7 + row * 13) % 251));
+        }
+    }
+
+    pdf::PDFDictionary dictionary;
+    dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Predictor"), pdf::PDFObject::createInteger(15));
+    dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Colors"), pdf::PDFObject::createInteger(colors));
+    dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Columns"), pdf::PDFObject::createInteger(columns));
+    pdf::PDFObject parameters = pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(dictionary)));
+    pdf::PDFStreamPredictor predictor = pdf::PDFStreamPredictor::createPredictor(objectFetcher, parameters);
+
+    const QByteArray expectedData = applyReferencePNGPredictor(data, colors, stride);
+    QCOMPARE(predictor.apply(data), expectedData);
+
+    QByteArray result;
+    if (isReference)
+    {
+        QBENCHMARK
+        {
+            result = applyReferencePNGPredictor(data, colors, stride);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            result = predictor.apply(data);
+        }
+    }
+
+    QCOMPARE(result, expectedData);
+}
+
+void LexicalAnalyzerTest::test_flate_length_hint()
+{
+    auto objectFetcher = [](const pdf::PDFObject& object) -> const pdf::PDFObject& { return object; };
+
+    QByteArray data;
+    for (int i = 0; i < 300000; ++i)
+    {
+        data.push_back(static_cast<char>((i * 13 + i / 777) % 253));
+    }
+
+    pdf::PDFFlateDecodeFilter filter;
+    QByteArray compressed = pdf::PDFFlateDecodeFilter::compress(data);
+
+    // Length hint can be exact, too small, too large (even near the maximal compression ratio), or unknown
+    for (const pdf::PDFInteger decodedLength : { pdf::PDFInteger(data.size()), pdf::PDFInteger(10), pdf::PDFInteger(data.size() * 3), pdf::PDFInteger(compressed.size()) * 1000, pdf::PDFInteger(-1), std::numeric_limits<pdf::PDFInteger>::max() })
+    {
+        QCOMPARE(filter.applyWithLengthHint(compressed, objectFetcher, pdf::PDFObject(), nullptr, decodedLength), data);
+    }
+
+    // Length hint with PNG predictor (length of the data before applying the predictor differs)
+    constexpr int columns = 100;
+    QByteArray predictedData;
+    for (int i = 0; i < data.size(); ++i)
+    {
+        if (i % columns == 0)
+        {
+            predictedData.push_back(static_cast<char>(2));
+        }
+        predictedData.push_back(data[i]);
+    }
+
+    pdf::PDFDictionary dictionary;
+    dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Predictor"), pdf::PDFObject::createInteger(12));
+    dictionary.addEntry(pdf::PDFInplaceOrMemoryString("Columns"), pdf::PDFObject::createInteger(columns));
+    pdf::PDFObject parameters = pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(dictionary)));
+
+    QByteArray compressedPredictedData = pdf::PDFFlateDecodeFilter::compress(predictedData);
+    QByteArray expectedData = filter.apply(compressedPredictedData, objectFetcher, parameters, nullptr);
+    QCOMPARE(expectedData.size(), data.size());
+    QCOMPARE(filter.applyWithLengthHint(compressedPredictedData, objectFetcher, parameters, nullptr, data.size()), expectedData);
+}
+
+void LexicalAnalyzerTest::test_flate_decode_benchmark_data()
+{
+    QTest::addColumn<bool>("useLengthHint");
+    QTest::addColumn<bool>("isHighlyCompressed");
+
+    // Without length hint, size of the decoded data is guessed from the size of
+    // the compressed data. Highly compressed data do not fit into the guessed buffer.
+    const QString backendName = pdf::PDFFlateDecodeFilter::getBackendName();
+    QTest::newRow(qPrintable(QString("%1, with length hint").arg(backendName))) << true << false;
+    QTest::newRow(qPrintable(QString("%1, without length hint").arg(backendName))) << false << false;
+    QTest::newRow(qPrintable(QString("%1, without length hint, highly compressed").arg(backendName))) << false << true;
+}
+
+void LexicalAnalyzerTest::test_flate_decode_benchmark()
+{
+    QFETCH(bool, useLengthHint);
+    QFETCH(bool, isHighlyCompressed);
+
+    auto objectFetcher = [](const pdf::PDFObject& object) -> const pdf::PDFObject& { return object; };
+
+    // Content stream like data, 1 MB, or image like data with long runs of the same color
+    QByteArray data;
+    data.reserve(1024 * 1024);
+    for (int i = 0; data.size() < 1024 * 1024; ++i)
+    {
+        if (isHighlyCompressed)
+        {
+            data.append(QByteArray(4096, static_cast<char>(i % 7)));
+        }
+        else
+        {
+            data.append(QString("%1 %2 %3 %4 re f\n").arg(i % 612).arg((i * 7) % 792).arg(i % 37).arg(i % 41).toLatin1());
+        }
+    }
+
+    pdf::PDFFlateDecodeFilter filter;
+    const QByteArray compressed = pdf::PDFFlateDecodeFilter::compress(data);
+    const pdf::PDFInteger decodedLength = useLengthHint ? data.size() : -1;
+
+    QByteArray result;
+    QBENCHMARK
+    {
+        result = filter.applyWithLengthHint(compressed, objectFetcher, pdf::PDFObject(), nullptr, decodedLength);
+    }
+
+    QCOMPARE(result, data);
+}
+
 void LexicalAnalyzerTest::test_sampled_function()
 {
     {
@@ -1063,6 +2013,275 @@ void LexicalAnalyzerTest::test_postscript_function()
     test01("2.0 1 index exch div exch pop", [](double x) { return x / 2.0; });
 }
 
+void LexicalAnalyzerTest::test_postscript_function_compiled()
+{
+    // Compiled program must give the same results (and fail on the same inputs)
+    // as the interpreter. Programs, which can't be compiled, fall back to the interpreter.
+    auto test = [](uint32_t m, const char* program, bool shouldBeCompiled)
+    {
+        std::vector<pdf::PDFReal> domain;
+        for (uint32_t i = 0; i < m; ++i)
+        {
+            domain.insert(domain.end(), { 0.0, 1.0 });
+        }
+
+        pdf::PDFPostScriptFunction function(m, 1, std::vector<pdf::PDFReal>(domain), { 0.0, 1.0 }, pdf::PDFPostScriptFunction::parseProgram(program));
+        QCOMPARE(function.isCompiled(), shouldBeCompiled);
+
+        std::vector<pdf::PDFReal> inputs;
+        std::vector<pdf::PDFReal> expectedOutputs;
+        bool isBatchValid = true;
+
+        for (double x1 = -0.5; x1 <= 1.5; x1 += 0.01)
+        {
+            for (double x2 = -0.25; x2 <= (m > 1 ? 1.25 : -0.25); x2 += 0.05)
+            {
+                const std::array<pdf::PDFReal, 2> x = { x1, x2 };
+
+                pdf::PDFReal expected = 0.0;
+                pdf::PDFReal actual = 0.0;
+                pdf::PDFFunction::FunctionResult expectedResult = function.applyInterpreted(x.data(), x.data() + m, &expected, &expected + 1);
+                pdf::PDFFunction::FunctionResult actualResult = function.apply(x.data(), x.data() + m, &actual, &actual + 1);
+
+                if (bool(expectedResult) != bool(actualResult) || (expectedResult && expected != actual))
+                {
+                    qInfo() << qPrintable(QString("Program: %1").arg(QString::fromLatin1(program)));
+                    qInfo() << qPrintable(QString("    Expected: %1, Actual: %2, input value was: %3, %4").arg(expected).arg(actual).arg(x1).arg(x2));
+                    QVERIFY(false);
+                }
+
+                QCOMPARE(actualResult.errorMessage, expectedResult.errorMessage);
+
+                inputs.insert(inputs.end(), x.data(), x.data() + m);
+                expectedOutputs.push_back(expected);
+                isBatchValid = isBatchValid && expectedResult;
+            }
+        }
+
+        std::vector<pdf::PDFReal> outputs(expectedOutputs.size(), 0.0);
+        pdf::PDFFunction::FunctionResult batchResult = function.applyBatch(inputs.data(), outputs.data(), expectedOutputs.size());
+        QCOMPARE(bool(batchResult), isBatchValid);
+
+        if (isBatchValid)
+        {
+            QVERIFY(outputs == expectedOutputs);
+        }
+    };
+
+    test(1, "dup mul", true);
+    test(1, "1.0 exch sub", true);
+    test(1, "100.0 mul cvi 10 idiv cvr 10.0 div", true);
+    test(1, "100.0 mul cvi 2 mod cvr 0.5 mul", true);
+    test(1, "10.0 mul round 10.0 div", true);
+    test(1, "0.2 atan 360.0 div", true);
+    test(1, "1 add ln 2 3 mul 6 eq { 2 } { 3 } ifelse cvr div", true);
+    test(1, "dup 0.5 gt { 1.0 exch sub } if", true);
+    test(1, "dup 0.5 gt { 1.0 exch sub } { 2.0 mul } ifelse", true);
+    test(1, "dup 0.25 gt exch 0.75 lt and { 1.0 } { 0.0 } ifelse", true);
+    test(1, "dup 0.25 gt { dup 0.75 lt { 0.5 mul } { 0.25 mul } ifelse } { 2 exch 2.0 mul exch pop } ifelse", true);
+    test(1, "dup 0.5 lt { 0.5 sub 0.0 exch } { 1.0 } ifelse pop", true);
+    test(1, "pop 4 3 2 1   3 1 roll 2 eq { 3 eq { 1 eq { 4 eq { 1.0 } { 0.0 } ifelse } { 0.0 } ifelse } { 0.0 } ifelse } { 0.0 } ifelse", true);
+    test(1, "2.0 2 copy div 3 1 roll exp add", true);
+    test(1, "2.0 1 index exch div exch pop", true);
+    test(1, "{ 2.0 mul }", true);
+    test(1, "dup 0.5 gt { 0.0 div } if", true);
+    test(1, "0.5 sub sqrt", true);
+    test(1, "dup 0.5 gt { 1 } { 1.0 } ifelse mul", false);
+    test(1, "dup 0.5 gt { pop 1 } if", false);
+    test(1, "1.0 0.0 div", false);
+    test(2, "mul", true);
+    test(2, "2 copy gt { exch } if sub abs", true);
+    test(2, "exch 0.5 gt { 0.5 mul } { 0.25 add } ifelse", true);
+    test(2, "2 index", false);
+}
+
+void LexicalAnalyzerTest::test_cmap_lookup()
+{
+    const char* cmapData = "/CIDInit /ProcSet findresource begin\n"
+                           "12 dict begin\n"
+                           "begincmap\n"
+                           "2 begincodespacerange <00> <80> <8140> <FFFF> endcodespacerange\n"
+                           "3 begincidrange\n"
+                           "<20> <7e> 1\n"
+                           "<8140> <817e> 633\n"
+                           "<8180> <81ac> 696\n"
+                           "endcidrange\n"
+                           "1 begincidchar\n"
+                           "<9000> 9000\n"
+                           "endcidchar\n"
+                           "endcmap\n";
+
+    pdf::PDFFontCMap cmap = pdf::PDFFontCMap::createFromData(cmapData);
+    QVERIFY(cmap.isValid());
+
+    const QByteArray text("\x20\x41\x81\x40\x81\x7e\x81\x80\x81\xac\x90\x00\x7f\x82", 14);
+    const std::vector<pdf::CID> expectedCIDs = { 1, 34, 633, 695, 696, 740, 9000, 0 };
+    QVERIFY(cmap.interpret(text) == expectedCIDs);
+
+    // Serialized CMap must give the same results
+    pdf::PDFFontCMap deserializedCMap = pdf::PDFFontCMap::deserialize(cmap.serialize());
+    QVERIFY(deserializedCMap.interpret(text) == expectedCIDs);
+
+    const char* toUnicodeData = "begincmap\n"
+                                "3 beginbfrange\n"
+                                "<0000> <00ff> <0020>\n"
+                                "<1000> <1100> <4E00>\n"
+                                "<010000> <010010> <0041>\n"
+                                "endbfrange\n"
+                                "1 beginbfchar\n"
+                                "<2000> <00E9>\n"
+                                "endbfchar\n"
+                                "endcmap\n";
+
+    pdf::PDFFontCMap toUnicode = pdf::PDFFontCMap::createFromData(toUnicodeData);
+    QCOMPARE(toUnicode.getToUnicode(0x0005), QChar(0x0025));
+    QCOMPARE(toUnicode.getToUnicode(0x1000), QChar(0x4E00));
+    QCOMPARE(toUnicode.getToUnicode(0x1050), QChar(0x4E50));
+    QCOMPARE(toUnicode.getToUnicode(0x1100), QChar(0x4F00));
+    QCOMPARE(toUnicode.getToUnicode(0x2000), QChar(0x00E9));
+    QCOMPARE(toUnicode.getToUnicode(0x10005), QChar(0x0046));
+    QCOMPARE(toUnicode.getToUnicode(0x0100), QChar());
+    QCOMPARE(toUnicode.getToUnicode(0x3000), QChar());
+    QCOMPARE(toUnicode.getToUnicode(0x10011), QChar());
+}
+
+void LexicalAnalyzerTest::test_cmap_lookup_benchmark_data()
+{
+    QTest::addColumn<bool>("isReference");
+
+    QTest::newRow("linear scan") << true;
+    QTest::newRow("PDFFontCMap") << false;
+}
+
+void LexicalAnalyzerTest::test_cmap_lookup_benchmark()
+{
+    QFETCH(bool, isReference);
+
+    // CJK like CMap, single byte codes and about 3000 ranges of two byte codes
+    std::vector<CMapRange> ranges;
+    ranges.push_back({ 0x20, 0x7E, 1, 1 });
+
+    pdf::CID cid = 100;
+    for (unsigned int high = 0x81; high <= 0xFC; ++high)
+    {
+        for (unsigned int low = 0x40; low <= 0xFC; low += 8)
+        {
+            const unsigned int from = (high << 8) | low;
+            const unsigned int to = (high << 8) | qMin(low + 7, 0xFCu);
+            ranges.push_back({ from, to, 2, cid });
+
+            // CIDs are not contiguous, so ranges can't be merged
+            cid += to - from + 2;
+        }
+    }
+
+    QByteArray cmapData = "begincmap\n2 begincodespacerange <00> <80> <8140> <FCFC> endcodespacerange\n";
+    for (size_t i = 0; i < ranges.size(); i += 100)
+    {
+        const size_t count = qMin<size_t>(100, ranges.size() - i);
+        cmapData.append(QString("%1 begincidrange\n").arg(count).toLatin1());
+        for (size_t j = i; j < i + count; ++j)
+        {
+            const CMapRange& range = ranges[j];
+            const int width = range.byteCount * 2;
+            cmapData.append(QString("<%1> <%2> %3\n").arg(range.from, width, 16, QChar('0')).arg(range.to, width, 16, QChar('0')).arg(range.cid).toLatin1());
+        }
+        cmapData.append("endcidrange\n");
+    }
+    cmapData.append("endcmap\n");
+
+    pdf::PDFFontCMap cmap = pdf::PDFFontCMap::createFromData(cmapData);
+    QVERIFY(cmap.isValid());
+
+    // Text with two byte codes spread over the whole CMap and some single byte codes
+    QByteArray text;
+    for (int i = 0; i < 16384; ++i)
+    {
+        if (i % 16 == 0)
+        {
+            text.push_back(static_cast<char>(0x20 + i % 95));
+        }
+
+        text.push_back(static_cast<char>(0x81 + (i * 37) % 124));
+        text.push_back(static_cast<char>(0x40 + (i * 53) % 189));
+    }
+
+    const std::vector<pdf::CID> expectedCIDs = interpretReferenceCMap(ranges, text);
+    QVERIFY(cmap.interpret(text) == expectedCIDs);
+
+    std::vector<pdf::CID> result;
+    if (isReference)
+    {
+        QBENCHMARK
+        {
+            result = interpretReferenceCMap(ranges, text);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            result = cmap.interpret(text);
+        }
+    }
+
+    QVERIFY(result == expectedCIDs);
+}
+
+void LexicalAnalyzerTest::test_xfa_template_parse()
+{
+    const char* templateData = "<template xmlns=\"http://www.xfa.org/schema/xfa-template/3.3/\">\n"
+                               "  <subform name=\"form1\" layout=\"tb\">\n"
+                               "    <pageSet>\n"
+                               "      <pageArea name=\"Page1\">\n"
+                               "        <contentArea x=\"0.25in\" y=\"0.25in\" w=\"8in\" h=\"10.5in\"/>\n"
+                               "        <medium short=\"8.5in\" long=\"11in\"/>\n"
+                               "      </pageArea>\n"
+                               "    </pageSet>\n"
+                               "    <subform name=\"header\">\n"
+                               "      <draw name=\"title\"><value><text>Title</text></value></draw>\n"
+                               "    </subform>\n"
+                               "    <field name=\"firstName\" w=\"50mm\" h=\"9mm\">\n"
+                               "      <ui><textEdit/></ui>\n"
+                               "      <bind match=\"dataRef\" ref=\"$.person.firstName\"/>\n"
+                               "    </field>\n"
+                               "    <unknownElement><field name=\"ignored\"/></unknownElement>\n"
+                               "    <field name=\"lastName\"><bind match=\"global\"/></field>\n"
+                               "    <draw name=\"footer\"/>\n"
+                               "  </subform>\n"
+                               "</template>\n";
+
+    // Template is parsed and laid out by the form manager, which then changes
+    // page media box to the size of the XFA page area (8.5in x 11in).
+    pdf::PDFDocumentBuilder builder;
+    builder.createDocument();
+    builder.appendPage(QRectF(0, 0, 100, 100));
+
+    const QByteArray templateContent(templateData);
+    pdf::PDFDictionary templateDictionary;
+    templateDictionary.addEntry(pdf::PDFInplaceOrMemoryString("Length"), pdf::PDFObject::createInteger(templateContent.size()));
+    pdf::PDFObjectReference templateReference = builder.addObject(pdf::PDFObject::createStream(std::make_shared<pdf::PDFStream>(qMove(templateDictionary), QByteArray(templateContent))));
+
+    pdf::PDFDictionary acroForm;
+    acroForm.addEntry(pdf::PDFInplaceOrMemoryString("Fields"), pdf::PDFObject::createArray(std::make_shared<pdf::PDFArray>()));
+    acroForm.addEntry(pdf::PDFInplaceOrMemoryString("XFA"), pdf::PDFObject::createReference(templateReference));
+    builder.setCatalogAcroForm(builder.addObject(pdf::PDFObject::createDictionary(std::make_shared<pdf::PDFDictionary>(qMove(acroForm)))));
+    pdf::PDFDocument document = builder.build();
+
+    pdf::PDFFormManager formManager(nullptr);
+    std::optional<pdf::PDFModifiedDocument> pagedDocument;
+    QObject::connect(&formManager, &pdf::PDFFormManager::documentModified, [&pagedDocument](pdf::PDFModifiedDocument modifiedDocument) { pagedDocument = modifiedDocument; });
+
+    formManager.setDocument(pdf::PDFModifiedDocument(&document, nullptr));
+    QVERIFY(formManager.hasXFAForm());
+    formManager.performPaging();
+
+    QVERIFY(pagedDocument.has_value());
+    const pdf::PDFCatalog* catalog = pagedDocument->getDocument()->getCatalog();
+    QCOMPARE(catalog->getPageCount(), size_t(1));
+    QCOMPARE(catalog->getPage(0)->getMediaBox().size(), QSizeF(612, 792));
+}
+
 void LexicalAnalyzerTest::test_jbig2_arithmetic_decoder()
 {
     std::vector<uint8_t> compressed = { 0x84, 0xC7, 0x3B, 0xFC, 0xE1, 0xA1, 0x43, 0x04, 0x02, 0x20, 0x00, 0x00, 0x41, 0x0D, 0xBB, 0x86, 0xF4, 0x31, 0x7F, 0xFF, 0x88, 0xFF, 0x37, 0x47, 0x1A, 0xDB, 0x6A, 0xDF, 0xFF, 0xAC };
@@ -1158,6 +2377,88 @@ QString LexicalAnalyzerTest::getStringFromTokens(const std::vector<pdf::PDFLexic
     return QString("{ %1 }").arg(stringTokens.join(", "));
 }
 
+QByteArray LexicalAnalyzerTest::applyReferencePNGPredictor(const QByteArray& data, int pixelBytes, int stride)
+{
+    QByteArray result;
+    std::vector<int> line(stride + pixelBytes, 0);
+    std::vector<int> lineOld(stride + pixelBytes, 0);
+
+    for (int offset = 0; offset < data.size(); offset += stride + 1)
+    {
+        auto getByte = [&data](int index) { return index < data.size() ? static_cast<uint8_t>(data[index]) : 0; };
+        const int predictor = getByte(offset);
+
+        for (int i = 0; i < stride; ++i)
+        {
+            const int a = line[i];
+            const int b = lineOld[i + pixelBytes];
+            const int c = lineOld[i];
+            const int p = a + b - c;
+            int value = getByte(offset + 1 + i);
+
+            switch (predictor)
+            {
+                case 1:
+                    value += a;
+                    break;
+                case 2:
+                    value += b;
+                    break;
+                case 3:
+                    value += (a + b) / 2;
+                    break;
+                case 4:
+                    value += (std::abs(p - a) <= std::abs(p - b) && std::abs(p - a) <= std::abs(p - c)) ? a : (std::abs(p - b) <= std::abs(p - c) ? b : c);
+                    break;
+                default:
+                    break;
+            }
+
+            line[i + pixelBytes] = value & 0xFF;
+            result.push_back(static_cast<char>(value));
+        }
+
+        std::swap(line, lineOld);
+    }
+
+    return result;
+}
+
+std::vector<pdf::CID> LexicalAnalyzerTest::interpretReferenceCMap(const std::vector<CMapRange>& ranges, const QByteArray& byteArray)
+{
+    std::vector<pdf::CID> result;
+
+    unsigned int maxKeyLength = 0;
+    for (const CMapRange& range : ranges)
+    {
+        maxKeyLength = qMax(maxKeyLength, range.byteCount);
+    }
+
+    unsigned int value = 0;
+    unsigned int scannedBytes = 0;
+    for (int i = 0; i < byteArray.size(); ++i)
+    {
+        value = (value << 8) + static_cast<unsigned char>(byteArray[i]);
+        ++scannedBytes;
+
+        auto it = std::find_if(ranges.cbegin(), ranges.cend(), [value, scannedBytes](const CMapRange& range) { return range.from <= value && range.to >= value && range.byteCount == scannedBytes; });
+        if (it != ranges.cend())
+        {
+            result.push_back(value - it->from + it->cid);
+            value = 0;
+            scannedBytes = 0;
+        }
+        else if (scannedBytes == maxKeyLength)
+        {
+            result.push_back(0);
+            value = 0;
+            scannedBytes = 0;
+        }
+    }
+
+    return result;
+}
+
 #ifdef PDF4QT_COMPILER_MSVC
 #pragma warning(pop)
 #endif